@@ -95,6 +95,7 @@ exhale_args = {
         "../pennylane_lightning_gpu/src/simulator/cuGates_host.hpp "
         "../pennylane_lightning_gpu/src/simulator/StateVectorCudaBase.hpp "
         "../pennylane_lightning_gpu/src/simulator/StateVectorCudaManaged.hpp "
+        "../pennylane_lightning_gpu/src/simulator/StateVectorCudaDistributed.hpp "
         "../pennylane_lightning_gpu/src/util/cuda_helpers.hpp "
         "../pennylane_lightning_gpu/src/util/DevicePool.hpp "
         "../pennylane_lightning_gpu/src/util/TSQueue.hpp "
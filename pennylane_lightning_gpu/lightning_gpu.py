@@ -47,6 +47,8 @@ try:
     from .lightning_gpu_qubit_ops import (
         LightningGPU_C128,
         LightningGPU_C64,
+        LightningGPUBatched_C128,
+        LightningGPUBatched_C64,
         AdjointJacobianGPU_C128,
         AdjointJacobianGPU_C64,
         device_reset,
@@ -78,12 +80,56 @@ except (ModuleNotFoundError, ImportError, ValueError) as e:
     CPP_BINARY_AVAILABLE = False
 
 
+_pauli_basis = {"PauliX", "PauliY", "PauliZ", "Identity"}
+
+# Gates and observables with a host matrix, supported by batched state-vectors
+_batched_gates = {
+    "Identity",
+    "PauliX",
+    "PauliY",
+    "PauliZ",
+    "Hadamard",
+    "S",
+    "T",
+    "CNOT",
+    "SWAP",
+    "CY",
+    "CZ",
+    "CSWAP",
+    "Toffoli",
+    "PhaseShift",
+    "RX",
+    "RY",
+    "RZ",
+    "Rot",
+    "CRX",
+    "CRY",
+    "CRZ",
+    "CRot",
+    "ControlledPhaseShift",
+    "IsingXX",
+    "IsingYY",
+    "IsingZZ",
+    "SingleExcitation",
+    "SingleExcitationMinus",
+    "SingleExcitationPlus",
+    "DoubleExcitation",
+    "DoubleExcitationMinus",
+    "DoubleExcitationPlus",
+}
+_batched_observables = {"PauliX", "PauliY", "PauliZ", "Hadamard", "Identity", "Hermitian"}
+
+
 def _gpu_dtype(dtype):
     if dtype not in [np.complex128, np.complex64]:
         raise ValueError(f"Data type is not supported for state-vector computation: {dtype}")
     return LightningGPU_C128 if dtype == np.complex128 else LightningGPU_C64
 
 
+def _gpu_batched_dtype(dtype):
+    return LightningGPUBatched_C128 if dtype == np.complex128 else LightningGPUBatched_C64
+
+
 class LightningGPU(LightningQubit):
     """PennyLane-Lightning-GPU device.
 
@@ -91,6 +137,9 @@ class LightningGPU(LightningQubit):
         wires (int): the number of wires to initialize the device with
         sync (bool): immediately sync with host-sv after applying operations
         c_dtype: Datatypes for statevector representation. Must be one of ``np.complex64`` or ``np.complex128``.
+        mixed_precision (bool): with ``np.complex64``, accumulate expectation values, inner products
+            and adjoint Jacobians in double precision, while the state is stored and updated in
+            single precision
     """
 
     name = "PennyLane plugin for GPU-backed Lightning device using NVIDIA cuQuantum SDK"
@@ -108,26 +157,84 @@ class LightningGPU(LightningQubit):
         "Identity",
     }
 
-    def __init__(self, wires, *, sync=True, c_dtype=np.complex128, shots=None, batch_obs=False):
+    def __init__(
+        self,
+        wires,
+        *,
+        sync=True,
+        c_dtype=np.complex128,
+        shots=None,
+        batch_obs=False,
+        mixed_precision=False,
+    ):
         super().__init__(wires, c_dtype=c_dtype, shots=shots)
-        self._gpu_state = _gpu_dtype(self._state.dtype)(self._state)
+        # Each device runs on its own stream, so devices driven from separate
+        # threads do not serialize on the legacy default stream
+        self._gpu_state = _gpu_dtype(self._state.dtype)(
+            self._state, DevTag.createWithStream(0)
+        )
+        self._mixed_precision = mixed_precision
+        self._gpu_state.setMixedPrecision(mixed_precision)
         self._sync = sync
         self._dp = DevPool()
         self._batch_obs = batch_obs
+        # A device-to-host copy into the pinned mirror is in flight
+        self._pending_d2h = False
+        # Version of the GPU data held, or being received, by the host state
+        self._host_version = self._gpu_state.getDataVersion()
 
     def reset(self):
         super().reset()
+        self._pending_d2h = False
         self._gpu_state.resetGPU(False)  # Sync reset
+        # Both copies now hold the initial state
+        self._host_version = self._gpu_state.getDataVersion()
 
     def syncH2D(self, use_async=False):
-        """Explicitly synchronize CPU data to GPU"""
+        """Explicitly synchronize CPU data to GPU
+
+        With ``use_async``, the data is staged through a pinned host buffer and
+        the upload overlaps with the following gate applications.
+        """
+        # The host data is now the reference, drop any pending download
+        self._pending_d2h = False
         self._gpu_state.HostToDevice(self._state.ravel(order="C"), use_async)
+        self._host_version = self._gpu_state.getDataVersion()
 
     def syncD2H(self, use_async=False):
-        """Explicitly synchronize GPU data to CPU"""
-        self._gpu_state.DeviceToHost(self._state.ravel(order="C"), use_async)
+        """Explicitly synchronize GPU data to CPU
+
+        With ``use_async``, the transfer into a pinned host buffer is only
+        started, and the host state is filled in when it is next accessed.
+        Nothing is transferred when the host state is already up to date.
+        """
+        version = self._gpu_state.getDataVersion()
+        if self._host_version == version:
+            if not use_async:
+                self._wait_host_state()
+            return
+        self._host_version = version
+        if use_async:
+            self._gpu_state.DeviceToHostAsync()
+            self._pending_d2h = True
+        else:
+            self._gpu_state.DeviceToHost(self._state.ravel(order="C"), False)
+            self._pending_d2h = False
         self._pre_rotated_state = self._state
 
+    def _wait_host_state(self):
+        """Complete a pending asynchronous device-to-host transfer"""
+        if self._pending_d2h:
+            # Downloads again if gates were applied since the copy started
+            self._gpu_state.HostMirrorToHost(self._state.ravel(order="C"))
+            self._host_version = self._gpu_state.getDataVersion()
+            self._pending_d2h = False
+
+    @property
+    def state(self):
+        self._wait_host_state()
+        return super().state
+
     @classmethod
     def capabilities(cls):
         capabilities = super().capabilities().copy()
@@ -143,9 +250,8 @@ class LightningGPU(LightningQubit):
         return capabilities
 
     def statistics(self, observables, shot_range=None, bin_size=None):
-        ## Ensure D2H sync before calculating non-GPU supported operations
-        if self._sync:
-            self.syncD2H()
+        ## Host data is only waited on by the statistics reading it, through
+        ## ``state`` or an explicit syncD2H in the non-GPU supported branches.
         return super().statistics(observables, shot_range, bin_size)
 
     def apply_cq(self, operations, **kwargs):
@@ -184,17 +290,55 @@ class LightningGPU(LightningQubit):
                 param = o.parameters
                 method(wires, inv, param)
 
+    def _apply_state_vector(self, state, device_wires):
+        """Initialize the GPU state-vector with the amplitudes of the given wires.
+
+        Only the ``2**len(device_wires)`` amplitudes are uploaded, and all other wires
+        are set to the zero state on the device.
+
+        Args:
+            state (array[complex]): normalized input state of length ``2**len(device_wires)``
+            device_wires (Wires): wires that get initialized in the state
+        """
+        device_wires = self.map_wires(device_wires)
+        state = np.ravel(np.asarray(state, dtype=self._state.dtype))
+
+        if state.shape[0] != 2 ** len(device_wires):
+            raise ValueError("State vector must be of length 2**wires.")
+        if not np.allclose(np.linalg.norm(state, ord=2), 1.0, atol=1e-10):
+            raise ValueError("Sum of amplitudes-squared does not equal one.")
+
+        self._gpu_state.setStateVector(state, device_wires.tolist())
+
+    def _apply_basis_state(self, state, wires):
+        """Initialize the GPU state-vector in a computational basis state.
+
+        Args:
+            state (array[int]): computational basis state of shape ``(wires,)``
+                consisting of 0s and 1s
+            wires (Wires): wires that the provided computational state should be initialized on
+        """
+        device_wires = self.map_wires(wires)
+        state = np.asarray(state)
+
+        if not set(state.tolist()).issubset({0, 1}):
+            raise ValueError("BasisState parameter must consist of 0 or 1 integers.")
+        if len(state) != len(device_wires):
+            raise ValueError("BasisState parameter and wires must be of equal length.")
+
+        # get computational basis state number
+        basis_states = 2 ** (self.num_wires - 1 - np.array(device_wires.tolist()))
+        self._gpu_state.setBasisState(int(np.dot(state, basis_states)))
+
     def apply(self, operations, **kwargs):
-        # State preparation is currently done in Python
+        # State preparation is done on the device
         if operations:  # make sure operations[0] exists
             if isinstance(operations[0], QubitStateVector):
-                self._apply_state_vector(operations[0].parameters[0].copy(), operations[0].wires)
+                self._apply_state_vector(operations[0].parameters[0], operations[0].wires)
                 del operations[0]
-                self.syncH2D()
             elif isinstance(operations[0], BasisState):
                 self._apply_basis_state(operations[0].parameters[0], operations[0].wires)
                 del operations[0]
-                self.syncH2D()
 
         for operation in operations:
             if isinstance(operation, (QubitStateVector, BasisState)):
@@ -205,7 +349,113 @@ class LightningGPU(LightningQubit):
 
         self.apply_cq(operations)
         if self._sync:
-            self.syncD2H()
+            self.syncD2H(use_async=True)
+
+    def _batched_circuit(self, circuit):
+        """Split a circuit into its structure and its gate parameters, if it can be
+        executed on batched state-vectors.
+
+        Returns:
+            tuple or None: ``(structure, params, matrices)``, where circuits sharing
+            the same ``structure`` and ``matrices`` only differ in their gate
+            parameters ``params``, or ``None`` if the circuit is not supported
+        """
+        if not circuit.observables or any(
+            m.return_type is not Expectation for m in circuit.observables
+        ):
+            return None
+        ops = []
+        params = []
+        for o in circuit.operations:
+            name = o.name.split(".")[0]
+            if name not in _batched_gates:
+                return None
+            try:
+                params.append([float(p) for p in o.parameters])
+            except TypeError:
+                return None
+            ops.append((name, tuple(self.wires.indices(o.wires)), o.inverse))
+
+        observables = []
+        matrices = []
+        for m in circuit.observables:
+            factors = m.obs if isinstance(m, Tensor) else [m]
+            if any(f.name not in _batched_observables for f in factors):
+                return None
+            names = [f.name for f in factors]
+            wires = [self.wires.indices(f.wires) for f in factors]
+            max_wires = _gpu_batched_dtype(self._state.dtype).maxObservableWires()
+            if sum(len(w) for w in wires) > max_wires:
+                return None
+            observables.append((tuple(names), tuple(tuple(w) for w in wires)))
+            matrices.append(
+                [
+                    np.asarray(qml.matrix(f), dtype=self._state.dtype).ravel(order="C")
+                    if f.name == "Hermitian"
+                    else np.array([], dtype=self._state.dtype)
+                    for f in factors
+                ]
+            )
+        return (tuple(ops), tuple(observables)), params, matrices
+
+    def batch_execute(self, circuits):
+        """Execute a batch of circuits.
+
+        Analytic circuits sharing the same gates, wires and expectation values, and
+        only differing in their gate parameters, are evaluated together on batched
+        state-vectors: each gate is applied to all circuits by one kernel, with the
+        parameters of each circuit. Batches larger than the free device memory allows
+        are evaluated in several chunks. Other batches are executed circuit by circuit.
+        """
+        if self.shots is not None or len(circuits) < 2:
+            return super().batch_execute(circuits)
+
+        split = [self._batched_circuit(c) for c in circuits]
+        if any(s is None for s in split):
+            return super().batch_execute(circuits)
+        structure, _, matrices = split[0]
+        for s in split[1:]:
+            if s[0] != structure or not all(
+                np.array_equal(a, b) for f, g in zip(s[2], matrices) for a, b in zip(f, g)
+            ):
+                return super().batch_execute(circuits)
+
+        # Circuits are split in chunks fitting the free device memory and the batch size limit
+        batched_type = _gpu_batched_dtype(self._state.dtype)
+        chunk_size = batched_type.maxBatchSize(len(self.wires))
+        if chunk_size < 2:
+            return super().batch_execute(circuits)
+
+        ops, observables = structure
+        # Parameters of each gate for each circuit, or none for gates without any
+        params = [[s[1][i] for s in split] if split[0][1][i] else [] for i in range(len(ops))]
+        expvals = []
+        for first in range(0, len(circuits), chunk_size):
+            last = min(first + chunk_size, len(circuits))
+            # Release the previous chunk before allocating the next one
+            batched = None
+            batched = batched_type(len(self.wires), last - first)
+            batched.apply(
+                [o[0] for o in ops],
+                [list(o[1]) for o in ops],
+                [o[2] for o in ops],
+                [p[first:last] for p in params],
+            )
+            expvals.append(
+                [
+                    batched.expval(list(names), [list(w) for w in wires], mats)
+                    for (names, wires), mats in zip(observables, matrices)
+                ]
+            )
+        expvals = np.concatenate(expvals, axis=1)
+        results = [self._asarray(expvals[:, b], dtype=self.R_DTYPE) for b in range(len(circuits))]
+
+        if self.tracker.active:
+            self.tracker.update(executions=len(circuits), shots=self._shots)
+            self.tracker.record()
+            self.tracker.update(batches=1, batch_len=len(circuits))
+            self.tracker.record()
+        return results
 
     def adjoint_diff_support_check(self, tape):
         """Check Lightning adjoint differentiation method support for a tape.
@@ -248,17 +498,14 @@ class LightningGPU(LightningQubit):
                     'the "adjoint" differentiation method'
                 )
 
-    def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False, **kwargs):
-        if self.shots is not None:
-            warn(
-                "Requested adjoint differentiation to be computed with finite shots."
-                " The derivative is always exact when using the adjoint differentiation method.",
-                UserWarning,
-            )
-
-        if len(tape.trainable_params) == 0:
-            return np.array(0)
+    def _adjoint_setup(self, tape, starting_state, use_device_state):
+        """Prepare the state and serialize a tape for the adjoint engine.
 
+        Returns:
+            tuple: the adjoint engine, the serialized observables and operations, the trainable
+            operation parameters, their rows in the full parameter list, and the number of
+            trainable parameters of the tape
+        """
         # Check adjoint diff support
         self.adjoint_diff_support_check(tape)
 
@@ -269,10 +516,12 @@ class LightningGPU(LightningQubit):
             if not use_device_state:
                 self.reset()
                 self.execute(tape)
+            self._wait_host_state()
             ket = np.ravel(self._pre_rotated_state, order="C")
 
         if self.use_csingle:
             adj = AdjointJacobianGPU_C64()
+            adj.set_mixed_precision(self._mixed_precision)
             ket = ket.astype(np.complex64)
         else:
             adj = AdjointJacobianGPU_C128()
@@ -304,6 +553,23 @@ class LightningGPU(LightningQubit):
             # whether there must be only one state preparation...
             tp_shift = [i - 1 for i in tp_shift]
 
+        return adj, obs_serialized, ops_serialized, tp_shift, record_tp_rows, all_params
+
+    def adjoint_jacobian(self, tape, starting_state=None, use_device_state=False, **kwargs):
+        if self.shots is not None:
+            warn(
+                "Requested adjoint differentiation to be computed with finite shots."
+                " The derivative is always exact when using the adjoint differentiation method.",
+                UserWarning,
+            )
+
+        if len(tape.trainable_params) == 0:
+            return np.array(0)
+
+        adj, obs_serialized, ops_serialized, tp_shift, record_tp_rows, all_params = (
+            self._adjoint_setup(tape, starting_state, use_device_state)
+        )
+
         if self._dp.getTotalDevices() > 1 and self._batch_obs:
             jac = adj.adjoint_jacobian_batched(
                 self._gpu_state,
@@ -320,7 +586,88 @@ class LightningGPU(LightningQubit):
         jac_r[:, record_tp_rows] = jac
         return jac_r
 
+    def vector_jacobian_product(self, tape, dy, starting_state=None, use_device_state=False):
+        """Compute the vector-Jacobian product of a tape of expectation values with the adjoint
+        method.
+
+        The observables are contracted with the cotangents on the device, so the backward pass
+        holds the same number of states whatever the number of observables, and the full
+        Jacobian is never formed.
+
+        Args:
+            tape (.QuantumTape): tape of expectation values
+            dy (array[float]): cotangent of each measurement of the tape
+            starting_state (array[complex]): state to differentiate, instead of executing the tape
+            use_device_state (bool): differentiate the current device state
+
+        Returns:
+            array[float]: the vector-Jacobian product, one entry per trainable parameter
+        """
+        if self.shots is not None:
+            warn(
+                "Requested adjoint differentiation to be computed with finite shots."
+                " The derivative is always exact when using the adjoint differentiation method.",
+                UserWarning,
+            )
+
+        dy = np.ravel(np.asarray(dy, dtype=np.float64))
+        if dy.size != len(tape.observables):
+            raise ValueError(
+                f"Expected {len(tape.observables)} cotangents, one per measurement; got {dy.size}."
+            )
+
+        if len(tape.trainable_params) == 0:
+            return np.array(0)
+
+        adj, obs_serialized, ops_serialized, tp_shift, record_tp_rows, all_params = (
+            self._adjoint_setup(tape, starting_state, use_device_state)
+        )
+
+        vjp = adj.vjp(self._gpu_state, obs_serialized, ops_serialized, tp_shift, dy)
+
+        vjp_r = np.zeros(all_params)
+        vjp_r[record_tp_rows] = vjp
+        return vjp_r
+
+    def _pauli_words(self, observable):
+        """Split the terms of a Hamiltonian into Pauli words.
+
+        Returns:
+            tuple[list[list[str]], list[list[int]]] or None: operator names and
+            device wires of each term, or ``None`` if a term is not a product of
+            Pauli operators
+        """
+        names, wires = [], []
+        for op in observable.ops:
+            obs = op.obs if isinstance(op, Tensor) else [op]
+            if any(o.name not in _pauli_basis for o in obs):
+                return None
+            names.append([o.name for o in obs])
+            wires.append([self.wires.index(w) for o in obs for w in o.wires])
+        return names, wires
+
     def expval(self, observable, shot_range=None, bin_size=None):
+        if (
+            self.shots is None
+            and observable.name == "SparseHamiltonian"
+            and observable.wires == self.wires
+        ):
+            csr = observable.data[0].tocsr(copy=False)
+            return self._gpu_state.ExpectationValueSparse(csr.indptr, csr.indices, csr.data)
+
+        if self.shots is None and observable.name == "Hamiltonian":
+            words = self._pauli_words(observable)
+            if words is not None:
+                coeffs = np.real(np.array(observable.coeffs, dtype=np.complex128))
+                return self._gpu_state.ExpectationValueHamiltonian(coeffs, *words)
+
+        if self.shots is None and observable.name == "Projector":
+            # The expectation value is the probability of the basis state
+            basis_state = [int(b) for b in observable.parameters[0]]
+            return self._gpu_state.Probability(
+                [], self.wires.indices(observable.wires), basis_state
+            )[0]
+
         if observable.name in [
             "Projector",
             "Hamiltonian",
@@ -357,13 +704,7 @@ class LightningGPU(LightningQubit):
 
         # translate to wire labels used by device
         device_wires = self.map_wires(wires)
-        # Device returns as col-major orderings, so perform transpose on data for bit-index shuffle for now.
-        return (
-            self._gpu_state.Probability(device_wires)
-            .reshape([2] * len(wires))
-            .transpose()
-            .reshape(-1)
-        )
+        return self._gpu_state.Probability(device_wires)
 
     def generate_samples(self):
         """Generate samples
@@ -371,7 +712,7 @@ class LightningGPU(LightningQubit):
         Returns:
             array[int]: array of samples in binary representation with shape ``(dev.shots, dev.num_wires)``
         """
-        return self._gpu_state.GenerateSamples(len(self.wires), self.shots).astype(int)
+        return self._gpu_state.GenerateSamplesBits(len(self.wires), self.shots).astype(int)
 
     def var(self, observable, shot_range=None, bin_size=None):
         if self.shots is not None:
@@ -380,24 +721,13 @@ class LightningGPU(LightningQubit):
             samples = self.sample(observable, shot_range=shot_range, bin_size=bin_size)
             return np.squeeze(np.var(samples, axis=0))
 
-        adjoint_matrix = math.T(math.conj(qml.matrix(observable)))
-        sqr_matrix = np.matmul(adjoint_matrix, qml.matrix(observable))
-
-        mean = self._gpu_state.ExpectationValue(
-            [i + "_var" for i in observable.name],
+        names = observable.name if isinstance(observable.name, list) else [observable.name]
+        _, variance = self._gpu_state.ExpectationValueAndVariance(
+            names,
             self.wires.indices(observable.wires),
-            observable.parameters,
             qml.matrix(observable).ravel(order="C"),
         )
-
-        squared_mean = self._gpu_state.ExpectationValue(
-            [i + "_sqr" for i in observable.name],
-            self.wires.indices(observable.wires),
-            observable.parameters,
-            sqr_matrix.ravel(order="C"),
-        )
-
-        return squared_mean - (mean**2)
+        return variance
 
 
 if not CPP_BINARY_AVAILABLE:
@@ -1,26 +1,24 @@
 #pragma once
 
-#include <chrono>
-#include <future>
+#include <algorithm>
 #include <omp.h>
 #include <thread>
+#include <unordered_set>
 #include <variant>
 
 #include "DevTag.hpp"
+#include "DeviceExecutor.hpp"
 #include "DevicePool.hpp"
 #include "JacobianTape.hpp"
+#include "NvtxRange.hpp"
 #include "StateVectorCudaManaged.hpp"
+#include "StreamPool.hpp"
 
 /// @cond DEV
 namespace {
 using namespace Pennylane::CUDA;
 namespace cuUtil = Pennylane::CUDA::Util;
 
-template <class CFP_t> static constexpr auto getP11_CU() -> std::vector<CFP_t> {
-    return {cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(), cuUtil::ZERO<CFP_t>(),
-            cuUtil::ONE<CFP_t>()};
-}
-
 template <class T = double, class SVType>
 void applyGeneratorRX_GPU(SVType &sv, const std::vector<size_t> &wires,
                           const bool adj = false) {
@@ -59,8 +57,7 @@ void applyGeneratorIsingZZ_GPU(SVType &sv, const std::vector<size_t> &wires,
 template <class T = double, class SVType>
 void applyGeneratorPhaseShift_GPU(SVType &sv, const std::vector<size_t> &wires,
                                   const bool adj = false) {
-    sv.applyOperation("P_11", wires, adj, {0.0},
-                      getP11_CU<decltype(cuUtil::getCudaType(T{}))>());
+    sv.applyGeneratorPhaseShift(wires, adj);
 }
 
 template <class T = double, class SVType>
@@ -85,8 +82,7 @@ template <class T = double, class SVType>
 void applyGeneratorControlledPhaseShift_GPU(SVType &sv,
                                             const std::vector<size_t> &wires,
                                             const bool adj = false) {
-    sv.applyOperation("P_11", {wires.back()}, adj, {0.0},
-                      getP11_CU<decltype(cuUtil::getCudaType(T{}))>());
+    sv.applyGeneratorControlledPhaseShift(wires, adj);
 }
 template <class T = double, class SVType>
 void applyGeneratorSingleExcitation_GPU(SVType &sv,
@@ -252,6 +248,15 @@ template <class T = double> class AdjointJacobianGPU {
         {"MultiRZ",
          &::applyGeneratorMultiRZ_GPU<T, StateVectorCudaManaged<T>>}};
 
+    // Device memory budget for the observable-applied states; 0 if unset.
+    std::size_t memory_budget_{0};
+    // Bind each observable-applied state to its own stream.
+    bool use_stream_pool_{false};
+    // Maximum fused gate width of the forward pass; 0 disables fusion.
+    std::size_t fusion_max_width_{0};
+    // Accumulate the overlaps of single-precision states in double precision.
+    bool mixed_precision_{false};
+
     // Holds the mappings from gate labels to associated generator coefficients.
     const std::unordered_map<std::string, T> scaling_factors{
         {"RX", -static_cast<T>(0.5)},
@@ -274,31 +279,76 @@ template <class T = double> class AdjointJacobianGPU {
         {"MultiRZ", -static_cast<T>(0.5)}};
 
     /**
-     * @brief Utility method to update the Jacobian at a given index by
-     * calculating the overlap between two given states.
+     * @brief Utility method to update the Jacobian column of a given
+     * parameter by calculating the overlaps between all observable-applied
+     * states and a given state. The observable states are stored contiguously,
+     * allowing all overlaps to be computed by a single GEMV call. The results
+     * are written to device memory without synchronizing with the host.
+     * Overlaps of single-precision states written to a complex128 buffer are
+     * accumulated in double precision by a custom kernel instead.
      *
-     * @param sv1 Statevector <sv1|. Data will be conjugated.
-     * @param sv2 Statevector |sv2>
-     * @param jac Jacobian receiving the values.
-     * @param scaling_coeff Generator coefficient for given gate derivative.
-     * @param obs_index Observable index position of Jacobian to update.
+     * @tparam OverlapT CUDA complex type of the overlaps.
+     * @param H_lambda_block Contiguous device storage of the observable
+     * states <H_lambda_i|. Data will be conjugated.
+     * @param num_states Number of states in `H_lambda_block` to use.
+     * @param obs_offset Observable index of the first state in the block.
+     * @param num_observables Total number of observables in the Jacobian.
+     * @param sv Statevector |sv>
+     * @param jac_device Device buffer receiving the overlaps.
      * @param param_index Parameter index position of Jacobian to update.
      */
-    inline void updateJacobian(const StateVectorCudaManaged<T> &sv1,
-                               const StateVectorCudaManaged<T> &sv2,
-                               std::vector<std::vector<T>> &jac,
-                               T scaling_coeff, size_t obs_index,
+    template <class OverlapT>
+    inline void updateJacobian(const CUDA::DataBuffer<CFP_t> &H_lambda_block,
+                               size_t num_states, size_t obs_offset,
+                               size_t num_observables,
+                               const StateVectorCudaManaged<T> &sv,
+                               CUDA::DataBuffer<OverlapT> &jac_device,
                                size_t param_index) {
-        PL_ABORT_IF_NOT(sv1.getDataBuffer().getDevTag().getDeviceID() ==
-                            sv2.getDataBuffer().getDevTag().getDeviceID(),
+        PL_NVTX_RANGE("updateJacobian");
+        PL_ABORT_IF_NOT(H_lambda_block.getDevTag().getDeviceID() ==
+                            sv.getDataBuffer().getDevTag().getDeviceID(),
                         "Data exists on different GPUs. Aborting.");
 
-        jac[obs_index][param_index] =
-            -2 * scaling_coeff *
-            innerProdC_CUDA(sv1.getData(), sv2.getData(), sv1.getLength(),
-                            sv1.getDataBuffer().getDevTag().getDeviceID(),
-                            sv1.getDataBuffer().getDevTag().getStreamID())
-                .y;
+        OverlapT *result =
+            jac_device.getData() + param_index * num_observables + obs_offset;
+        if constexpr (std::is_same_v<OverlapT, CFP_t>) {
+            innerProdsC_CUDA_device(
+                H_lambda_block.getData(), sv.getData(), sv.getLength(),
+                num_states, sv.getDataBuffer().getDevTag().getDeviceID(),
+                sv.getDataBuffer().getDevTag().getStreamID(), result);
+        } else {
+            PL_CUDA_IS_SUCCESS(innerProdsMixed_CUDA(
+                H_lambda_block.getData(), sv.getData(), sv.getLength(),
+                num_states, result,
+                sv.getDataBuffer().getDevTag().getStreamID()));
+        }
+    }
+
+    /**
+     * @brief Read back the device-side overlaps computed by `updateJacobian`
+     * in a single transfer, and scale them into the Jacobian.
+     *
+     * @param jac_device Device buffer holding the overlaps, stored
+     * parameter-major.
+     * @param scaling_coeffs Generator coefficient for each trainable parameter.
+     * @param jac Jacobian receiving the values.
+     */
+    template <class OverlapT>
+    inline void
+    copyJacobianToHost(const CUDA::DataBuffer<OverlapT> &jac_device,
+                       const std::vector<T> &scaling_coeffs,
+                       std::vector<std::vector<T>> &jac) {
+        const size_t num_observables = jac.size();
+        std::vector<OverlapT> overlaps(jac_device.getLength());
+        jac_device.CopyGpuDataToHost(overlaps.data(), overlaps.size(), false);
+
+        for (size_t obs_idx = 0; obs_idx < num_observables; obs_idx++) {
+            for (size_t tp_idx = 0; tp_idx < scaling_coeffs.size(); tp_idx++) {
+                jac[obs_idx][tp_idx] = static_cast<T>(
+                    -2 * scaling_coeffs[tp_idx] *
+                    overlaps[tp_idx * num_observables + obs_idx].y);
+            }
+        }
     }
 
     /**
@@ -314,6 +364,14 @@ template <class T = double> class AdjointJacobianGPU {
     applyOperations(StateVectorCudaManaged<T> &state,
                     const Pennylane::Algorithms::OpsData<T> &operations,
                     bool adj = false) {
+        if (!adj) {
+            // Multi-op call, so gate fusion applies if enabled on `state`
+            state.applyOperation(operations.getOpsName(),
+                                 operations.getOpsWires(),
+                                 operations.getOpsInverses(),
+                                 operations.getOpsParams());
+            return;
+        }
         for (size_t op_idx = 0; op_idx < operations.getOpsName().size();
              op_idx++) {
             state.applyOperation(operations.getOpsName()[op_idx],
@@ -325,21 +383,16 @@ template <class T = double> class AdjointJacobianGPU {
 
     /**
      * @brief Utility method to apply the adjoint indexed operation from
-     * `%Pennylane::Algorithms::OpsData<T>` object to
-     * `%StateVectorCudaManaged<T>`.
+     * `%CompiledOps<T>` object to `%StateVectorCudaManaged<T>`.
      *
      * @param state Statevector to be updated.
-     * @param operations Operations to apply.
+     * @param operations Compiled operations to apply.
      * @param op_idx Adjointed operation index to apply.
      */
-    inline void
-    applyOperationAdj(StateVectorCudaManaged<T> &state,
-                      const Pennylane::Algorithms::OpsData<T> &operations,
-                      size_t op_idx) {
-        state.applyOperation(operations.getOpsName()[op_idx],
-                             operations.getOpsWires()[op_idx],
-                             !operations.getOpsInverses()[op_idx],
-                             operations.getOpsParams()[op_idx]);
+    inline void applyOperationAdj(StateVectorCudaManaged<T> &state,
+                                  const CompiledOps<T> &operations,
+                                  size_t op_idx) {
+        state.applyCompiledOperation(operations, op_idx, true);
     }
 
     /**
@@ -387,9 +440,29 @@ template <class T = double> class AdjointJacobianGPU {
         }
     }
 
+    /**
+     * @brief Check whether every statevector is bound to its own stream, and
+     * so to its own custatevec handle (see `DeviceContext`). Only then may
+     * they be driven from several host threads at once.
+     *
+     * @param states Vector of statevectors.
+     */
+    static auto
+    hasDistinctStreams(const std::vector<StateVectorCudaManaged<T>> &states)
+        -> bool {
+        std::unordered_set<cudaStream_t> streams;
+        for (const auto &state : states) {
+            if (!streams.insert(state.getStream()).second) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * @brief OpenMP accelerated application of observables to given
-     * statevectors
+     * statevectors. States sharing a stream also share a custatevec handle,
+     * so they are processed by a single thread.
      *
      * @param states Vector of statevector copies, one per observable.
      * @param reference_state Reference statevector
@@ -405,8 +478,9 @@ template <class T = double> class AdjointJacobianGPU {
         // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
         std::exception_ptr ex = nullptr;
         size_t num_observables = observables.size();
+        [[maybe_unused]] const bool parallel = hasDistinctStreams(states);
         #if defined(_OPENMP)
-            #pragma omp parallel default(none)                                 \
+            #pragma omp parallel if(parallel) default(none)                    \
             shared(states, reference_state, observables, ex, num_observables)
         {
             #pragma omp for
@@ -439,7 +513,8 @@ template <class T = double> class AdjointJacobianGPU {
 
     /**
      * @brief OpenMP accelerated application of adjoint operations to
-     * statevectors.
+     * statevectors. States sharing a stream also share a custatevec handle,
+     * so they are processed by a single thread.
      *
      * @param states Vector of all statevectors; 1 per observable
      * @param operations Operations list.
@@ -448,16 +523,16 @@ template <class T = double> class AdjointJacobianGPU {
      */
     inline void
     applyOperationsAdj(std::vector<StateVectorCudaManaged<T>> &states,
-                       const Pennylane::Algorithms::OpsData<T> &operations,
-                       size_t op_idx) {
+                       const CompiledOps<T> &operations, size_t op_idx) {
         // clang-format off
         // Globally scoped exception value to be captured within OpenMP block.
         // See the following for OpenMP design decisions:
         // https://www.openmp.org/wp-content/uploads/openmp-examples-4.5.0.pdf
         std::exception_ptr ex = nullptr;
         size_t num_states = states.size();
+        [[maybe_unused]] const bool parallel = hasDistinctStreams(states);
         #if defined(_OPENMP)
-            #pragma omp parallel default(none)                                 \
+            #pragma omp parallel if(parallel) default(none)                    \
                 shared(states, operations, op_idx, ex, num_states)
         {
             #pragma omp for
@@ -487,6 +562,47 @@ template <class T = double> class AdjointJacobianGPU {
         // clang-format on
     }
 
+    /**
+     * @brief Stream-ordered application of observables to given statevectors.
+     * Each statevector is expected to be bound to its own stream, already
+     * ordered after the work producing `reference_state`. The copies and
+     * observables are issued from a single host thread and overlap on the
+     * device.
+     *
+     * @param states Vector of statevector copies, one per observable.
+     * @param reference_state Reference statevector
+     * @param observables Vector of observables to apply to each statevector.
+     */
+    inline void
+    applyObservablesStreamed(std::vector<StateVectorCudaManaged<T>> &states,
+                             const StateVectorCudaManaged<T> &reference_state,
+                             const std::vector<ObsDatum<T>> &observables) {
+        for (size_t h_i = 0; h_i < observables.size(); h_i++) {
+            states[h_i].updateData(reference_state, true);
+            applyObservable(states[h_i], observables[h_i]);
+        }
+    }
+
+    /**
+     * @brief Stream-ordered application of adjoint operations to
+     * statevectors. Each statevector is expected to be bound to its own
+     * stream, so the calls are issued from a single host thread and overlap
+     * on the device.
+     *
+     * @param states Vector of all statevectors; 1 per observable
+     * @param operations Operations list.
+     * @param op_idx Index of given operation within operations list to take
+     * adjoint of.
+     */
+    inline void
+    applyOperationsAdjStreamed(std::vector<StateVectorCudaManaged<T>> &states,
+                               const CompiledOps<T> &operations,
+                               size_t op_idx) {
+        for (auto &state : states) {
+            applyOperationAdj(state, operations, op_idx);
+        }
+    }
+
     /**
      * @brief Inline utility to assist with getting the Jacobian index offset.
      *
@@ -500,6 +616,133 @@ template <class T = double> class AdjointJacobianGPU {
         return obs_index * tp_size + tp_index;
     }
 
+    /**
+     * @brief Get the number of observable-applied states that fit in the
+     * memory budget, reserving room for an extra copy of the forward state
+     * when more than one chunk is required. Idle blocks of the
+     * `DeviceMemoryPool` on the current device count as free memory.
+     *
+     * @param length Length of each statevector.
+     * @param num_observables Number of observables in the Jacobian.
+     * @return size_t Number of observables processed per chunk.
+     */
+    inline auto getObservableChunkSize(size_t length, size_t num_observables)
+        -> size_t {
+        std::size_t free_bytes = 0;
+        std::size_t total_bytes = 0;
+        PL_CUDA_IS_SUCCESS(cudaMemGetInfo(&free_bytes, &total_bytes));
+        int device_id = -1;
+        PL_CUDA_IS_SUCCESS(cudaGetDevice(&device_id));
+        free_bytes += CUDA::DeviceMemoryPool::getInstance().getCachedBytes(
+            device_id);
+
+        // Leave headroom for custatevec workspaces and the gate caches
+        auto budget = static_cast<std::size_t>(free_bytes * 0.9);
+        if (memory_budget_ > 0) {
+            budget = std::min(budget, memory_budget_);
+        }
+        const std::size_t sv_bytes = length * sizeof(CFP_t);
+        const std::size_t max_states = budget / sv_bytes;
+        if (max_states >= num_observables) {
+            return num_observables;
+        }
+        PL_ABORT_IF(max_states < 2,
+                    "Insufficient device memory for the adjoint method.");
+        return max_states - 1;
+    }
+
+    /**
+     * @brief Run the backward pass for one chunk of observables, updating the
+     * device-side Jacobian rows of those observables.
+     *
+     * @param lambda Forward state, reverted by the backward pass.
+     * @param mu Scratch state receiving the generator-applied copies.
+     * @param H_lambda Observable-applied states for this chunk.
+     * @param H_lambda_block Contiguous device storage of `H_lambda`.
+     * @param ops Operations used to create the forward state.
+     * @param compiled `ops` compiled for the device of `lambda`.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param obs_offset Observable index of the first state in the chunk.
+     * @param num_observables Total number of observables in the Jacobian.
+     * @param jac_device Device buffer receiving the overlaps.
+     * @param scaling_coeffs Receives the generator coefficient of each
+     * trainable parameter.
+     * @param stream_pool Streams bound to the states of `H_lambda`, or
+     * `nullptr` if all states share the stream of `lambda`.
+     */
+    template <class OverlapT>
+    void backwardPass(StateVectorCudaManaged<T> &lambda,
+                      StateVectorCudaManaged<T> &mu,
+                      std::vector<StateVectorCudaManaged<T>> &H_lambda,
+                      const CUDA::DataBuffer<CFP_t> &H_lambda_block,
+                      const Pennylane::Algorithms::OpsData<T> &ops,
+                      const CompiledOps<T> &compiled,
+                      const std::vector<size_t> &trainableParams,
+                      size_t obs_offset, size_t num_observables,
+                      CUDA::DataBuffer<OverlapT> &jac_device,
+                      std::vector<T> &scaling_coeffs,
+                      StreamPool *stream_pool = nullptr) {
+        const std::vector<std::string> &ops_name = ops.getOpsName();
+        const size_t tp_size = trainableParams.size();
+        const size_t num_param_ops = ops.getNumParOps();
+
+        // Track positions within par and non-par operations
+        size_t trainableParamNumber = tp_size - 1;
+        size_t current_param_idx =
+            num_param_ops - 1; // total number of parametric ops
+        auto tp_it = trainableParams.rbegin();
+        const auto tp_rend = trainableParams.rend();
+
+        for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
+             op_idx--) {
+            PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
+                        "The operation is not supported using the adjoint "
+                        "differentiation method");
+            if ((ops_name[op_idx] == "QubitStateVector") ||
+                (ops_name[op_idx] == "BasisState")) {
+                continue;
+            }
+            if (tp_it == tp_rend) {
+                break; // All done
+            }
+            mu.updateData(lambda);
+            applyOperationAdj(lambda, compiled, op_idx);
+
+            if (ops.hasParams(op_idx)) {
+                if (current_param_idx == *tp_it) {
+                    scaling_coeffs[trainableParamNumber] =
+                        applyGenerator(mu, ops.getOpsName()[op_idx],
+                                       ops.getOpsWires()[op_idx],
+                                       !ops.getOpsInverses()[op_idx]) *
+                        (ops.getOpsInverses()[op_idx] ? -1 : 1);
+
+                    // The reduction reads every observable state, so the
+                    // observable streams only meet the main stream here
+                    if (stream_pool != nullptr) {
+                        stream_pool->join(mu.getStream());
+                    }
+                    updateJacobian(H_lambda_block, H_lambda.size(), obs_offset,
+                                   num_observables, mu, jac_device,
+                                   trainableParamNumber);
+                    if (stream_pool != nullptr) {
+                        stream_pool->fork(mu.getStream());
+                    }
+                    trainableParamNumber--;
+                    ++tp_it;
+                }
+                current_param_idx--;
+            }
+            if (stream_pool != nullptr) {
+                applyOperationsAdjStreamed(H_lambda, compiled,
+                                           static_cast<size_t>(op_idx));
+            } else {
+                applyOperationsAdj(H_lambda, compiled,
+                                   static_cast<size_t>(op_idx));
+            }
+        }
+    }
+
     /**
      * @brief Applies the gate generator for a given parameteric gate. Returns
      * the associated scaling coefficient.
@@ -521,6 +764,88 @@ template <class T = double> class AdjointJacobianGPU {
   public:
     AdjointJacobianGPU() = default;
 
+    /**
+     * @brief Set the device memory budget, in bytes, for the
+     * observable-applied states of `adjointJacobian`. Observables are
+     * processed in chunks when their states do not fit. A value of 0 uses the
+     * free device memory reported by `cudaMemGetInfo`.
+     *
+     * @param memory_budget Memory budget in bytes.
+     */
+    void setMemoryBudget(std::size_t memory_budget) {
+        memory_budget_ = memory_budget;
+    }
+
+    /**
+     * @brief Get the device memory budget for the observable-applied states,
+     * in bytes. 0 indicates no budget beyond the free device memory.
+     */
+    [[nodiscard]] auto getMemoryBudget() const -> std::size_t {
+        return memory_budget_;
+    }
+
+    /**
+     * @brief Enable or disable the stream-pool execution mode of
+     * `adjointJacobian`. When enabled, each observable-applied state is bound
+     * to its own non-blocking stream and custatevec handle, so the adjoint
+     * gates of different observables overlap on the device. The streams only
+     * synchronize with the main stream at the Jacobian reductions. This mainly
+     * benefits small qubit counts, where single kernels do not fill the
+     * device.
+     *
+     * @param use_stream_pool Use one stream per observable state.
+     */
+    void setUseStreamPool(bool use_stream_pool) {
+        use_stream_pool_ = use_stream_pool;
+    }
+
+    /**
+     * @brief Indicate whether the stream-pool execution mode is enabled.
+     */
+    [[nodiscard]] auto getUseStreamPool() const -> bool {
+        return use_stream_pool_;
+    }
+
+    /**
+     * @brief Set the maximum fused gate width used when `adjointJacobian`
+     * applies the operations to the input state. See
+     * `StateVectorCudaManaged::setFusionMaxWidth`. The backward pass is not
+     * fused, since it needs the state between every trainable gate.
+     *
+     * @param max_width Maximum number of wires of a fused gate. 0 disables
+     * fusion.
+     */
+    void setFusionMaxWidth(std::size_t max_width) {
+        fusion_max_width_ = max_width;
+    }
+
+    /**
+     * @brief Get the maximum fused gate width of the forward pass.
+     */
+    [[nodiscard]] auto getFusionMaxWidth() const -> std::size_t {
+        return fusion_max_width_;
+    }
+
+    /**
+     * @brief Accumulate the Jacobian overlaps of single-precision states in
+     * double precision. The states are still stored and updated in complex64,
+     * and the overlaps are reduced by a double-precision kernel instead of a
+     * single-precision GEMV. No effect in double precision.
+     *
+     * @param mixed_precision Use double-precision overlaps.
+     */
+    void setMixedPrecision(bool mixed_precision) {
+        mixed_precision_ = mixed_precision;
+    }
+
+    /**
+     * @brief Indicate whether the Jacobian overlaps are accumulated in double
+     * precision.
+     */
+    [[nodiscard]] auto getMixedPrecision() const -> bool {
+        return mixed_precision_ || std::is_same_v<T, double>;
+    }
+
     /**
      * @brief Utility to create a given operations object.
      *
@@ -547,6 +872,15 @@ template <class T = double> class AdjointJacobianGPU {
      * Explicitly forbids OMP_NUM_THREADS>1 to avoid issues with std::thread
      * contention and state access issues.
      *
+     * The observables are split into several tasks per GPU, which are run by
+     * the persistent per-device workers of `DeviceExecutor`. The workers of
+     * the devices used by the call share its tasks, so uneven observable
+     * costs do not leave GPUs waiting on the slowest chunk. The reference
+     * state is broadcast once from its device to the other devices used, no
+     * more than there are tasks, with peer-to-peer copies (see
+     * `cuUtil::broadcastPeer`). Tasks running on the source device read it in
+     * place, and each copy is released once its device has no task left.
+     *
      * @param ref_data Pointer to the statevector data.
      * @param length Length of the statevector data.
      * @param jac Preallocated vector for Jacobian data results.
@@ -564,74 +898,77 @@ template <class T = double> class AdjointJacobianGPU {
         const Pennylane::Algorithms::OpsData<T> &ops,
         const std::vector<size_t> &trainableParams,
         bool apply_operations = false) {
+        if (obs.empty()) {
+            return;
+        }
+        // Number of tasks created per device, giving idle workers something
+        // to steal without repeating the backward sweep of lambda too often.
+        constexpr std::size_t tasks_per_device = 4;
+
+        auto &executor = DeviceExecutor::getInstance();
+        const auto num_gpus = executor.getNumDevices();
+        const auto num_tasks =
+            std::min(obs.size(), num_gpus * tasks_per_device);
+        const auto task_size = (obs.size() + num_tasks - 1) / num_tasks;
 
-        // Create a pool of available GPU devices
-        DevicePool<int> dp;
-        const auto num_gpus = dp.getTotalDevices();
-        const auto num_chunks = num_gpus;
-
-        // Create a vector of threads for separate GPU executions
-        using namespace std::chrono_literals;
-        std::vector<std::thread> threads;
-        threads.reserve(num_gpus);
-
-        // Hold results of threaded GPU executions
-        std::vector<std::future<std::vector<std::vector<T>>>> futures;
-
-        // Iterate over the chunked observables, and submit the Jacobian task
-        // for execution
-        for (std::size_t i = 0; i < num_chunks; i++) {
-            const auto first = static_cast<std::size_t>(
-                std::ceil(obs.size() * i / num_chunks));
-            const auto last = static_cast<std::size_t>(
-                std::ceil((obs.size() * (i + 1) / num_chunks) - 1));
-
-            std::promise<std::vector<std::vector<T>>> jac_subset_promise;
-            futures.emplace_back(jac_subset_promise.get_future());
-
-            auto adj_lambda =
-                [&](std::promise<std::vector<std::vector<T>>> j_promise) {
-                    // Ensure No OpenMP threads spawned;
-                    // to be resolved with streams in future releases
-                    omp_set_num_threads(1);
-                    // Grab a GPU index, and set a device tag
-                    const auto id = dp.acquireDevice();
-                    DevTag<int> dt_local(id, 0);
-                    dt_local.refresh();
-
-                    // Create a sv copy on this thread and device; may not be
-                    // necessary, could do in adjoint calculation directly
-                    StateVectorCudaManaged<T> local_sv(ref_data, length,
-                                                       dt_local);
-
-                    // Create local store for Jacobian subset
-                    std::vector<std::vector<T>> jac_local(
-                        (last - first + 1),
-                        std::vector<T>(trainableParams.size(), 0));
-                    adjointJacobian(
-                        local_sv.getData(), length, jac_local,
-                        {obs.begin() + first, obs.begin() + last + 1}, ops,
-                        trainableParams, apply_operations, dt_local);
-
-                    j_promise.set_value(std::move(jac_local));
-                    dp.releaseDevice(id);
-                };
-            threads.emplace_back(adj_lambda, std::move(jac_subset_promise));
+        // Devices running the tasks, starting with the one holding the data
+        const int src_device = cuUtil::getPointerDevice(ref_data);
+        const auto num_devices = std::min(num_gpus, num_tasks);
+        std::vector<int> devices{src_device};
+        for (std::size_t dev = 0; devices.size() < num_devices; dev++) {
+            if (static_cast<int>(dev) != src_device) {
+                devices.push_back(static_cast<int>(dev));
+            }
         }
-        /// Keep going here; ensure the new local jacs are inserted and
-        /// overwrite the 0 jacs values before returning
-        for (std::size_t i = 0; i < futures.size(); i++) {
-            const auto first = static_cast<std::size_t>(
-                std::ceil(obs.size() * i / num_chunks));
-
-            auto jac_rows = futures[i].get();
-            for (std::size_t j = 0; j < jac_rows.size(); j++) {
-                jac.at(first + j) = std::move(jac_rows[j]);
+
+        // Resident copies of the reference state on the other devices
+        std::vector<std::unique_ptr<DataBuffer<CFP_t, int>>> ref_buffers(
+            num_gpus);
+        std::vector<const CFP_t *> ref_ptrs(num_gpus, ref_data);
+        {
+            PL_NVTX_RANGE("batchAdjointJacobian::broadcast");
+            std::vector<CFP_t *> dsts;
+            std::vector<int> dst_devices(devices.begin() + 1, devices.end());
+            std::vector<cudaStream_t> dst_streams;
+            for (const auto dev : dst_devices) {
+                ref_buffers[dev] = std::make_unique<DataBuffer<CFP_t, int>>(
+                    length, DevTag<int>{dev, 0});
+                dsts.push_back(ref_buffers[dev]->getData());
+                dst_streams.push_back(ref_buffers[dev]->getStream());
+                ref_ptrs[dev] = dsts.back();
             }
+            cuUtil::broadcastPeer(ref_data, src_device, cudaStream_t{0}, dsts,
+                                  dst_devices, dst_streams, length);
         }
-        for (std::size_t t = 0; t < threads.size(); t++) {
-            threads[t].join();
+
+        std::vector<DeviceExecutor::Task> tasks;
+        tasks.reserve(num_tasks);
+        for (std::size_t first = 0; first < obs.size(); first += task_size) {
+            const auto last = std::min(first + task_size, obs.size());
+            tasks.emplace_back([&, first, last](int device_id) {
+                PL_NVTX_RANGE("batchAdjointJacobian::task");
+                // The devices already run in parallel, so the OpenMP loops
+                // of the adjoint method do not spawn threads per device
+                omp_set_num_threads(1);
+                DevTag<int> dt_local(device_id, 0);
+                dt_local.refresh();
+
+                std::vector<std::vector<T>> jac_local(
+                    last - first, std::vector<T>(trainableParams.size(), 0));
+                adjointJacobian(ref_ptrs[device_id], length, jac_local,
+                                {obs.begin() + first, obs.begin() + last},
+                                ops, trainableParams, apply_operations,
+                                dt_local);
+                // Tasks write disjoint rows of the result
+                for (std::size_t j = 0; j < jac_local.size(); j++) {
+                    jac.at(first + j) = std::move(jac_local[j]);
+                }
+            });
         }
+        executor.run(std::move(tasks), devices,
+                     [&ref_buffers](int device_id) {
+                         ref_buffers[device_id].reset();
+                     });
     }
 
     /**
@@ -646,7 +983,11 @@ template <class T = double> class AdjointJacobianGPU {
      * number of parameters for the gradient calculation provided within
      * `num_params`. The resulting row-major ordered `jac` matrix representation
      * will be of size `trainableParams.size() * observables.size()`. OpenMP is
-     * used to enable independent operations to be offloaded to threads.
+     * used to enable independent operations to be offloaded to threads. The
+     * observable-applied copies are held in one contiguous device block, so
+     * each parameter's Jacobian column is computed by a single GEMV. If the
+     * block does not fit in the memory budget (see `setMemoryBudget`), the
+     * observables are processed in chunks reusing the same block.
      *
      * @param ref_data Pointer to the statevector data.
      * @param length Length of the statevector data.
@@ -669,84 +1010,227 @@ template <class T = double> class AdjointJacobianGPU {
         PL_ABORT_IF(trainableParams.empty(),
                     "No trainable parameters provided.");
 
-        const std::vector<std::string> &ops_name = ops.getOpsName();
         const size_t num_observables = obs.size();
-
         const size_t tp_size = trainableParams.size();
-        const size_t num_param_ops = ops.getNumParOps();
-
-        // Track positions within par and non-par operations
-        size_t trainableParamNumber = tp_size - 1;
-        size_t current_param_idx =
-            num_param_ops - 1; // total number of parametric ops
-        auto tp_it = trainableParams.rbegin();
-        const auto tp_rend = trainableParams.rend();
+        if (num_observables == 0) {
+            return;
+        }
 
         DevTag<int> dt_local(std::move(dev_tag));
         dt_local.refresh();
         // Create $U_{1:p}\vert \lambda \rangle$
         StateVectorCudaManaged<T> lambda(ref_data, length, dt_local);
 
+        // Gate names, wires and matrices are resolved once, and reused by
+        // every gate application of the passes below
+        const auto compiled = lambda.compileOperations(
+            ops.getOpsName(), ops.getOpsWires(), ops.getOpsInverses(),
+            ops.getOpsParams(), ops.getOpsMatrices());
+
         // Apply given operations to statevector if requested
-        if (apply_operations) {
+        if (apply_operations && fusion_max_width_ > 1) {
+            lambda.setFusionMaxWidth(
+                std::min(fusion_max_width_, lambda.getNumQubits()));
             applyOperations(lambda, ops);
+        } else if (apply_operations) {
+            lambda.applyCompiledOperations(compiled);
         }
 
-        // Create observable-applied state-vectors
-        std::vector<StateVectorCudaManaged<T>> H_lambda;
-        for (size_t n = 0; n < num_observables; n++) {
-            H_lambda.emplace_back(lambda.getNumQubits(), dt_local);
+        StateVectorCudaManaged<T> mu(lambda.getNumQubits(), dt_local);
+
+        // Overlaps are gathered on the device and read back once at the end.
+        // In mixed precision, they are accumulated in complex128.
+        const size_t num_overlaps = num_observables * tp_size;
+        std::unique_ptr<CUDA::DataBuffer<CFP_t>> jac_device;
+        std::unique_ptr<CUDA::DataBuffer<cuDoubleComplex>> jac_device_mixed;
+        if (std::is_same_v<CFP_t, cuComplex> && mixed_precision_) {
+            jac_device_mixed =
+                std::make_unique<CUDA::DataBuffer<cuDoubleComplex>>(
+                    num_overlaps, dt_local);
+            PL_CUDA_IS_SUCCESS(cudaMemsetAsync(
+                jac_device_mixed->getData(), 0,
+                sizeof(cuDoubleComplex) * num_overlaps,
+                dt_local.getStreamID()));
+        } else {
+            jac_device = std::make_unique<CUDA::DataBuffer<CFP_t>>(
+                num_overlaps, dt_local);
+            PL_CUDA_IS_SUCCESS(cudaMemsetAsync(jac_device->getData(), 0,
+                                               sizeof(CFP_t) * num_overlaps,
+                                               dt_local.getStreamID()));
         }
-        applyObservables(H_lambda, lambda, obs);
+        std::vector<T> scaling_coeffs(tp_size, 0);
 
-        StateVectorCudaManaged<T> mu(lambda.getNumQubits(), dt_local);
+        // Observables are processed in chunks sized to the memory budget. The
+        // backward pass reverts lambda, so later chunks restart from a copy.
+        const size_t chunk_size =
+            getObservableChunkSize(length, num_observables);
+        const size_t num_chunks =
+            (num_observables + chunk_size - 1) / chunk_size;
+        std::unique_ptr<StateVectorCudaManaged<T>> lambda_ref;
+        if (num_chunks > 1) {
+            lambda_ref = std::make_unique<StateVectorCudaManaged<T>>(lambda);
+        }
 
-        for (int op_idx = static_cast<int>(ops_name.size() - 1); op_idx >= 0;
-             op_idx--) {
-            PL_ABORT_IF(ops.getOpsParams()[op_idx].size() > 1,
-                        "The operation is not supported using the adjoint "
-                        "differentiation method");
-            if ((ops_name[op_idx] == "QubitStateVector") ||
-                (ops_name[op_idx] == "BasisState")) {
-                continue;
+        // Create observable-applied state-vectors as views over a single
+        // contiguous block, so overlaps can be computed with one GEMV call.
+        // The block is reused by every chunk.
+        CUDA::DataBuffer<CFP_t> H_lambda_block(chunk_size * length, dt_local);
+        std::unique_ptr<StreamPool> stream_pool;
+        if (use_stream_pool_) {
+            stream_pool = std::make_unique<StreamPool>(dt_local.getDeviceID(),
+                                                       chunk_size);
+        }
+        std::vector<StateVectorCudaManaged<T>> H_lambda;
+        H_lambda.reserve(chunk_size);
+        for (size_t n = 0; n < chunk_size; n++) {
+            const DevTag<int> dt_obs =
+                (stream_pool != nullptr)
+                    ? DevTag<int>{dt_local.getDeviceID(),
+                                  stream_pool->getStream(n)}
+                    : dt_local;
+            H_lambda.emplace_back(lambda.getNumQubits(),
+                                  H_lambda_block.getData() + n * length,
+                                  dt_obs);
+        }
+
+        for (size_t chunk = 0; chunk < num_chunks; chunk++) {
+            const size_t first = chunk * chunk_size;
+            const size_t last = std::min(first + chunk_size, num_observables);
+            while (H_lambda.size() > last - first) {
+                H_lambda.pop_back();
             }
-            if (tp_it == tp_rend) {
-                break; // All done
+            if (chunk > 0) {
+                lambda.updateData(*lambda_ref);
             }
-            mu.updateData(lambda);
-            applyOperationAdj(lambda, ops, op_idx);
+            if (stream_pool != nullptr) {
+                // Observable states are copied on their own streams, once the
+                // forward state is ready on the main stream
+                stream_pool->fork(lambda.getStream());
+                applyObservablesStreamed(
+                    H_lambda, lambda,
+                    {obs.begin() + first, obs.begin() + last});
+            } else {
+                applyObservables(H_lambda, lambda,
+                                 {obs.begin() + first, obs.begin() + last});
+            }
+            if (jac_device_mixed != nullptr) {
+                backwardPass(lambda, mu, H_lambda, H_lambda_block, ops,
+                             compiled, trainableParams, first, num_observables,
+                             *jac_device_mixed, scaling_coeffs,
+                             stream_pool.get());
+            } else {
+                backwardPass(lambda, mu, H_lambda, H_lambda_block, ops,
+                             compiled, trainableParams, first, num_observables,
+                             *jac_device, scaling_coeffs, stream_pool.get());
+            }
+        }
+        if (jac_device_mixed != nullptr) {
+            copyJacobianToHost(*jac_device_mixed, scaling_coeffs, jac);
+        } else {
+            copyJacobianToHost(*jac_device, scaling_coeffs, jac);
+        }
+    }
 
-            if (ops.hasParams(op_idx)) {
-                if (current_param_idx == *tp_it) {
-                    const T scalingFactor =
-                        applyGenerator(mu, ops.getOpsName()[op_idx],
-                                       ops.getOpsWires()[op_idx],
-                                       !ops.getOpsInverses()[op_idx]) *
-                        (ops.getOpsInverses()[op_idx] ? -1 : 1);
+    /**
+     * @brief Calculates the vector-Jacobian product `dy^T J` of the
+     * statevector for the selected set of parametric gates.
+     *
+     * Rather than one observable-applied state per observable, as in
+     * `adjointJacobian`, the observables are contracted with the cotangents
+     * on the device into the single state
+     * \f$\vert \phi \rangle = \sum_i dy_i O_i \vert \lambda \rangle\f$,
+     * so the backward pass holds three state-vectors whatever the number of
+     * observables, and each trainable parameter needs a single overlap.
+     *
+     * @param ref_data Pointer to the statevector data.
+     * @param length Length of the statevector data.
+     * @param vjp Receives the vector-Jacobian product, one entry per
+     * trainable parameter.
+     * @param cotangents Cotangent of each observable.
+     * @param obs Observables for which to calculate the Jacobian.
+     * @param ops Operations used to create given state.
+     * @param trainableParams List of parameters participating in Jacobian
+     * calculation.
+     * @param apply_operations Indicate whether to apply operations to psi prior
+     * to calculation.
+     */
+    void vectorJacobianProduct(
+        const CFP_t *ref_data, std::size_t length, std::vector<T> &vjp,
+        const std::vector<T> &cotangents,
+        const std::vector<Pennylane::Algorithms::ObsDatum<T>> &obs,
+        const Pennylane::Algorithms::OpsData<T> &ops,
+        const std::vector<size_t> &trainableParams,
+        bool apply_operations = false, CUDA::DevTag<int> dev_tag = {0, 0}) {
+        PL_ABORT_IF(trainableParams.empty(),
+                    "No trainable parameters provided.");
+        PL_ABORT_IF_NOT(cotangents.size() == obs.size(),
+                        "Number of cotangents must match the number of "
+                        "observables.");
 
-                    // clang-format off
+        const size_t tp_size = trainableParams.size();
+        vjp.assign(tp_size, 0);
+        if (std::all_of(cotangents.begin(), cotangents.end(),
+                        [](T dy) { return dy == 0; })) {
+            return;
+        }
 
-                    #if defined(_OPENMP)
-                        #pragma omp parallel for default(none)   \
-                        shared(H_lambda, jac, mu, scalingFactor, \
-                            trainableParamNumber, tp_it,         \
-                            num_observables)
-                    #endif
+        DevTag<int> dt_local(std::move(dev_tag));
+        dt_local.refresh();
+        StateVectorCudaManaged<T> lambda(ref_data, length, dt_local);
+        const auto compiled = lambda.compileOperations(
+            ops.getOpsName(), ops.getOpsWires(), ops.getOpsInverses(),
+            ops.getOpsParams(), ops.getOpsMatrices());
 
-                    // clang-format on
-                    for (size_t obs_idx = 0; obs_idx < num_observables;
-                         obs_idx++) {
-                        updateJacobian(H_lambda[obs_idx], mu, jac,
-                                       scalingFactor, obs_idx,
-                                       trainableParamNumber);
-                    }
-                    trainableParamNumber--;
-                    ++tp_it;
-                }
-                current_param_idx--;
+        if (apply_operations && fusion_max_width_ > 1) {
+            lambda.setFusionMaxWidth(
+                std::min(fusion_max_width_, lambda.getNumQubits()));
+            applyOperations(lambda, ops);
+        } else if (apply_operations) {
+            lambda.applyCompiledOperations(compiled);
+        }
+
+        StateVectorCudaManaged<T> mu(lambda.getNumQubits(), dt_local);
+
+        // Accumulate the cotangent-weighted observable states into phi, using
+        // mu as scratch
+        CUDA::DataBuffer<CFP_t> phi_block(length, dt_local);
+        PL_CUDA_IS_SUCCESS(cudaMemsetAsync(phi_block.getData(), 0,
+                                           sizeof(CFP_t) * length,
+                                           dt_local.getStreamID()));
+        std::vector<StateVectorCudaManaged<T>> phi;
+        phi.emplace_back(lambda.getNumQubits(), phi_block.getData(), dt_local);
+        for (size_t obs_idx = 0; obs_idx < obs.size(); obs_idx++) {
+            if (cotangents[obs_idx] == 0) {
+                continue;
             }
-            applyOperationsAdj(H_lambda, ops, static_cast<size_t>(op_idx));
+            mu.updateData(lambda);
+            applyObservable(mu, obs[obs_idx]);
+            cuUtil::scaleAndAddC_CUDA(
+                CFP_t{cotangents[obs_idx], 0}, mu.getData(),
+                phi_block.getData(), static_cast<int>(length),
+                dt_local.getDeviceID(), mu.getStream());
+        }
+
+        std::vector<T> scaling_coeffs(tp_size, 0);
+        std::vector<std::vector<T>> jac(1, std::vector<T>(tp_size, 0));
+        if (std::is_same_v<CFP_t, cuComplex> && mixed_precision_) {
+            CUDA::DataBuffer<cuDoubleComplex> jac_device(tp_size, dt_local);
+            PL_CUDA_IS_SUCCESS(cudaMemsetAsync(
+                jac_device.getData(), 0, sizeof(cuDoubleComplex) * tp_size,
+                dt_local.getStreamID()));
+            backwardPass(lambda, mu, phi, phi_block, ops, compiled,
+                         trainableParams, 0, 1, jac_device, scaling_coeffs);
+            copyJacobianToHost(jac_device, scaling_coeffs, jac);
+        } else {
+            CUDA::DataBuffer<CFP_t> jac_device(tp_size, dt_local);
+            PL_CUDA_IS_SUCCESS(cudaMemsetAsync(jac_device.getData(), 0,
+                                               sizeof(CFP_t) * tp_size,
+                                               dt_local.getStreamID()));
+            backwardPass(lambda, mu, phi, phi_block, ops, compiled,
+                         trainableParams, 0, 1, jac_device, scaling_coeffs);
+            copyJacobianToHost(jac_device, scaling_coeffs, jac);
         }
+        vjp = std::move(jac[0]);
     }
 };
 
@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cstdint>
 #include <set>
 #include <tuple>
 #include <variant>
@@ -23,9 +24,12 @@
 #include "AdjointDiffGPU.hpp"
 #include "JacobianTape.hpp"
 
+#include "DLPack.hpp"
 #include "DevTag.hpp"
+#include "DeviceMemoryPool.hpp"
 #include "DevicePool.hpp"
 #include "Error.hpp"
+#include "StateVectorCudaBatched.hpp"
 #include "StateVectorCudaManaged.hpp"
 #include "StateVectorManagedCPU.hpp"
 #include "StateVectorRawCPU.hpp"
@@ -50,6 +54,110 @@ using std::vector;
 
 namespace py = pybind11;
 
+/**
+ * @brief Get the CUDA stream of a handle passed through the
+ * `__cuda_array_interface__` or `__dlpack__` protocols, which reserve 1 and 2
+ * for the legacy and per-thread default streams.
+ */
+auto streamFromProtocol(std::uintptr_t stream) -> cudaStream_t {
+    switch (stream) {
+    case 1:
+        return cudaStreamLegacy;
+    case 2:
+        return cudaStreamPerThread;
+    default:
+        return reinterpret_cast<cudaStream_t>(stream);
+    }
+}
+
+/**
+ * @brief Get the protocol handle of a CUDA stream. The null stream of the
+ * default device tags is the legacy default stream.
+ */
+auto streamToProtocol(cudaStream_t stream) -> std::uintptr_t {
+    return (stream == nullptr) ? 1 : reinterpret_cast<std::uintptr_t>(stream);
+}
+
+/**
+ * @brief Order the work later submitted to `consumer` after the work already
+ * submitted to `producer`, without blocking the host.
+ */
+void orderStreams(cudaStream_t producer, cudaStream_t consumer,
+                  int device_id) {
+    if (producer == consumer) {
+        return;
+    }
+    CudaScopedDevice scoped_device(device_id);
+    cudaEvent_t event;
+    PL_CUDA_IS_SUCCESS(
+        cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    PL_CUDA_IS_SUCCESS(cudaEventRecord(event, producer));
+    PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(consumer, event, 0));
+    // The wait is enqueued, the event can be released
+    PL_CUDA_IS_SUCCESS(cudaEventDestroy(event));
+}
+
+/**
+ * @brief Check that external device memory can hold a state-vector of
+ * `length` amplitudes on `device_id`.
+ */
+void checkDeviceData(const void *gpu_data, std::size_t length,
+                     int device_id) {
+    PL_ABORT_IF_NOT(length > 0 && (length & (length - 1)) == 0,
+                    "The array size must be a power of 2");
+    cudaPointerAttributes attributes;
+    PL_CUDA_IS_SUCCESS(cudaPointerGetAttributes(&attributes, gpu_data));
+    PL_ABORT_IF_NOT((attributes.type == cudaMemoryTypeDevice ||
+                     attributes.type == cudaMemoryTypeManaged) &&
+                        attributes.device == device_id,
+                    "The array is not in the memory of the tag's device");
+}
+
+/**
+ * @brief Export device memory as a DLPack capsule of a 1D complex tensor. The
+ * capsule holds a reference to `owner` until the consumer releases the tensor.
+ *
+ * @tparam PrecisionT Floating point precision of the complex data.
+ * @param data Device pointer.
+ * @param length Number of complex elements.
+ * @param device_id Device holding `data`.
+ * @param owner Python object owning the memory.
+ */
+template <class PrecisionT>
+auto createDLPackCapsule(void *data, std::size_t length, int device_id,
+                         py::object owner) -> py::capsule {
+    struct Context {
+        py::object owner;
+        int64_t shape;
+        DLPack::DLManagedTensor tensor;
+    };
+    auto *context =
+        new Context{std::move(owner), static_cast<int64_t>(length), {}};
+    auto &tensor = context->tensor;
+    tensor.dl_tensor.data = data;
+    tensor.dl_tensor.device = {DLPack::kDLCUDA, device_id};
+    tensor.dl_tensor.ndim = 1;
+    tensor.dl_tensor.dtype = {
+        DLPack::kDLComplex,
+        static_cast<uint8_t>(8 * sizeof(std::complex<PrecisionT>)), 1};
+    tensor.dl_tensor.shape = &context->shape;
+    tensor.dl_tensor.strides = nullptr; // Compact
+    tensor.dl_tensor.byte_offset = 0;
+    tensor.manager_ctx = context;
+    tensor.deleter = [](DLPack::DLManagedTensor *self) {
+        py::gil_scoped_acquire gil;
+        delete static_cast<Context *>(self->manager_ctx);
+    };
+    return py::capsule(&tensor, DLPack::capsule_name, [](PyObject *capsule) {
+        // Consumers rename the capsules they take, release the others
+        if (PyCapsule_IsValid(capsule, DLPack::capsule_name)) {
+            auto *unused = static_cast<DLPack::DLManagedTensor *>(
+                PyCapsule_GetPointer(capsule, DLPack::capsule_name));
+            unused->deleter(unused);
+        }
+    });
+}
+
 /**
  * @brief Templated class to build all required precisions for Python module.
  *
@@ -63,12 +171,19 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
         py::array_t<ParamT, py::array::c_style | py::array::forcecast>;
     using np_arr_c = py::array_t<std::complex<ParamT>,
                                  py::array::c_style | py::array::forcecast>;
+    using CFP_t = typename StateVectorCudaManaged<PrecisionT>::CFP_t;
+    const std::string typestr =
+        "<c" + std::to_string(sizeof(std::complex<PrecisionT>));
 
     // Enable module name to be based on size of complex datatype
     const std::string bitsize =
         std::to_string(sizeof(std::complex<PrecisionT>) * 8);
     std::string class_name = "LightningGPU_C" + bitsize;
 
+    // GPU-bound calls release the GIL, so that threads driving other devices
+    // or streams are not serialized behind them
+    using release_gil = py::call_guard<py::gil_scoped_release>;
+
     py::class_<StateVectorCudaManaged<PrecisionT>>(m, class_name.c_str())
         .def(py::init<std::size_t>())              // qubits, device
         .def(py::init<std::size_t, DevTag<int>>()) // qubits, dev-tag
@@ -82,6 +197,120 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
             return new StateVectorCudaManaged<PrecisionT>(
                 data_ptr, static_cast<std::size_t>(arr.size()));
         }))
+        .def(py::init([](const np_arr_c &arr, const DevTag<int> &dev_tag) {
+            py::buffer_info numpyArrayInfo = arr.request();
+            const auto *data_ptr =
+                static_cast<const std::complex<PrecisionT> *>(
+                    numpyArrayInfo.ptr);
+            return new StateVectorCudaManaged<PrecisionT>(
+                data_ptr, static_cast<std::size_t>(arr.size()), dev_tag);
+        }))
+        .def(py::init([](std::uintptr_t gpu_data, std::size_t length,
+                         const DevTag<int> &dev_tag) {
+                 auto *data = reinterpret_cast<CFP_t *>(gpu_data);
+                 checkDeviceData(data, length, dev_tag.getDeviceID());
+                 return new StateVectorCudaManaged<PrecisionT>(
+                     Util::log2(length), data, dev_tag);
+             }),
+             py::arg("gpu_data"), py::arg("length"), py::arg("dev_tag"),
+             "Wrap existing device memory of `length` amplitudes without "
+             "copying. The memory must outlive the state-vector.")
+        .def_static(
+            "fromDeviceArray",
+            [typestr](const py::object &array, const DevTag<int> &dev_tag) {
+                PL_ABORT_IF_NOT(
+                    py::hasattr(array, "__cuda_array_interface__"),
+                    "The array does not implement __cuda_array_interface__");
+                const auto cai = array.attr("__cuda_array_interface__")
+                                     .cast<py::dict>();
+                PL_ABORT_IF_NOT(cai["typestr"].cast<std::string>() == typestr,
+                                "The array data type does not match the "
+                                "state-vector precision");
+                const auto shape = cai["shape"].cast<std::vector<size_t>>();
+                size_t length = 1;
+                for (const auto dim : shape) {
+                    length *= dim;
+                }
+                if (cai.contains("strides") && !cai["strides"].is_none()) {
+                    const auto strides =
+                        cai["strides"].cast<std::vector<size_t>>();
+                    size_t stride = sizeof(std::complex<PrecisionT>);
+                    for (size_t dim = shape.size(); dim-- > 0;) {
+                        PL_ABORT_IF_NOT(shape[dim] == 1 ||
+                                            strides[dim] == stride,
+                                        "The array must be C-contiguous");
+                        stride *= shape[dim];
+                    }
+                }
+                const auto data = cai["data"].cast<py::tuple>();
+                PL_ABORT_IF(data[1].cast<bool>(), "The array is read-only");
+                auto *gpu_data =
+                    reinterpret_cast<CFP_t *>(data[0].cast<std::uintptr_t>());
+                checkDeviceData(gpu_data, length, dev_tag.getDeviceID());
+
+                auto sv = std::make_unique<StateVectorCudaManaged<PrecisionT>>(
+                    Util::log2(length), gpu_data, dev_tag);
+                if (cai.contains("stream") && !cai["stream"].is_none()) {
+                    const auto producer = streamFromProtocol(
+                        cai["stream"].cast<std::uintptr_t>());
+                    orderStreams(producer, sv->getStream(),
+                                 dev_tag.getDeviceID());
+                }
+                return sv;
+            },
+            py::arg("array"), py::arg("dev_tag") = DevTag<int>{0, 0},
+            py::keep_alive<0, 1>(),
+            "Wrap the device memory of an object implementing "
+            "__cuda_array_interface__, such as CuPy arrays and PyTorch CUDA "
+            "tensors, without copying. The object is kept alive with the "
+            "state-vector.")
+        .def_property_readonly(
+            "__cuda_array_interface__",
+            [typestr](const StateVectorCudaManaged<PrecisionT> &sv) {
+                py::dict cai;
+                cai["shape"] = py::make_tuple(sv.getLength());
+                cai["typestr"] = typestr;
+                cai["data"] = py::make_tuple(
+                    reinterpret_cast<std::uintptr_t>(sv.getData()), false);
+                cai["strides"] = py::none();
+                cai["stream"] = streamToProtocol(sv.getStream());
+                cai["version"] = 3;
+                return cai;
+            },
+            "Expose the device data to CuPy, Numba or PyTorch without a "
+            "copy.")
+        .def(
+            "__dlpack__",
+            [](const py::object &self, const py::object &stream) {
+                auto &sv = self.cast<StateVectorCudaManaged<PrecisionT> &>();
+                const auto device_id = sv.getDataBuffer().getDevice();
+                // None stands for the legacy default stream, -1 for no
+                // synchronization
+                if (stream.is_none()) {
+                    orderStreams(sv.getStream(), cudaStreamLegacy, device_id);
+                } else if (stream.cast<int64_t>() != -1) {
+                    orderStreams(
+                        sv.getStream(),
+                        streamFromProtocol(stream.cast<std::uintptr_t>()),
+                        device_id);
+                }
+                return createDLPackCapsule<PrecisionT>(
+                    sv.getData(), sv.getLength(), device_id, self);
+            },
+            py::arg("stream") = py::none(),
+            "Export the device data as a DLPack capsule, ordered before the "
+            "work of the consumer on `stream`.")
+        .def(
+            "__dlpack_device__",
+            [](const StateVectorCudaManaged<PrecisionT> &sv) {
+                return py::make_tuple(
+                    static_cast<int>(DLPack::kDLCUDA),
+                    sv.getDataBuffer().getDevice());
+            })
+        .def("markModified",
+             &StateVectorCudaManaged<PrecisionT>::markModified,
+             "Record a modification of the device data made through "
+             "__cuda_array_interface__ or __dlpack__.")
         .def(
             "Identity",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -89,7 +318,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyIdentity(wires, adjoint);
             },
-            "Apply the Identity gate.")
+            "Apply the Identity gate.", release_gil())
 
         .def(
             "PauliX",
@@ -98,7 +327,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyPauliX(wires, adjoint);
             },
-            "Apply the PauliX gate.")
+            "Apply the PauliX gate.", release_gil())
 
         .def(
             "PauliY",
@@ -107,7 +336,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyPauliY(wires, adjoint);
             },
-            "Apply the PauliY gate.")
+            "Apply the PauliY gate.", release_gil())
 
         .def(
             "PauliZ",
@@ -116,7 +345,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyPauliZ(wires, adjoint);
             },
-            "Apply the PauliZ gate.")
+            "Apply the PauliZ gate.", release_gil())
 
         .def(
             "Hadamard",
@@ -125,7 +354,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyHadamard(wires, adjoint);
             },
-            "Apply the Hadamard gate.")
+            "Apply the Hadamard gate.", release_gil())
 
         .def(
             "S",
@@ -134,7 +363,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyS(wires, adjoint);
             },
-            "Apply the S gate.")
+            "Apply the S gate.", release_gil())
 
         .def(
             "T",
@@ -143,7 +372,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyT(wires, adjoint);
             },
-            "Apply the T gate.")
+            "Apply the T gate.", release_gil())
 
         .def(
             "CNOT",
@@ -152,7 +381,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyCNOT(wires, adjoint);
             },
-            "Apply the CNOT gate.")
+            "Apply the CNOT gate.", release_gil())
 
         .def(
             "SWAP",
@@ -161,7 +390,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applySWAP(wires, adjoint);
             },
-            "Apply the SWAP gate.")
+            "Apply the SWAP gate.", release_gil())
 
         .def(
             "CSWAP",
@@ -170,7 +399,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyCSWAP(wires, adjoint);
             },
-            "Apply the CSWAP gate.")
+            "Apply the CSWAP gate.", release_gil())
 
         .def(
             "Toffoli",
@@ -179,7 +408,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyToffoli(wires, adjoint);
             },
-            "Apply the Toffoli gate.")
+            "Apply the Toffoli gate.", release_gil())
 
         .def(
             "CZ",
@@ -188,7 +417,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                [[maybe_unused]] const std::vector<ParamT> &params) {
                 return sv.applyCZ(wires, adjoint);
             },
-            "Apply the CZ gate.")
+            "Apply the CZ gate.", release_gil())
 
         .def(
             "PhaseShift",
@@ -197,24 +426,56 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyPhaseShift(wires, adjoint, params.front());
             },
-            "Apply the PhaseShift gate.")
+            "Apply the PhaseShift gate.", release_gil())
 
         .def("apply",
              py::overload_cast<
                  const vector<string> &, const vector<vector<std::size_t>> &,
                  const vector<bool> &, const vector<vector<PrecisionT>> &>(
-                 &StateVectorCudaManaged<PrecisionT>::applyOperation))
+                 &StateVectorCudaManaged<PrecisionT>::applyOperation),
+             release_gil())
 
         .def("apply", py::overload_cast<const vector<string> &,
                                         const vector<vector<std::size_t>> &,
                                         const vector<bool> &>(
-                          &StateVectorCudaManaged<PrecisionT>::applyOperation))
+                          &StateVectorCudaManaged<PrecisionT>::applyOperation),
+             release_gil())
 
         .def("apply",
              py::overload_cast<const std::string &, const vector<size_t> &,
                                bool, const vector<PrecisionT> &,
                                const std::vector<std::complex<PrecisionT>> &>(
-                 &StateVectorCudaManaged<PrecisionT>::applyOperation_std))
+                 &StateVectorCudaManaged<PrecisionT>::applyOperation_std),
+             release_gil())
+
+        .def(
+            "compile",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const OpsData<PrecisionT> &ops) {
+                return sv.compileOperations(
+                    ops.getOpsName(), ops.getOpsWires(), ops.getOpsInverses(),
+                    ops.getOpsParams(), ops.getOpsMatrices());
+            },
+            "Compile an operations list for replay on state-vectors of the "
+            "same size and device.")
+        .def("apply_compiled",
+             &StateVectorCudaManaged<PrecisionT>::applyCompiledOperations,
+             py::arg("ops"), py::arg("adjoint") = false, release_gil(),
+             "Apply a compiled operations list, or its adjoint.")
+        .def("setUseGraphs",
+             &StateVectorCudaManaged<PrecisionT>::setUseGraphs,
+             "Replay compiled operations lists through captured CUDA graphs.")
+        .def("getUseGraphs",
+             &StateVectorCudaManaged<PrecisionT>::getUseGraphs)
+        .def(
+            "graphStats",
+            [](const StateVectorCudaManaged<PrecisionT> &sv) {
+                py::dict stats;
+                stats["captures"] = sv.getNumGraphCaptures();
+                stats["launches"] = sv.getNumGraphLaunches();
+                return stats;
+            },
+            "Get the capture and launch counters of the CUDA graphs.")
 
         .def(
             "ControlledPhaseShift",
@@ -224,7 +485,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                 return sv.applyControlledPhaseShift(wires, adjoint,
                                                     params.front());
             },
-            "Apply the ControlledPhaseShift gate.")
+            "Apply the ControlledPhaseShift gate.", release_gil())
 
         .def(
             "RX",
@@ -233,7 +494,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyRX(wires, adjoint, params.front());
             },
-            "Apply the RX gate.")
+            "Apply the RX gate.", release_gil())
 
         .def(
             "RY",
@@ -242,7 +503,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyRY(wires, adjoint, params.front());
             },
-            "Apply the RY gate.")
+            "Apply the RY gate.", release_gil())
 
         .def(
             "RZ",
@@ -251,7 +512,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyRZ(wires, adjoint, params.front());
             },
-            "Apply the RZ gate.")
+            "Apply the RZ gate.", release_gil())
 
         .def(
             "Rot",
@@ -260,7 +521,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyRot(wires, adjoint, params);
             },
-            "Apply the Rot gate.")
+            "Apply the Rot gate.", release_gil())
 
         .def(
             "CRX",
@@ -269,7 +530,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyCRX(wires, adjoint, params.front());
             },
-            "Apply the CRX gate.")
+            "Apply the CRX gate.", release_gil())
 
         .def(
             "CRY",
@@ -278,7 +539,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyCRY(wires, adjoint, params.front());
             },
-            "Apply the CRY gate.")
+            "Apply the CRY gate.", release_gil())
 
         .def(
             "CRZ",
@@ -287,7 +548,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyCRZ(wires, adjoint, params.front());
             },
-            "Apply the CRZ gate.")
+            "Apply the CRZ gate.", release_gil())
 
         .def(
             "CRot",
@@ -296,7 +557,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyCRot(wires, adjoint, params);
             },
-            "Apply the CRot gate.")
+            "Apply the CRot gate.", release_gil())
         .def(
             "IsingXX",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -304,7 +565,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyIsingXX(wires, adjoint, params.front());
             },
-            "Apply the IsingXX gate.")
+            "Apply the IsingXX gate.", release_gil())
         .def(
             "IsingYY",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -312,7 +573,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyIsingYY(wires, adjoint, params.front());
             },
-            "Apply the IsingYY gate.")
+            "Apply the IsingYY gate.", release_gil())
         .def(
             "IsingZZ",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -320,7 +581,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyIsingZZ(wires, adjoint, params.front());
             },
-            "Apply the IsingZZ gate.")
+            "Apply the IsingZZ gate.", release_gil())
         .def(
             "SingleExcitation",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -328,7 +589,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applySingleExcitation(wires, adjoint, params.front());
             },
-            "Apply the SingleExcitation gate.")
+            "Apply the SingleExcitation gate.", release_gil())
         .def(
             "SingleExcitationMinus",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -337,7 +598,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                 return sv.applySingleExcitationMinus(wires, adjoint,
                                                      params.front());
             },
-            "Apply the SingleExcitationMinus gate.")
+            "Apply the SingleExcitationMinus gate.", release_gil())
         .def(
             "SingleExcitationPlus",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -346,7 +607,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                 return sv.applySingleExcitationPlus(wires, adjoint,
                                                     params.front());
             },
-            "Apply the SingleExcitationPlus gate.")
+            "Apply the SingleExcitationPlus gate.", release_gil())
         .def(
             "DoubleExcitation",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -354,7 +615,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyDoubleExcitation(wires, adjoint, params.front());
             },
-            "Apply the DoubleExcitation gate.")
+            "Apply the DoubleExcitation gate.", release_gil())
         .def(
             "DoubleExcitationMinus",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -363,7 +624,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                 return sv.applyDoubleExcitationMinus(wires, adjoint,
                                                      params.front());
             },
-            "Apply the DoubleExcitationMinus gate.")
+            "Apply the DoubleExcitationMinus gate.", release_gil())
         .def(
             "DoubleExcitationPlus",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -372,7 +633,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                 return sv.applyDoubleExcitationPlus(wires, adjoint,
                                                     params.front());
             },
-            "Apply the DoubleExcitationPlus gate.")
+            "Apply the DoubleExcitationPlus gate.", release_gil())
         .def(
             "MultiRZ",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -380,7 +641,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                const std::vector<ParamT> &params) {
                 return sv.applyMultiRZ(wires, adjoint, params.front());
             },
-            "Apply the MultiRZ gate.")
+            "Apply the MultiRZ gate.", release_gil())
         .def(
             "ExpectationValue",
             [](StateVectorCudaManaged<PrecisionT> &sv,
@@ -396,6 +657,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                     conv_matrix = std::vector<std::complex<ParamT>>{
                         m_ptr, m_ptr + m_buffer.size};
                 }
+                py::gil_scoped_release release;
                 // Return the real component only
                 return sv.expval(obsName, wires, params, conv_matrix).x;
             },
@@ -421,6 +683,7 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                     conv_matrix = std::vector<std::complex<ParamT>>{
                         m_ptr, m_ptr + m_buffer.size};
                 }
+                py::gil_scoped_release release;
                 // Return the real component only & ignore params
                 return sv
                     .expval(obs_concat, wires, std::vector<ParamT>{},
@@ -428,18 +691,96 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                     .x;
             },
             "Calculate the expectation value of the given observable.")
+        .def(
+            "ExpectationValueAndVariance",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const std::vector<std::string> &obsName,
+               const std::vector<std::size_t> &wires,
+               const np_arr_c &gate_matrix) {
+                // Shares the cache entry of the ExpectationValue overload
+                // taking a list of observable names
+                std::string obs_concat{"#"};
+                for (const auto &sub : obsName) {
+                    obs_concat += sub;
+                }
+                const auto m_buffer = gate_matrix.request();
+                std::vector<std::complex<ParamT>> conv_matrix;
+                if (m_buffer.size) {
+                    const auto m_ptr =
+                        static_cast<const std::complex<ParamT> *>(m_buffer.ptr);
+                    conv_matrix = std::vector<std::complex<ParamT>>{
+                        m_ptr, m_ptr + m_buffer.size};
+                }
+                py::gil_scoped_release release;
+                return sv.expvalAndVar(obs_concat, wires,
+                                       std::vector<ParamT>{}, conv_matrix);
+            },
+            "Calculate the expectation value and variance of the given "
+            "observable in a single pass over the state-vector.")
+        .def(
+            "ExpectationValueHamiltonian",
+            [](StateVectorCudaManaged<PrecisionT> &sv, const np_arr_r &coeffs,
+               const std::vector<std::vector<std::string>> &pauli_words,
+               const std::vector<std::vector<std::size_t>> &wires) {
+                const auto c_buffer = coeffs.request();
+                const auto c_ptr = static_cast<const ParamT *>(c_buffer.ptr);
+                const std::vector<PrecisionT> conv_coeffs{
+                    c_ptr, c_ptr + c_buffer.size};
+                py::gil_scoped_release release;
+                return sv.expvalHamiltonian(conv_coeffs, pauli_words, wires);
+            },
+            "Calculate the expectation value of a linear combination of Pauli "
+            "words, with all words evaluated in one batched call.")
+        .def(
+            "ExpectationValueSparse",
+            [](StateVectorCudaManaged<PrecisionT> &sv,
+               const py::array_t<int64_t, py::array::c_style |
+                                              py::array::forcecast> &indptr,
+               const py::array_t<int64_t, py::array::c_style |
+                                              py::array::forcecast> &indices,
+               const np_arr_c &data) {
+                const auto p_buffer = indptr.request();
+                const auto i_buffer = indices.request();
+                const auto d_buffer = data.request();
+                const auto p_ptr = static_cast<const int64_t *>(p_buffer.ptr);
+                const auto i_ptr = static_cast<const int64_t *>(i_buffer.ptr);
+                const auto d_ptr =
+                    static_cast<const std::complex<ParamT> *>(d_buffer.ptr);
+                py::gil_scoped_release release;
+                return sv.expvalSparseHamiltonian(
+                    std::vector<int64_t>{p_ptr, p_ptr + p_buffer.size},
+                    std::vector<int64_t>{i_ptr, i_ptr + i_buffer.size},
+                    std::vector<std::complex<PrecisionT>>{
+                        d_ptr, d_ptr + d_buffer.size});
+            },
+            "Calculate the expectation value of a Hamiltonian given as a CSR "
+            "sparse matrix over all wires.")
         .def(
             "Probability",
             [](StateVectorCudaManaged<PrecisionT> &sv,
-               const std::vector<std::size_t> &wires) {
-                return py::array_t<ParamT>(py::cast(sv.probability(wires)));
+               const std::vector<std::size_t> &wires,
+               const std::vector<std::size_t> &mask_wires,
+               const std::vector<int> &mask_bits) {
+                std::vector<double> probs;
+                {
+                    py::gil_scoped_release release;
+                    probs = sv.probability(wires, mask_wires, mask_bits);
+                }
+                return py::array_t<ParamT>(py::cast(probs));
             },
-            "Calculate the probabilities for given wires. Results returned in "
-            "Col-major order.")
+            py::arg("wires"), py::arg("mask_wires") = std::vector<size_t>{},
+            py::arg("mask_bits") = std::vector<int>{},
+            "Calculate the probabilities for given wires, in PennyLane order. "
+            "Only basis states where `mask_wires` equal `mask_bits` "
+            "contribute.")
         .def("GenerateSamples",
              [](StateVectorCudaManaged<PrecisionT> &sv, size_t num_wires,
                 size_t num_shots) {
-                 auto &&result = sv.generate_samples(num_shots);
+                 std::vector<size_t> result;
+                 {
+                     py::gil_scoped_release release;
+                     result = sv.generate_samples(num_shots);
+                 }
                  const size_t ndim = 2;
                  const std::vector<size_t> shape{num_shots, num_wires};
                  constexpr auto sz = sizeof(size_t);
@@ -454,18 +795,63 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                      strides /* strides for each axis     */
                      ));
              })
+        .def(
+            "GenerateSamplesBits",
+            [](StateVectorCudaManaged<PrecisionT> &sv, size_t num_wires,
+               size_t num_shots) {
+                std::vector<uint8_t> result;
+                {
+                    py::gil_scoped_release release;
+                    result = sv.generate_samples_bits(num_shots);
+                }
+                return py::array_t<uint8_t>({num_shots, num_wires},
+                                            result.data());
+            },
+            "Generate samples on the device, returned as a (shots, wires) "
+            "array of uint8 bits.")
+        .def(
+            "GenerateSamplesPacked",
+            [](StateVectorCudaManaged<PrecisionT> &sv, size_t num_shots) {
+                std::vector<uint64_t> result;
+                {
+                    py::gil_scoped_release release;
+                    result = sv.generate_samples_packed(num_shots);
+                }
+                return py::array_t<uint64_t>(result.size(), result.data());
+            },
+            "Generate samples on the device, returned as one basis state "
+            "index per shot with wire 0 as the most significant bit.")
+        .def(
+            "GenerateCounts",
+            [](StateVectorCudaManaged<PrecisionT> &sv, size_t num_shots) {
+                std::pair<std::vector<uint64_t>, std::vector<uint64_t>> result;
+                {
+                    py::gil_scoped_release release;
+                    result = sv.generate_counts(num_shots);
+                }
+                const auto &[indices, counts] = result;
+                return py::make_tuple(
+                    py::array_t<uint64_t>(indices.size(), indices.data()),
+                    py::array_t<uint64_t>(counts.size(), counts.data()));
+            },
+            "Generate samples on the device, and return the sampled basis "
+            "state indices with their counts.")
+        .def("SetSeed", &StateVectorCudaManaged<PrecisionT>::setSeed,
+             release_gil(),
+             "Seed the device random number generator used for sampling.")
         .def("DeviceToDevice", &StateVectorCudaManaged<PrecisionT>::updateData,
+             release_gil(),
              "Synchronize data from another GPU device to current device.")
         .def("DeviceToHost",
              py::overload_cast<StateVectorManagedCPU<PrecisionT> &, bool>(
                  &StateVectorCudaManaged<PrecisionT>::CopyGpuDataToHost,
                  py::const_),
-             "Synchronize data from the GPU device to host.")
+             release_gil(), "Synchronize data from the GPU device to host.")
         .def("DeviceToHost",
              py::overload_cast<std::complex<PrecisionT> *, size_t, bool>(
                  &StateVectorCudaManaged<PrecisionT>::CopyGpuDataToHost,
                  py::const_),
-             "Synchronize data from the GPU device to host.")
+             release_gil(), "Synchronize data from the GPU device to host.")
         .def(
             "DeviceToHost",
             [](const StateVectorCudaManaged<PrecisionT> &gpu_sv,
@@ -473,20 +859,48 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                 py::buffer_info numpyArrayInfo = cpu_sv.request();
                 auto *data_ptr =
                     static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
-                if (cpu_sv.size()) {
-                    gpu_sv.CopyGpuDataToHost(data_ptr, cpu_sv.size());
+                const auto length = static_cast<size_t>(cpu_sv.size());
+                if (length) {
+                    py::gil_scoped_release release;
+                    gpu_sv.CopyGpuDataToHost(data_ptr, length);
                 }
             },
             "Synchronize data from the GPU device to host.")
+        .def(
+            "DeviceToHostAsync",
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv) {
+                gpu_sv.CopyGpuDataToHostMirror();
+            },
+            release_gil(),
+            "Start copying data from the GPU device into the pinned host "
+            "mirror, without waiting for the transfer.")
+        .def(
+            "HostMirrorToHost",
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv, np_arr_c &cpu_sv) {
+                py::buffer_info numpyArrayInfo = cpu_sv.request();
+                auto *data_ptr =
+                    static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
+                const auto length = static_cast<size_t>(cpu_sv.size());
+                if (length) {
+                    py::gil_scoped_release release;
+                    gpu_sv.CopyHostMirrorToHost(data_ptr, length);
+                }
+            },
+            "Wait for the transfer into the pinned host mirror, and copy the "
+            "mirror to host.")
+        .def("IsHostMirrorReady",
+             &StateVectorCudaManaged<PrecisionT>::isHostMirrorReady,
+             "Check whether the last transfer through the pinned host mirror "
+             "has finished.")
         .def("HostToDevice",
              py::overload_cast<const std::complex<PrecisionT> *, size_t, bool>(
                  &StateVectorCudaManaged<PrecisionT>::CopyHostDataToGpu),
-             "Synchronize data from the host device to GPU.")
+             release_gil(), "Synchronize data from the host device to GPU.")
         .def("HostToDevice",
              py::overload_cast<const std::vector<std::complex<PrecisionT>> &,
                                bool>(
                  &StateVectorCudaManaged<PrecisionT>::CopyHostDataToGpu),
-             "Synchronize data from the host device to GPU.")
+             release_gil(), "Synchronize data from the host device to GPU.")
         .def(
             "HostToDevice",
             [](StateVectorCudaManaged<PrecisionT> &gpu_sv,
@@ -496,17 +910,126 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                     static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
                 const auto length =
                     static_cast<size_t>(numpyArrayInfo.shape[0]);
-                if (length) {
-                    gpu_sv.CopyHostDataToGpu(data_ptr, length, async);
+                if (length == 0) {
+                    return;
+                }
+                py::gil_scoped_release release;
+                if (async) {
+                    // Stage through pinned memory for a truly async upload
+                    gpu_sv.CopyHostDataToGpuStaged(data_ptr, length);
+                } else {
+                    gpu_sv.CopyHostDataToGpu(data_ptr, length, false);
                 }
             },
             "Synchronize data from the host device to GPU.")
         .def("GetNumGPUs", &getGPUCount, "Get the number of available GPUs.")
         .def("getCurrentGPU", &getGPUIdx,
              "Get the GPU index for the statevector data.")
+        .def("getDataVersion",
+             &StateVectorCudaManaged<PrecisionT>::getDataVersion,
+             "Get the modification count of the GPU data, incremented by "
+             "every gate application and copy into the state-vector.")
         .def("numQubits", &StateVectorCudaManaged<PrecisionT>::getNumQubits)
         .def("dataLength", &StateVectorCudaManaged<PrecisionT>::getLength)
-        .def("resetGPU", &StateVectorCudaManaged<PrecisionT>::initSV);
+        .def("setFusionMaxWidth",
+             &StateVectorCudaManaged<PrecisionT>::setFusionMaxWidth,
+             "Fuse runs of gates acting on at most this many wires into a "
+             "single dense matrix. 0 or 1 disables fusion.")
+        .def("getFusionMaxWidth",
+             &StateVectorCudaManaged<PrecisionT>::getFusionMaxWidth)
+        .def("setMixedPrecision",
+             &StateVectorCudaManaged<PrecisionT>::setMixedPrecision,
+             "Accumulate the reductions of a single-precision state-vector in "
+             "double precision.")
+        .def("getMixedPrecision",
+             &StateVectorCudaManaged<PrecisionT>::getMixedPrecision)
+        .def("setGateCacheCapacity",
+             &StateVectorCudaManaged<PrecisionT>::setGateCacheCapacity,
+             "Bound the gate cache to the given number of bytes of device "
+             "memory, evicting the least recently used gates. 0 removes the "
+             "bound.")
+        .def(
+            "gateCacheStats",
+            [](const StateVectorCudaManaged<PrecisionT> &sv) {
+                const auto &cache = sv.getGateCache();
+                py::dict stats;
+                stats["hits"] = cache.getHits();
+                stats["misses"] = cache.getMisses();
+                stats["evictions"] = cache.getEvictions();
+                stats["used_bytes"] = cache.getUsedBytes();
+                stats["alloc_bytes"] = cache.getTotalAllocBytes();
+                return stats;
+            },
+            "Get the hit, miss, eviction and memory counters of the gate "
+            "cache.")
+        .def("resetGPU", &StateVectorCudaManaged<PrecisionT>::initSV,
+             release_gil())
+        .def(
+            "setBasisState",
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv, size_t index) {
+                gpu_sv.setBasisState(index);
+            },
+            release_gil(),
+            "Set the state-vector to a computational basis state on the "
+            "device.")
+        .def(
+            "setStateVector",
+            [](StateVectorCudaManaged<PrecisionT> &gpu_sv,
+               const np_arr_c &values, const std::vector<size_t> &wires) {
+                const py::buffer_info numpyArrayInfo = values.request();
+                const auto *data_ptr =
+                    static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
+                const auto length = static_cast<size_t>(values.size());
+                py::gil_scoped_release release;
+                gpu_sv.setStateVector(data_ptr, length, wires);
+            },
+            "Set the state-vector to the given amplitudes of a subset of the "
+            "wires, with all other wires in |0>.");
+
+    //***********************************************************************//
+    //                           Batched state-vectors
+    //***********************************************************************//
+
+    class_name = "LightningGPUBatched_C" + bitsize;
+    py::class_<StateVectorCudaBatched<PrecisionT>>(m, class_name.c_str())
+        .def(py::init<std::size_t, std::size_t>()) // qubits, batch size
+        .def(py::init<std::size_t, std::size_t, DevTag<int>>())
+        .def("numQubits", &StateVectorCudaBatched<PrecisionT>::getNumQubits)
+        .def("batchSize", &StateVectorCudaBatched<PrecisionT>::getBatchSize)
+        .def_static("maxGateWires",
+                    &StateVectorCudaBatched<PrecisionT>::getMaxGateWires)
+        .def_static("maxObservableWires",
+                    &StateVectorCudaBatched<PrecisionT>::getMaxObservableWires)
+        .def_static("maxBatchSize",
+                    &StateVectorCudaBatched<PrecisionT>::getMaxBatchSize,
+                    py::arg("num_qubits"), py::arg("device_id") = 0,
+                    "Largest batch of state-vectors fitting in the free "
+                    "memory of the device.")
+        .def("resetGPU", &StateVectorCudaBatched<PrecisionT>::initSV,
+             release_gil())
+        .def("apply", &StateVectorCudaBatched<PrecisionT>::applyOperations,
+             release_gil(),
+             "Apply a list of gates to all state-vectors, with the parameters "
+             "of each gate given per state-vector.")
+        .def("expval", &StateVectorCudaBatched<PrecisionT>::expval,
+             py::arg("names"), py::arg("wires"),
+             py::arg("matrices") =
+                 std::vector<std::vector<std::complex<PrecisionT>>>{},
+             release_gil(),
+             "Expectation value of a tensor product observable for each "
+             "state-vector.")
+        .def(
+            "DeviceToHost",
+            [](const StateVectorCudaBatched<PrecisionT> &batched_sv,
+               std::size_t batch_idx, np_arr_c &cpu_sv) {
+                py::buffer_info numpyArrayInfo = cpu_sv.request();
+                auto *data_ptr =
+                    static_cast<complex<PrecisionT> *>(numpyArrayInfo.ptr);
+                const auto length = static_cast<std::size_t>(cpu_sv.size());
+                py::gil_scoped_release release;
+                batched_sv.CopyGpuDataToHost(batch_idx, data_ptr, length);
+            },
+            "Copy one state-vector of the batch to the host.");
 
     //***********************************************************************//
     //                              Observable
@@ -621,6 +1144,21 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
             return "Operations: [" + ops_stream.str() + "]";
         });
 
+    class_name = "CompiledOpsGPU_C" + bitsize;
+    py::class_<CompiledOps<PrecisionT>>(m, class_name.c_str(),
+                                        py::module_local())
+        .def("__len__", &CompiledOps<PrecisionT>::getNumOps)
+        .def("num_qubits", &CompiledOps<PrecisionT>::getNumQubits)
+        .def(
+            "update_parameters",
+            [](CompiledOps<PrecisionT> &compiled,
+               const OpsData<PrecisionT> &ops) {
+                compiled.updateParameters(ops.getOpsParams(),
+                                          ops.getOpsMatrices());
+            },
+            "Replace the parameters of the compiled operations with those of "
+            "an operations list of the same structure.");
+
     //***********************************************************************//
     //                              Adj Jac
     //***********************************************************************//
@@ -663,8 +1201,31 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                  return OpsData<PrecisionT>{ops_name, conv_params, ops_wires,
                                             ops_inverses, conv_matrices};
              })
+        .def("set_memory_budget",
+             &AdjointJacobianGPU<PrecisionT>::setMemoryBudget,
+             "Set the device memory budget in bytes for the "
+             "observable-applied states. 0 uses the free device memory.")
+        .def("get_memory_budget",
+             &AdjointJacobianGPU<PrecisionT>::getMemoryBudget)
+        .def("set_use_stream_pool",
+             &AdjointJacobianGPU<PrecisionT>::setUseStreamPool,
+             "Bind each observable-applied state to its own CUDA stream.")
+        .def("get_use_stream_pool",
+             &AdjointJacobianGPU<PrecisionT>::getUseStreamPool)
+        .def("set_fusion_max_width",
+             &AdjointJacobianGPU<PrecisionT>::setFusionMaxWidth,
+             "Fuse the gates of the forward pass acting on at most this "
+             "many wires. 0 or 1 disables fusion.")
+        .def("get_fusion_max_width",
+             &AdjointJacobianGPU<PrecisionT>::getFusionMaxWidth)
+        .def("set_mixed_precision",
+             &AdjointJacobianGPU<PrecisionT>::setMixedPrecision,
+             "Accumulate the Jacobian of single-precision states in double "
+             "precision.")
+        .def("get_mixed_precision",
+             &AdjointJacobianGPU<PrecisionT>::getMixedPrecision)
         .def("adjoint_jacobian",
-             &AdjointJacobianGPU<PrecisionT>::adjointJacobian)
+             &AdjointJacobianGPU<PrecisionT>::adjointJacobian, release_gil())
         .def("adjoint_jacobian",
              [](AdjointJacobianGPU<PrecisionT> &adj,
                 const StateVectorCudaManaged<PrecisionT> &sv,
@@ -676,9 +1237,13 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                      observables.size(),
                      std::vector<PrecisionT>(trainableParams.size(), 0));
 
-                 adj.adjointJacobian(sv.getData(), sv.getLength(), jac,
-                                     observables, operations, trainableParams,
-                                     false, sv.getDataBuffer().getDevTag());
+                 {
+                     py::gil_scoped_release release;
+                     adj.adjointJacobian(sv.getData(), sv.getLength(), jac,
+                                         observables, operations,
+                                         trainableParams, false,
+                                         sv.getDataBuffer().getDevTag());
+                 }
                  return py::array_t<ParamT>(py::cast(jac));
              })
         .def("adjoint_jacobian_batched",
@@ -687,15 +1252,38 @@ void StateVectorCudaManaged_class_bindings(py::module &m) {
                 const std::vector<Pennylane::Algorithms::ObsDatum<PrecisionT>>
                     &observables,
                 const Pennylane::Algorithms::OpsData<PrecisionT> &operations,
-                const std::vector<size_t> &trainableParams, size_t num_params) {
+                const std::vector<size_t> &trainableParams) {
                  std::vector<std::vector<PrecisionT>> jac(
                      observables.size(),
-                     std::vector<PrecisionT>(num_params, 0));
+                     std::vector<PrecisionT>(trainableParams.size(), 0));
 
-                 adj.batchAdjointJacobian(sv.getData(), sv.getLength(), jac,
-                                          observables, operations,
-                                          trainableParams, false);
+                 {
+                     py::gil_scoped_release release;
+                     // The batched pass reads the state from other streams
+                     PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(sv.getStream()));
+                     adj.batchAdjointJacobian(sv.getData(), sv.getLength(),
+                                              jac, observables, operations,
+                                              trainableParams, false);
+                 }
                  return py::array_t<ParamT>(py::cast(jac));
+             })
+        .def("vjp",
+             [](AdjointJacobianGPU<PrecisionT> &adj,
+                const StateVectorCudaManaged<PrecisionT> &sv,
+                const std::vector<Pennylane::Algorithms::ObsDatum<PrecisionT>>
+                    &observables,
+                const Pennylane::Algorithms::OpsData<PrecisionT> &operations,
+                const std::vector<size_t> &trainableParams,
+                const std::vector<PrecisionT> &cotangents) {
+                 std::vector<PrecisionT> vjp;
+                 {
+                     py::gil_scoped_release release;
+                     adj.vectorJacobianProduct(
+                         sv.getData(), sv.getLength(), vjp, cotangents,
+                         observables, operations, trainableParams, false,
+                         sv.getDataBuffer().getDevTag());
+                 }
+                 return py::array_t<ParamT>(py::cast(vjp));
              });
 }
 
@@ -711,7 +1299,40 @@ PYBIND11_MODULE(lightning_gpu_qubit_ops, // NOLINT: No control over
     options.disable_function_signatures();
     py::register_exception<LightningException>(m, "PLException");
 
-    m.def("device_reset", &deviceReset, "Reset all GPU devices and contexts.");
+    m.def(
+        "device_reset",
+        []() {
+            // Pooled blocks do not survive the reset
+            DeviceMemoryPool::getInstance().trim();
+            deviceReset();
+        },
+        "Reset all GPU devices and contexts.");
+    m.def(
+        "setMemoryPoolEnabled",
+        [](bool enabled) {
+            DeviceMemoryPool::getInstance().setEnabled(enabled);
+        },
+        py::arg("enabled"),
+        "Recycle released device buffers of the same size class instead of "
+        "freeing them. Disabled by default.");
+    m.def(
+        "memoryPoolStats",
+        []() {
+            const auto stats = DeviceMemoryPool::getInstance().getStats();
+            py::dict py_stats;
+            py_stats["hits"] = stats.hits;
+            py_stats["misses"] = stats.misses;
+            py_stats["in_use_bytes"] = stats.in_use_bytes;
+            py_stats["cached_bytes"] = stats.cached_bytes;
+            py_stats["cached_blocks"] = stats.cached_blocks;
+            return py_stats;
+        },
+        "Get the hit, miss and memory counters of the device memory pool.");
+    m.def(
+        "trimMemoryPool",
+        []() { return DeviceMemoryPool::getInstance().trim(); },
+        "Free the idle blocks of the device memory pool, returning the number "
+        "of bytes released.");
     m.def("allToAllAccess", []() {
         for (int i = 0; i < static_cast<int>(getGPUCount()); i++) {
             cudaDeviceEnablePeerAccess(i, 0);
@@ -751,7 +1372,15 @@ PYBIND11_MODULE(lightning_gpu_qubit_ops, // NOLINT: No control over
                  // type
                  return static_cast<void *>(dev_tag.getStreamID());
              })
-        .def("refresh", &DevTag<int>::refresh);
+        .def("refresh", &DevTag<int>::refresh)
+        .def("ownsStream", &DevTag<int>::ownsStream,
+             "Check whether the tag owns its stream, created by "
+             "``createWithStream``.")
+        .def_static("createWithStream", &createStreamDevTag,
+                    py::arg("device_id") = 0,
+                    "Create a tag with a new non-blocking stream on the given "
+                    "device. The stream and the library handles bound to it "
+                    "are released with the last copy of the tag.");
 
     StateVectorCudaManaged_class_bindings<float, float>(m);
     StateVectorCudaManaged_class_bindings<double, double>(m);
@@ -0,0 +1,519 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file CompiledOps.hpp
+ * Operation lists lowered once to custatevec calls, for allocation-free
+ * replay.
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <custatevec.h>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "Error.hpp"
+#include "GateFusion.hpp"
+#include "cuGates_host.hpp"
+#include "cuda_helpers.hpp"
+
+/// @cond DEV
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+} // namespace
+/// @endcond
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Gates with a dedicated lowering in `CompiledOps`.
+ */
+enum class GateOp : uint8_t {
+    Identity,
+    PauliX,
+    PauliY,
+    PauliZ,
+    Hadamard,
+    S,
+    T,
+    CNOT,
+    CY,
+    CZ,
+    Toffoli,
+    SWAP,
+    CSWAP,
+    RX,
+    RY,
+    RZ,
+    CRX,
+    CRY,
+    CRZ,
+    Rot,
+    CRot,
+    PhaseShift,
+    ControlledPhaseShift,
+    IsingXX,
+    IsingYY,
+    IsingZZ,
+    MultiRZ,
+    /// Any other gate, applied as a dense matrix over all its wires.
+    Matrix
+};
+
+/**
+ * @brief Resolve a gate name to its `GateOp`.
+ *
+ * @param opName Name of the gate.
+ * @return GateOp of the gate, or `GateOp::Matrix` for other names.
+ */
+inline auto lookupGateOp(const std::string &opName) -> GateOp {
+    static const std::unordered_map<std::string, GateOp> gate_ops{
+        {"Identity", GateOp::Identity},
+        {"PauliX", GateOp::PauliX},
+        {"PauliY", GateOp::PauliY},
+        {"PauliZ", GateOp::PauliZ},
+        {"Hadamard", GateOp::Hadamard},
+        {"S", GateOp::S},
+        {"T", GateOp::T},
+        {"CNOT", GateOp::CNOT},
+        {"CY", GateOp::CY},
+        {"CZ", GateOp::CZ},
+        {"Toffoli", GateOp::Toffoli},
+        {"SWAP", GateOp::SWAP},
+        {"CSWAP", GateOp::CSWAP},
+        {"RX", GateOp::RX},
+        {"RY", GateOp::RY},
+        {"RZ", GateOp::RZ},
+        {"CRX", GateOp::CRX},
+        {"CRY", GateOp::CRY},
+        {"CRZ", GateOp::CRZ},
+        {"Rot", GateOp::Rot},
+        {"CRot", GateOp::CRot},
+        {"PhaseShift", GateOp::PhaseShift},
+        {"ControlledPhaseShift", GateOp::ControlledPhaseShift},
+        {"IsingXX", GateOp::IsingXX},
+        {"IsingYY", GateOp::IsingYY},
+        {"IsingZZ", GateOp::IsingZZ},
+        {"MultiRZ", GateOp::MultiRZ}};
+    const auto it = gate_ops.find(opName);
+    return (it != gate_ops.end()) ? it->second : GateOp::Matrix;
+}
+
+/**
+ * @brief A list of operations lowered to custatevec calls for a given number
+ * of qubits and device.
+ *
+ * Gate names are resolved once, wires are stored as cuQuantum-ordered int32
+ * index bits, and all gate matrices are uploaded into a single device block.
+ * Replaying the list, forwards or as adjoints, performs no host allocation
+ * and no string lookups. Each operation maps to a contiguous range of
+ * kernels, each of which is a single custatevec call.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> class CompiledOps {
+  public:
+    using CFP_t = decltype(cuUtil::getCudaType(PrecisionT{}));
+
+    enum class KernelType : uint8_t { PauliRotation, Matrix };
+
+    /**
+     * @brief A single custatevec call. Offsets index the wire, Pauli and
+     * matrix storage of the list.
+     */
+    struct Kernel {
+        KernelType type;
+        /// Apply the adjoint of the kernel.
+        bool adjoint;
+        std::size_t targets;
+        std::size_t num_targets;
+        std::size_t controls;
+        std::size_t num_controls;
+        /// Offset of the Pauli word, of `num_targets` entries.
+        std::size_t paulis;
+        /// Rotation angle passed to custatevec when not adjoint.
+        double angle;
+        /// Offset of the matrix in the device block.
+        std::size_t matrix;
+    };
+
+    /**
+     * @brief A compiled operation, as a range of kernels.
+     */
+    struct Op {
+        GateOp gate;
+        std::size_t first_kernel;
+        std::size_t num_kernels;
+        /// False if the operation could not be lowered.
+        bool supported;
+    };
+
+    /**
+     * @brief Lower a list of operations.
+     *
+     * @param num_qubits Number of qubits of the target state-vectors.
+     * @param dev_tag Device holding the gate matrices.
+     * @param opNames Names of the operations.
+     * @param wires Wires of each operation.
+     * @param adjoints Adjoint flag of each operation.
+     * @param params Parameters of each operation.
+     * @param matrices Optional matrix of each operation, used for gates
+     * without a known matrix. May be empty.
+     */
+    CompiledOps(
+        std::size_t num_qubits, const DevTag<int> &dev_tag,
+        const std::vector<std::string> &opNames,
+        const std::vector<std::vector<std::size_t>> &wires,
+        const std::vector<bool> &adjoints,
+        const std::vector<std::vector<PrecisionT>> &params,
+        const std::vector<std::vector<std::complex<PrecisionT>>> &matrices = {})
+        : num_qubits_{num_qubits}, dev_tag_{dev_tag}, names_{opNames},
+          op_wires_{wires}, adjoints_{adjoints}, id_{nextId()} {
+        PL_ABORT_IF(opNames.size() != wires.size(),
+                    "Incompatible number of ops and wires");
+        PL_ABORT_IF(opNames.size() != adjoints.size(),
+                    "Incompatible number of ops and adjoints");
+        PL_ABORT_IF(opNames.size() != params.size(),
+                    "Incompatible number of ops and params");
+
+        std::vector<CFP_t> host_matrices;
+        ops_.reserve(opNames.size());
+        for (std::size_t op_idx = 0; op_idx < opNames.size(); op_idx++) {
+            const std::vector<std::complex<PrecisionT>> *matrix =
+                (op_idx < matrices.size()) ? &matrices[op_idx] : nullptr;
+            lowerOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx],
+                           params[op_idx], matrix, host_matrices);
+        }
+        if (!host_matrices.empty()) {
+            matrices_ = std::make_unique<DataBuffer<CFP_t>>(
+                host_matrices.size(), dev_tag_);
+            matrices_->CopyHostDataToGpu(host_matrices.data(),
+                                         host_matrices.size());
+        }
+    }
+
+    /**
+     * @brief Replace the parameters of the operations, keeping the lowered
+     * structure. Rotation angles are updated on the host, and gate matrices
+     * are rewritten in place in the device block, so pointers to the block
+     * stay valid.
+     *
+     * The matrices are overwritten with a copy ordered on the legacy default
+     * stream; work still reading them on other streams must be synchronized
+     * first.
+     *
+     * @param params New parameters of each operation.
+     * @param matrices Optional matrix of each operation, as in the
+     * constructor.
+     */
+    void updateParameters(
+        const std::vector<std::vector<PrecisionT>> &params,
+        const std::vector<std::vector<std::complex<PrecisionT>>> &matrices =
+            {}) {
+        const CompiledOps updated(num_qubits_, dev_tag_, names_, op_wires_,
+                                  adjoints_, params, matrices);
+        const auto num_elements =
+            (matrices_ != nullptr) ? matrices_->getLength() : 0;
+        const auto updated_elements = (updated.matrices_ != nullptr)
+                                          ? updated.matrices_->getLength()
+                                          : 0;
+        PL_ABORT_IF(updated.kernels_.size() != kernels_.size() ||
+                        updated_elements != num_elements,
+                    "The new parameters change the structure of the "
+                    "compiled operations.");
+
+        const bool angles_changed = !std::equal(
+            kernels_.begin(), kernels_.end(), updated.kernels_.begin(),
+            [](const Kernel &lhs, const Kernel &rhs) {
+                return lhs.angle == rhs.angle;
+            });
+        kernels_ = updated.kernels_;
+        ops_ = updated.ops_;
+        if (num_elements > 0) {
+            matrices_->CopyGpuDataToGpu(*updated.matrices_);
+        }
+        if (angles_changed) {
+            revision_++;
+        }
+    }
+
+    /**
+     * @brief Identifier of this list, unique within the process.
+     */
+    [[nodiscard]] auto getId() const -> std::size_t { return id_; }
+
+    /**
+     * @brief Revision of the custatevec call arguments, incremented by
+     * `updateParameters` when a rotation angle changes. Matrix updates do not
+     * change the revision, since the matrices are read from device memory.
+     */
+    [[nodiscard]] auto getRevision() const -> std::size_t { return revision_; }
+
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return num_qubits_;
+    }
+    [[nodiscard]] auto getNumOps() const -> std::size_t { return ops_.size(); }
+    [[nodiscard]] auto getDevTag() const -> const DevTag<int> & {
+        return dev_tag_;
+    }
+    [[nodiscard]] auto getOp(std::size_t op_idx) const -> const Op & {
+        return ops_[op_idx];
+    }
+    [[nodiscard]] auto getOpName(std::size_t op_idx) const
+        -> const std::string & {
+        return names_[op_idx];
+    }
+    [[nodiscard]] auto getKernels() const -> const std::vector<Kernel> & {
+        return kernels_;
+    }
+    [[nodiscard]] auto getTargets(const Kernel &kernel) const
+        -> const int32_t * {
+        return wires_.data() + kernel.targets;
+    }
+    [[nodiscard]] auto getControls(const Kernel &kernel) const
+        -> const int32_t * {
+        return wires_.data() + kernel.controls;
+    }
+    [[nodiscard]] auto getPaulis(const Kernel &kernel) const
+        -> const custatevecPauli_t * {
+        return paulis_.data() + kernel.paulis;
+    }
+    [[nodiscard]] auto getMatrix(const Kernel &kernel) const -> const CFP_t * {
+        return matrices_->getData() + kernel.matrix;
+    }
+
+    /**
+     * @brief Get the custatevec workspace size in bytes required by the
+     * largest matrix kernel.
+     */
+    [[nodiscard]] auto getWorkspaceSize() const -> std::size_t {
+        return workspace_size_;
+    }
+    void setWorkspaceSize(std::size_t size_bytes) {
+        workspace_size_ = size_bytes;
+    }
+
+  private:
+    std::size_t num_qubits_;
+    DevTag<int> dev_tag_;
+    std::vector<std::string> names_;
+    std::vector<std::vector<std::size_t>> op_wires_;
+    std::vector<bool> adjoints_;
+    std::size_t id_;
+    std::size_t revision_{0};
+    std::vector<Op> ops_;
+    std::vector<Kernel> kernels_;
+    std::vector<int32_t> wires_;
+    std::vector<custatevecPauli_t> paulis_;
+    std::unique_ptr<DataBuffer<CFP_t>> matrices_;
+    std::size_t workspace_size_{0};
+
+    static auto nextId() -> std::size_t {
+        static std::atomic<std::size_t> next_id{0};
+        return next_id++;
+    }
+
+    /**
+     * @brief Store PennyLane wires as cuQuantum index bits.
+     *
+     * @return Offset of the first stored wire.
+     */
+    template <class Iter> auto addWires(Iter first, Iter last) -> std::size_t {
+        const auto offset = wires_.size();
+        for (; first != last; ++first) {
+            wires_.push_back(static_cast<int32_t>(num_qubits_ - 1 - *first));
+        }
+        return offset;
+    }
+
+    /**
+     * @brief Add a Pauli rotation kernel, with the controls given by all but
+     * the last `num_targets` wires.
+     */
+    void addRotation(const std::vector<custatevecPauli_t> &paulis,
+                     const std::vector<std::size_t> &wires, PrecisionT param) {
+        const auto num_ctrls = wires.size() - paulis.size();
+        Kernel kernel{};
+        kernel.type = KernelType::PauliRotation;
+        kernel.num_targets = paulis.size();
+        kernel.num_controls = num_ctrls;
+        kernel.controls = addWires(wires.begin(), wires.begin() + num_ctrls);
+        kernel.targets = addWires(wires.begin() + num_ctrls, wires.end());
+        kernel.paulis = paulis_.size();
+        paulis_.insert(paulis_.end(), paulis.begin(), paulis.end());
+        kernel.angle = static_cast<double>(-param / 2);
+        kernels_.push_back(kernel);
+    }
+
+    /**
+     * @brief Add a matrix kernel acting on the last wire, controlled by the
+     * others.
+     */
+    void addControlledMatrix(const std::vector<CFP_t> &matrix,
+                             const std::vector<std::size_t> &wires,
+                             std::vector<CFP_t> &host_matrices) {
+        addMatrix(
+            matrix,
+            std::vector<std::size_t>{wires.begin(), wires.end() - 1},
+            std::vector<std::size_t>{wires.back()}, host_matrices);
+    }
+
+    /**
+     * @brief Add a matrix kernel. Targets are given least significant
+     * first, as expected by custatevec.
+     */
+    void addMatrix(const std::vector<CFP_t> &matrix,
+                   const std::vector<std::size_t> &ctrls,
+                   const std::vector<std::size_t> &tgts,
+                   std::vector<CFP_t> &host_matrices) {
+        Kernel kernel{};
+        kernel.type = KernelType::Matrix;
+        kernel.num_targets = tgts.size();
+        kernel.num_controls = ctrls.size();
+        kernel.controls = addWires(ctrls.begin(), ctrls.end());
+        kernel.targets = addWires(tgts.begin(), tgts.end());
+        kernel.matrix = host_matrices.size();
+        host_matrices.insert(host_matrices.end(), matrix.begin(),
+                             matrix.end());
+        kernels_.push_back(kernel);
+    }
+
+    void lowerOperation(
+        const std::string &opName, const std::vector<std::size_t> &wires,
+        bool adjoint, const std::vector<PrecisionT> &params,
+        const std::vector<std::complex<PrecisionT>> *matrix,
+        std::vector<CFP_t> &host_matrices) {
+        using namespace cuGates;
+        const auto gate = lookupGateOp(opName);
+        const auto first_kernel = kernels_.size();
+        bool supported = true;
+        const PrecisionT param = params.empty() ? 0.0 : params.front();
+        // Reversed wires: the first target of custatevec is the least
+        // significant index of the matrix
+        const std::vector<std::size_t> rwires{wires.rbegin(), wires.rend()};
+
+        switch (gate) {
+        case GateOp::Identity:
+            break;
+        case GateOp::PauliX:
+        case GateOp::CNOT:
+        case GateOp::Toffoli:
+            addControlledMatrix(getPauliX<CFP_t>(), wires, host_matrices);
+            break;
+        case GateOp::PauliY:
+        case GateOp::CY:
+            addControlledMatrix(getPauliY<CFP_t>(), wires, host_matrices);
+            break;
+        case GateOp::PauliZ:
+        case GateOp::CZ:
+            addControlledMatrix(getPauliZ<CFP_t>(), wires, host_matrices);
+            break;
+        case GateOp::Hadamard:
+            addControlledMatrix(getHadamard<CFP_t>(), wires, host_matrices);
+            break;
+        case GateOp::S:
+            addControlledMatrix(getS<CFP_t>(), wires, host_matrices);
+            break;
+        case GateOp::T:
+            addControlledMatrix(getT<CFP_t>(), wires, host_matrices);
+            break;
+        case GateOp::PhaseShift:
+        case GateOp::ControlledPhaseShift:
+            addControlledMatrix(getPhaseShift<CFP_t>(param), wires,
+                                host_matrices);
+            break;
+        case GateOp::SWAP:
+            addMatrix(getSWAP<CFP_t>(), {}, rwires, host_matrices);
+            break;
+        case GateOp::CSWAP:
+            addMatrix(getSWAP<CFP_t>(), {wires.front()},
+                      {rwires.begin(), rwires.end() - 1}, host_matrices);
+            break;
+        case GateOp::RX:
+        case GateOp::CRX:
+            addRotation({CUSTATEVEC_PAULI_X}, wires, param);
+            break;
+        case GateOp::RY:
+        case GateOp::CRY:
+            addRotation({CUSTATEVEC_PAULI_Y}, wires, param);
+            break;
+        case GateOp::RZ:
+        case GateOp::CRZ:
+            addRotation({CUSTATEVEC_PAULI_Z}, wires, param);
+            break;
+        case GateOp::Rot:
+        case GateOp::CRot:
+            addRotation({CUSTATEVEC_PAULI_Z}, wires, params[0]);
+            addRotation({CUSTATEVEC_PAULI_Y}, wires, params[1]);
+            addRotation({CUSTATEVEC_PAULI_Z}, wires, params[2]);
+            break;
+        case GateOp::IsingXX:
+            addRotation(std::vector<custatevecPauli_t>(wires.size(),
+                                                       CUSTATEVEC_PAULI_X),
+                        wires, param);
+            break;
+        case GateOp::IsingYY:
+            addRotation(std::vector<custatevecPauli_t>(wires.size(),
+                                                       CUSTATEVEC_PAULI_Y),
+                        wires, param);
+            break;
+        case GateOp::IsingZZ:
+        case GateOp::MultiRZ:
+            addRotation(std::vector<custatevecPauli_t>(wires.size(),
+                                                       CUSTATEVEC_PAULI_Z),
+                        wires, param);
+            break;
+        case GateOp::Matrix: {
+            auto gate_matrix = getGateMatrixCu<PrecisionT>(
+                opName, params.empty() ? std::vector<PrecisionT>{0.0}
+                                       : params);
+            if (gate_matrix.empty() && matrix != nullptr) {
+                gate_matrix.resize(matrix->size());
+                std::transform(matrix->begin(), matrix->end(),
+                               gate_matrix.begin(),
+                               [](const std::complex<PrecisionT> &x) {
+                                   return cuUtil::complexToCu(x);
+                               });
+            }
+            if (gate_matrix.empty()) {
+                // Reported when the operation is applied, so that lists
+                // holding state preparations can still be compiled
+                supported = false;
+            } else {
+                addMatrix(gate_matrix, {}, rwires, host_matrices);
+            }
+            break;
+        }
+        }
+
+        // The adjoint of a product reverses the order of its factors
+        if (adjoint) {
+            std::reverse(kernels_.begin() + first_kernel, kernels_.end());
+            std::for_each(kernels_.begin() + first_kernel, kernels_.end(),
+                          [](Kernel &kernel) { kernel.adjoint = true; });
+        }
+        ops_.push_back(
+            {gate, first_kernel, kernels_.size() - first_kernel, supported});
+    }
+};
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,194 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file DeviceContext.hpp
+ */
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <custatevec.h>
+
+#include "DevTag.hpp"
+#include "cuGateCache.hpp"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Process-wide resources shared by the state-vectors of one device: a
+ * custatevec handle per stream, and one read-only cache of the default gates.
+ *
+ * Creating a custatevec handle and uploading the default gates each cost
+ * several allocations and blocking copies, which used to dominate the
+ * construction of short-lived state-vectors, such as the adjoint method
+ * scratch states. State-vectors borrow both from this context instead.
+ *
+ * A handle is shared by all state-vectors issuing work on its stream, and is
+ * bound to that stream; their work is serialized by the stream regardless.
+ * Lookups are thread-safe.
+ *
+ * @tparam Precision Floating point precision of the default gates.
+ */
+template <class Precision> class DeviceContext {
+  public:
+    DeviceContext(const DeviceContext &) = delete;
+    DeviceContext &operator=(const DeviceContext &) = delete;
+
+    ~DeviceContext() {
+        // The CUDA runtime may already be torn down at exit; ignore errors.
+        for (auto &[stream, handle] : handles_) {
+            custatevecDestroy(handle);
+        }
+    }
+
+    /**
+     * @brief Get the context of the given device, creating it if needed.
+     *
+     * @param device_id CUDA device index.
+     */
+    static auto getInstance(int device_id) -> DeviceContext & {
+        static std::mutex mutex;
+        static std::map<int, std::unique_ptr<DeviceContext>> contexts;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto &context = contexts[device_id];
+        if (context == nullptr) {
+            context.reset(new DeviceContext(device_id));
+        }
+        return *context;
+    }
+
+    /**
+     * @brief Get the custatevec handle bound to the given stream of this
+     * device, creating it if needed. All callers on the same stream get the
+     * same handle, which must not be used from several threads at once.
+     *
+     * @param stream_id CUDA stream.
+     * @return custatevecHandle_t
+     */
+    auto getHandle(cudaStream_t stream_id) -> custatevecHandle_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto it = handles_.find(stream_id); it != handles_.end()) {
+            return it->second;
+        }
+        custatevecHandle_t handle;
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(device_id_));
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(&handle));
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSetStream(handle, stream_id));
+        handles_.emplace(stream_id, handle);
+        return handle;
+    }
+
+    /**
+     * @brief Destroy the custatevec handle bound to `stream_id`, if any. Must
+     * be called before destroying a stream that was given to `getHandle`.
+     *
+     * @param stream_id CUDA stream.
+     */
+    void releaseHandle(cudaStream_t stream_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (auto it = handles_.find(stream_id); it != handles_.end()) {
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecDestroy(it->second));
+            handles_.erase(it);
+        }
+    }
+
+    /**
+     * @brief Get the cache of default gates of this device, populating it on
+     * first use. The cache must only be read, see
+     * `GateCache::setSharedGates`.
+     */
+    auto getDefaultGates() -> std::shared_ptr<const GateCache<Precision>> {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (default_gates_ == nullptr) {
+            default_gates_ = std::make_shared<const GateCache<Precision>>(
+                true, DevTag<int>{device_id_, 0});
+        }
+        return default_gates_;
+    }
+
+    /**
+     * @brief Number of custatevec handles currently held by the context.
+     */
+    auto getNumHandles() -> std::size_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return handles_.size();
+    }
+
+    [[nodiscard]] auto getDeviceID() const -> int { return device_id_; }
+
+  private:
+    explicit DeviceContext(int device_id) : device_id_{device_id} {}
+
+    const int device_id_;
+    std::mutex mutex_;
+    std::map<cudaStream_t, custatevecHandle_t> handles_;
+    std::shared_ptr<const GateCache<Precision>> default_gates_{nullptr};
+};
+
+/**
+ * @brief Release the custatevec, cuBLAS and cuSPARSE handles bound to a
+ * stream of `device_id`. Must be called before destroying a stream whose
+ * handles may have been requested, so that a new stream created at the same
+ * address does not inherit them.
+ *
+ * @param device_id CUDA device index.
+ * @param stream_id CUDA stream.
+ */
+inline void releaseStreamHandles(int device_id, cudaStream_t stream_id) {
+    DeviceContext<float>::getInstance(device_id).releaseHandle(stream_id);
+    DeviceContext<double>::getInstance(device_id).releaseHandle(stream_id);
+    Util::CublasHandleRegistry::getInstance().releaseHandle(device_id,
+                                                           stream_id);
+    Util::CusparseHandleRegistry::getInstance().releaseHandle(device_id,
+                                                             stream_id);
+}
+
+/**
+ * @brief Create a device tag owning a new non-blocking stream on `device_id`.
+ *
+ * Copies of the tag share the stream, which is destroyed with the last of
+ * them, after the custatevec, cuBLAS and cuSPARSE handles bound to it are
+ * released. State-vectors built from distinct tags do not synchronize with
+ * each other or with the legacy default stream, so they can run concurrently
+ * on one device.
+ *
+ * @param device_id CUDA device index.
+ */
+inline auto createStreamDevTag(int device_id) -> DevTag<int> {
+    cudaStream_t stream_id = nullptr;
+    {
+        Util::CudaScopedDevice scoped_device(device_id);
+        PL_CUDA_IS_SUCCESS(
+            cudaStreamCreateWithFlags(&stream_id, cudaStreamNonBlocking));
+    }
+    auto release = [device_id](void *stream) {
+        auto stream_id = static_cast<cudaStream_t>(stream);
+        // Throwing exceptions from a deleter can be dangerous; ignore errors
+        // on teardown.
+        try {
+            Util::CudaScopedDevice scoped_device(device_id);
+            cudaStreamSynchronize(stream_id);
+            releaseStreamHandles(device_id, stream_id);
+        } catch (...) {
+        }
+        cudaStreamDestroy(stream_id);
+    };
+    return {device_id, stream_id,
+            std::shared_ptr<void>(static_cast<void *>(stream_id), release)};
+}
+
+} // namespace Pennylane::CUDA
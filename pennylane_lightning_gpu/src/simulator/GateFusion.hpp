@@ -0,0 +1,355 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file GateFusion.hpp
+ * Merge runs of small gates into dense matrices over a few wires.
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "Error.hpp"
+#include "cuGates_host.hpp"
+#include "cuda_helpers.hpp"
+
+/// @cond DEV
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+} // namespace
+/// @endcond
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief A run of consecutive operations merged into one dense matrix.
+ *
+ * @tparam PrecisionT Floating point precision.
+ */
+template <class PrecisionT> struct FusedGate {
+    /// Wires of the matrix; `wires[0]` is the most significant matrix index.
+    std::vector<std::size_t> wires;
+    /// Row-major matrix over `wires`, with all adjoints already applied.
+    std::vector<std::complex<PrecisionT>> matrix;
+    /// Index of the first merged operation.
+    std::size_t first_op;
+    /// Number of merged operations.
+    std::size_t num_ops;
+};
+
+/**
+ * @brief Get the row-major matrix of a named gate over all its wires, in the
+ * CUDA complex type, as built by `cuGates`.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param opName Name of the gate.
+ * @param params Gate parameters.
+ * @return Gate matrix, or an empty vector if the gate has no host matrix.
+ */
+template <class PrecisionT>
+auto getGateMatrixCu(const std::string &opName,
+                     const std::vector<PrecisionT> &params)
+    -> std::vector<decltype(cuUtil::getCudaType(PrecisionT{}))> {
+    using CFP_t = decltype(cuUtil::getCudaType(PrecisionT{}));
+    using MatrixFunc =
+        std::function<std::vector<CFP_t>(const std::vector<PrecisionT> &)>;
+    using namespace cuGates;
+    static const std::unordered_map<std::string, MatrixFunc> gate_matrices{
+        {"Identity", [](auto &&) { return getIdentity<CFP_t>(); }},
+        {"PauliX", [](auto &&) { return getPauliX<CFP_t>(); }},
+        {"PauliY", [](auto &&) { return getPauliY<CFP_t>(); }},
+        {"PauliZ", [](auto &&) { return getPauliZ<CFP_t>(); }},
+        {"Hadamard", [](auto &&) { return getHadamard<CFP_t>(); }},
+        {"S", [](auto &&) { return getS<CFP_t>(); }},
+        {"T", [](auto &&) { return getT<CFP_t>(); }},
+        {"CNOT", [](auto &&) { return getCNOT<CFP_t>(); }},
+        {"SWAP", [](auto &&) { return getSWAP<CFP_t>(); }},
+        {"CY", [](auto &&) { return getCY<CFP_t>(); }},
+        {"CZ", [](auto &&) { return getCZ<CFP_t>(); }},
+        {"CSWAP", [](auto &&) { return getCSWAP<CFP_t>(); }},
+        {"Toffoli", [](auto &&) { return getToffoli<CFP_t>(); }},
+        {"PhaseShift",
+         [](auto &&p) { return getPhaseShift<CFP_t, PrecisionT>(p); }},
+        {"RX", [](auto &&p) { return getRX<CFP_t, PrecisionT>(p); }},
+        {"RY", [](auto &&p) { return getRY<CFP_t, PrecisionT>(p); }},
+        {"RZ", [](auto &&p) { return getRZ<CFP_t, PrecisionT>(p); }},
+        {"Rot", [](auto &&p) { return getRot<CFP_t, PrecisionT>(p); }},
+        {"CRX", [](auto &&p) { return getCRX<CFP_t, PrecisionT>(p); }},
+        {"CRY", [](auto &&p) { return getCRY<CFP_t, PrecisionT>(p); }},
+        {"CRZ", [](auto &&p) { return getCRZ<CFP_t, PrecisionT>(p); }},
+        {"CRot", [](auto &&p) { return getCRot<CFP_t, PrecisionT>(p); }},
+        {"ControlledPhaseShift",
+         [](auto &&p) {
+             return getControlledPhaseShift<CFP_t, PrecisionT>(p);
+         }},
+        {"IsingXX", [](auto &&p) { return getIsingXX<CFP_t, PrecisionT>(p); }},
+        {"IsingYY", [](auto &&p) { return getIsingYY<CFP_t, PrecisionT>(p); }},
+        {"IsingZZ", [](auto &&p) { return getIsingZZ<CFP_t, PrecisionT>(p); }},
+        {"SingleExcitation",
+         [](auto &&p) { return getSingleExcitation<CFP_t, PrecisionT>(p); }},
+        {"SingleExcitationMinus",
+         [](auto &&p) {
+             return getSingleExcitationMinus<CFP_t, PrecisionT>(p);
+         }},
+        {"SingleExcitationPlus",
+         [](auto &&p) {
+             return getSingleExcitationPlus<CFP_t, PrecisionT>(p);
+         }},
+        {"DoubleExcitation",
+         [](auto &&p) { return getDoubleExcitation<CFP_t, PrecisionT>(p); }},
+        {"DoubleExcitationMinus",
+         [](auto &&p) {
+             return getDoubleExcitationMinus<CFP_t, PrecisionT>(p);
+         }},
+        {"DoubleExcitationPlus",
+         [](auto &&p) {
+             return getDoubleExcitationPlus<CFP_t, PrecisionT>(p);
+         }}};
+
+    const auto it = gate_matrices.find(opName);
+    if (it == gate_matrices.end()) {
+        return {};
+    }
+    auto matrix = it->second(params);
+
+    // The excitation matrices of cuGates are indexed with the first wire as
+    // the least significant bit, matching how the explicit gate calls pass
+    // their wires to custatevec. Reverse their bit order so all matrices
+    // returned here share the row-major, first-wire-most-significant layout.
+    static const std::unordered_set<std::string> lsb_first_gates{
+        "SingleExcitation",      "SingleExcitationMinus",
+        "SingleExcitationPlus",  "DoubleExcitation",
+        "DoubleExcitationMinus", "DoubleExcitationPlus"};
+    if (lsb_first_gates.find(opName) != lsb_first_gates.end()) {
+        const auto dim = static_cast<std::size_t>(
+            std::sqrt(static_cast<double>(matrix.size())));
+        std::size_t num_wires = 0;
+        while ((std::size_t{1} << num_wires) < dim) {
+            num_wires++;
+        }
+        auto reverse_bits = [num_wires](std::size_t idx) {
+            std::size_t rev = 0;
+            for (std::size_t bit = 0; bit < num_wires; bit++) {
+                rev |= ((idx >> bit) & 1U) << (num_wires - 1 - bit);
+            }
+            return rev;
+        };
+        std::vector<CFP_t> reordered(matrix.size());
+        for (std::size_t row = 0; row < dim; row++) {
+            for (std::size_t col = 0; col < dim; col++) {
+                reordered[row * dim + col] =
+                    matrix[reverse_bits(row) * dim + reverse_bits(col)];
+            }
+        }
+        matrix = std::move(reordered);
+    }
+    return matrix;
+}
+
+/**
+ * @brief Get the row-major matrix of a named gate, as built by `cuGates`.
+ *
+ * @tparam PrecisionT Floating point precision.
+ * @param opName Name of the gate.
+ * @param params Gate parameters.
+ * @param adjoint Return the adjoint of the gate matrix.
+ * @return Gate matrix, or an empty vector if the gate has no host matrix.
+ */
+template <class PrecisionT>
+auto getGateMatrix(const std::string &opName,
+                   const std::vector<PrecisionT> &params, bool adjoint)
+    -> std::vector<std::complex<PrecisionT>> {
+    const auto matrix_cu = getGateMatrixCu<PrecisionT>(opName, params);
+    if (matrix_cu.empty()) {
+        return {};
+    }
+    const auto dim = static_cast<std::size_t>(
+        std::sqrt(static_cast<double>(matrix_cu.size())));
+    std::vector<std::complex<PrecisionT>> matrix(matrix_cu.size());
+    for (std::size_t row = 0; row < dim; row++) {
+        for (std::size_t col = 0; col < dim; col++) {
+            const auto value = cuUtil::cuToComplex(matrix_cu[row * dim + col]);
+            if (adjoint) {
+                matrix[col * dim + row] = std::conj(value);
+            } else {
+                matrix[row * dim + col] = value;
+            }
+        }
+    }
+    return matrix;
+}
+
+/**
+ * @brief Left-multiply a dense matrix over `wires` by a gate acting on a
+ * subset of them.
+ *
+ * @param matrix Row-major matrix over `num_wires` wires, updated in place.
+ * @param num_wires Number of wires of `matrix`.
+ * @param gate Row-major gate matrix.
+ * @param positions Position in the wires of `matrix` of each gate wire, in
+ * gate wire order.
+ */
+template <class PrecisionT>
+void applyGateToMatrix(std::vector<std::complex<PrecisionT>> &matrix,
+                       std::size_t num_wires,
+                       const std::vector<std::complex<PrecisionT>> &gate,
+                       const std::vector<std::size_t> &positions) {
+    const std::size_t dim = std::size_t{1} << num_wires;
+    const std::size_t gate_dim = std::size_t{1} << positions.size();
+
+    // Offsets of the gate basis states within a row index
+    std::vector<std::size_t> offsets(gate_dim, 0);
+    std::size_t gate_mask = 0;
+    for (std::size_t k = 0; k < gate_dim; k++) {
+        for (std::size_t m = 0; m < positions.size(); m++) {
+            const auto bit = (k >> (positions.size() - 1 - m)) & 1U;
+            offsets[k] |= bit << (num_wires - 1 - positions[m]);
+        }
+    }
+    for (const auto pos : positions) {
+        gate_mask |= std::size_t{1} << (num_wires - 1 - pos);
+    }
+
+    std::vector<std::complex<PrecisionT>> in(gate_dim);
+    for (std::size_t col = 0; col < dim; col++) {
+        for (std::size_t base = 0; base < dim; base++) {
+            if (base & gate_mask) {
+                continue;
+            }
+            for (std::size_t k = 0; k < gate_dim; k++) {
+                in[k] = matrix[(base | offsets[k]) * dim + col];
+            }
+            for (std::size_t r = 0; r < gate_dim; r++) {
+                std::complex<PrecisionT> sum{0, 0};
+                for (std::size_t k = 0; k < gate_dim; k++) {
+                    sum += gate[r * gate_dim + k] * in[k];
+                }
+                matrix[(base | offsets[r]) * dim + col] = sum;
+            }
+        }
+    }
+}
+
+/**
+ * @brief Group a sequence of operations into fused gates of at most
+ * `max_width` wires.
+ *
+ * Operations are merged greedily in circuit order: each gate joins the
+ * current group if the union of their wires stays within `max_width`, and
+ * closes it otherwise. Gates without a host matrix (see `getGateMatrix`), or
+ * wider than `max_width`, are kept on their own. Groups of a single operation
+ * carry no matrix, so they can still use the native gate calls.
+ *
+ * @param opNames Names of the operations.
+ * @param wires Wires of each operation.
+ * @param adjoints Adjoint flag of each operation.
+ * @param params Parameters of each operation.
+ * @param max_width Maximum number of wires of a fused gate.
+ * @return Fused gates covering all operations, in order.
+ */
+template <class PrecisionT>
+auto fuseOperations(const std::vector<std::string> &opNames,
+                    const std::vector<std::vector<std::size_t>> &wires,
+                    const std::vector<bool> &adjoints,
+                    const std::vector<std::vector<PrecisionT>> &params,
+                    std::size_t max_width)
+    -> std::vector<FusedGate<PrecisionT>> {
+    PL_ABORT_IF(opNames.size() != wires.size(),
+                "Incompatible number of ops and wires");
+    PL_ABORT_IF(opNames.size() != adjoints.size(),
+                "Incompatible number of ops and adjoints");
+
+    std::vector<FusedGate<PrecisionT>> fused;
+    // Whether the last fused gate can still take more operations
+    bool open = false;
+
+    auto close = [&]() {
+        if (open && fused.back().num_ops == 1) {
+            fused.back().matrix.clear();
+        }
+        open = false;
+    };
+
+    for (std::size_t op_idx = 0; op_idx < opNames.size(); op_idx++) {
+        const auto &op_wires = wires[op_idx];
+        auto gate = (op_wires.size() <= max_width)
+                        ? getGateMatrix<PrecisionT>(
+                              opNames[op_idx],
+                              params.empty() ? std::vector<PrecisionT>{0.0}
+                                             : params[op_idx],
+                              adjoints[op_idx])
+                        : std::vector<std::complex<PrecisionT>>{};
+        if (gate.empty()) {
+            close();
+            fused.push_back({op_wires, {}, op_idx, 1});
+            continue;
+        }
+
+        if (open) {
+            auto &group = fused.back();
+            std::vector<std::size_t> new_wires;
+            for (const auto wire : op_wires) {
+                if (std::find(group.wires.begin(), group.wires.end(), wire) ==
+                    group.wires.end()) {
+                    new_wires.push_back(wire);
+                }
+            }
+            if (group.wires.size() + new_wires.size() <= max_width) {
+                // Extend the group matrix with identity on the new wires,
+                // which become the least significant indices.
+                const std::size_t old_dim = std::size_t{1}
+                                            << group.wires.size();
+                const std::size_t ext_dim = std::size_t{1} << new_wires.size();
+                const std::size_t dim = old_dim * ext_dim;
+                std::vector<std::complex<PrecisionT>> matrix(dim * dim);
+                for (std::size_t r = 0; r < old_dim; r++) {
+                    for (std::size_t c = 0; c < old_dim; c++) {
+                        for (std::size_t x = 0; x < ext_dim; x++) {
+                            matrix[(r * ext_dim + x) * dim + c * ext_dim + x] =
+                                group.matrix[r * old_dim + c];
+                        }
+                    }
+                }
+                group.wires.insert(group.wires.end(), new_wires.begin(),
+                                   new_wires.end());
+                group.matrix = std::move(matrix);
+
+                std::vector<std::size_t> positions(op_wires.size());
+                for (std::size_t m = 0; m < op_wires.size(); m++) {
+                    positions[m] = static_cast<std::size_t>(
+                        std::find(group.wires.begin(), group.wires.end(),
+                                  op_wires[m]) -
+                        group.wires.begin());
+                }
+                applyGateToMatrix(group.matrix, group.wires.size(), gate,
+                                  positions);
+                group.num_ops++;
+                continue;
+            }
+            close();
+        }
+        fused.push_back({op_wires, std::move(gate), op_idx, 1});
+        open = true;
+    }
+    close();
+    return fused;
+}
+
+} // namespace Pennylane::CUDA
@@ -17,7 +17,10 @@
 #pragma once
 
 #include "cuda.h"
+#include <algorithm>
+#include <complex>
 #include <cuda_runtime_api.h> // cudaMalloc, cudaMemcpy, etc.
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <unordered_map>
@@ -26,6 +29,7 @@
 #include "DataBuffer.hpp"
 #include "DevTag.hpp"
 #include "Error.hpp"
+#include "PinnedHostBuffer.hpp"
 #include "StateVectorBase.hpp"
 #include "StateVectorManagedCPU.hpp"
 #include "cuda_helpers.hpp"
@@ -38,6 +42,18 @@ namespace cuUtil = Pennylane::CUDA::Util;
 
 namespace Pennylane {
 
+// Kernel launchers defined in stateKernels.cu
+extern cudaError_t scatterAmplitudes_CUDA(cuComplex *sv,
+                                          const cuComplex *values,
+                                          const std::size_t *indices,
+                                          std::size_t num_values,
+                                          cudaStream_t stream);
+extern cudaError_t scatterAmplitudes_CUDA(cuDoubleComplex *sv,
+                                          const cuDoubleComplex *values,
+                                          const std::size_t *indices,
+                                          std::size_t num_values,
+                                          cudaStream_t stream);
+
 /**
  * @brief CRTP-enabled base class for CUDA-capable state-vector simulators.
  *
@@ -89,6 +105,24 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
     }
     void setStream(const cudaStream_t &s) { data_buffer_->setStream(s); }
 
+    /**
+     * @brief Get the modification count of the device data. State derived
+     * from the data, such as a preprocessed sampler, stays valid while the
+     * count is unchanged.
+     *
+     * @return std::size_t
+     */
+    [[nodiscard]] auto getDataVersion() const -> std::size_t {
+        return data_version_;
+    }
+
+    /**
+     * @brief Record a modification of the device data, invalidating state
+     * derived from it. Gate applications and copies into the state-vector
+     * call this; callers writing through `getData()` must call it too.
+     */
+    void markModified() { data_version_++; }
+
     /**
      * @brief Explicitly copy data from host memory to GPU device.
      *
@@ -99,6 +133,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         PL_ABORT_IF_NOT(BaseType::getNumQubits() == sv.getNumQubits(),
                         "Sizes do not match for Host and GPU data");
         data_buffer_->CopyHostDataToGpu(sv.getData(), sv.getLength(), async);
+        markModified();
     }
 
     /**
@@ -112,6 +147,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         PL_ABORT_IF_NOT(BaseType::getLength() == sv.size(),
                         "Sizes do not match for Host and GPU data");
         data_buffer_->CopyHostDataToGpu(sv.data(), sv.size(), async);
+        markModified();
     }
 
     /**
@@ -125,6 +161,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         PL_ABORT_IF_NOT(BaseType::getLength() == length,
                         "Sizes do not match for Host and GPU data");
         data_buffer_->CopyGpuDataToGpu(gpu_sv, length, async);
+        markModified();
     }
     /**
      * @brief Explicitly copy data from another GPU device memory block to this
@@ -142,7 +179,12 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                                decltype(sv.getData())>>>;
         PL_ABORT_IF_NOT(same,
                         "Data types are incompatible for GPU-GPU transfer");
+        if (!async && sv.getStream() != getStream()) {
+            // The copy is enqueued on this object's stream only
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(sv.getStream()));
+        }
         data_buffer_->CopyGpuDataToGpu(sv.getData(), sv.getLength(), async);
+        markModified();
     }
 
     /**
@@ -157,6 +199,7 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
                         "Sizes do not match for Host and GPU data");
         data_buffer_->CopyHostDataToGpu(
             reinterpret_cast<const CFP_t *>(host_sv), length, async);
+        markModified();
     }
 
     /**
@@ -191,8 +234,90 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
     inline void CopyGpuDataToGpuOut(Derived &sv, bool async = false) {
         PL_ABORT_IF_NOT(BaseType::getNumQubits() == sv.getNumQubits(),
                         "Sizes do not match for GPU data objects");
-        sv.getDataBuffer()->CopyGpuDataToGpu(getData(),
-                                             data_buffer_->getLength(), async);
+        sv.getDataBuffer().CopyGpuDataToGpu(getData(),
+                                            data_buffer_->getLength(), async);
+        sv.markModified();
+    }
+
+    /**
+     * @brief Start copying the GPU data into the pinned host mirror, and
+     * return without waiting for the transfer.
+     *
+     * The mirror is allocated on first use and reused afterwards. The copy is
+     * ordered on the state-vector stream, so it overlaps with host work and
+     * with gates applied after it, which do not affect the copied data.
+     *
+     * @return cudaEvent_t Event completed once the mirror holds the data.
+     */
+    auto CopyGpuDataToHostMirror() -> cudaEvent_t {
+        auto &mirror = getHostMirror();
+        data_buffer_->CopyGpuDataToHost(mirror.getData(), mirror.getLength(),
+                                        true);
+        mirror_version_ = data_version_;
+        return mirror.recordTransfer(getStream());
+    }
+
+    /**
+     * @brief Copy the GPU data to host memory through the pinned mirror.
+     *
+     * If the mirror already holds the current data, for instance after
+     * `CopyGpuDataToHostMirror`, this only waits for that transfer to finish;
+     * otherwise a new transfer is started first.
+     *
+     * @param host_sv Complex data pointer to receive data from device.
+     * @param length Number of complex elements.
+     */
+    void CopyHostMirrorToHost(std::complex<Precision> *host_sv,
+                              std::size_t length) {
+        PL_ABORT_IF_NOT(BaseType::getLength() == length,
+                        "Sizes do not match for Host and GPU data");
+        if (!isHostMirrorCurrent()) {
+            CopyGpuDataToHostMirror();
+        }
+        host_mirror_->synchronize();
+        std::copy(host_mirror_->getData(), host_mirror_->getData() + length,
+                  host_sv);
+    }
+
+    /**
+     * @brief Copy host data to the GPU through the pinned mirror.
+     *
+     * The data is staged into the mirror before returning, so `host_sv` may be
+     * reused immediately, while the transfer to the device proceeds
+     * asynchronously on the state-vector stream.
+     *
+     * @param host_sv Complex data pointer to array.
+     * @param length Number of complex elements.
+     * @return cudaEvent_t Event completed once the device holds the data.
+     */
+    auto CopyHostDataToGpuStaged(const std::complex<Precision> *host_sv,
+                                 std::size_t length) -> cudaEvent_t {
+        PL_ABORT_IF_NOT(BaseType::getLength() == length,
+                        "Sizes do not match for Host and GPU data");
+        auto &mirror = getHostMirror();
+        // A previous transfer may still be using the mirror
+        mirror.synchronize();
+        std::copy(host_sv, host_sv + length, mirror.getData());
+        data_buffer_->CopyHostDataToGpu(mirror.getData(), length, true);
+        markModified();
+        mirror_version_ = data_version_;
+        return mirror.recordTransfer(getStream());
+    }
+
+    /**
+     * @brief Check whether the pinned host mirror holds, or is receiving, the
+     * current GPU data.
+     */
+    [[nodiscard]] auto isHostMirrorCurrent() const -> bool {
+        return host_mirror_ != nullptr && mirror_version_ == data_version_;
+    }
+
+    /**
+     * @brief Check whether the last transfer through the pinned host mirror
+     * has finished, without blocking.
+     */
+    [[nodiscard]] auto isHostMirrorReady() const -> bool {
+        return host_mirror_ == nullptr || host_mirror_->isReady();
     }
 
     const CUDA::DataBuffer<CFP_t> &getDataBuffer() const {
@@ -215,11 +340,81 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
      * @brief Initialize the statevector data to the |0...0> state
      *
      */
-    void initSV(bool async = false) {
-        std::vector<std::complex<Precision>> data(BaseType::getLength(),
-                                                  {0, 0});
-        data[0] = {1, 0};
-        CopyHostDataToGpu(data.data(), data.size(), async);
+    void initSV(bool async = false) { setBasisState(0, async); }
+
+    /**
+     * @brief Set the statevector data to a computational basis state.
+     *
+     * The data is cleared with a device memset and the single non-zero
+     * amplitude is written directly, without building the state on the host.
+     *
+     * @param index Index of the basis state, with wire 0 as the most
+     * significant bit.
+     * @param async Return without waiting for the device.
+     */
+    void setBasisState(std::size_t index, bool async = false) {
+        PL_ABORT_IF_NOT(index < BaseType::getLength(),
+                        "The basis state index is out of range.");
+        const CFP_t one = cuUtil::ONE<CFP_t>();
+        PL_CUDA_IS_SUCCESS(cudaMemsetAsync(
+            getData(), 0, sizeof(CFP_t) * BaseType::getLength(), getStream()));
+        PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(getData() + index, &one,
+                                           sizeof(CFP_t),
+                                           cudaMemcpyHostToDevice,
+                                           getStream()));
+        markModified();
+        if (!async) {
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(getStream()));
+        }
+    }
+
+    /**
+     * @brief Set the statevector data to the given state of a subset of the
+     * wires, with all other wires in |0>.
+     *
+     * Only the `2^wires.size()` given amplitudes are uploaded, and scattered
+     * into the cleared statevector on the device.
+     *
+     * @param values Amplitudes of the sub-register, with `wires[0]` as the
+     * most significant bit.
+     * @param num_values Number of amplitudes, equal to `2^wires.size()`.
+     * @param wires Wires the amplitudes are given for.
+     */
+    void setStateVector(const std::complex<Precision> *values,
+                        std::size_t num_values,
+                        const std::vector<std::size_t> &wires) {
+        const std::size_t num_qubits = BaseType::getNumQubits();
+        const std::size_t num_wires = wires.size();
+        PL_ABORT_IF_NOT(num_values == Util::exp2(num_wires),
+                        "The number of amplitudes must be 2^(num wires).");
+        for (const auto wire : wires) {
+            PL_ABORT_IF_NOT(wire < num_qubits, "Invalid wire index.");
+        }
+
+        // Position of each sub-register amplitude in the full statevector
+        std::vector<std::size_t> indices(num_values, 0);
+        for (std::size_t k = 0; k < num_values; k++) {
+            for (std::size_t j = 0; j < num_wires; j++) {
+                const std::size_t bit = (k >> (num_wires - 1 - j)) & 1U;
+                indices[k] |= bit << (num_qubits - 1 - wires[j]);
+            }
+        }
+
+        const auto &dev_tag = data_buffer_->getDevTag();
+        CUDA::DataBuffer<std::size_t> d_indices(num_values, dev_tag, true);
+        CUDA::DataBuffer<CFP_t> d_values(num_values, dev_tag, true);
+        d_indices.CopyHostDataToGpu(indices.data(), indices.size(), true);
+        d_values.CopyHostDataToGpu(values, num_values, true);
+
+        PL_CUDA_IS_SUCCESS(cudaMemsetAsync(
+            getData(), 0, sizeof(CFP_t) * BaseType::getLength(), getStream()));
+        PL_CUDA_IS_SUCCESS(scatterAmplitudes_CUDA(getData(),
+                                                  d_values.getData(),
+                                                  d_indices.getData(),
+                                                  num_values, getStream()));
+        markModified();
+        // The scratch buffers are released on return
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(getStream()));
     }
 
   protected:
@@ -238,6 +433,11 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
         : StateVectorBase<Precision, Derived>(num_qubits),
           data_buffer_{std::make_unique<CUDA::DataBuffer<CFP_t>>(
               Util::exp2(num_qubits), dev_tag, device_alloc)} {}
+    StateVectorCudaBase(size_t num_qubits, CFP_t *gpu_data,
+                        const CUDA::DevTag<int> &dev_tag)
+        : StateVectorBase<Precision, Derived>(num_qubits),
+          data_buffer_{std::make_unique<CUDA::DataBuffer<CFP_t>>(
+              Util::exp2(num_qubits), gpu_data, dev_tag)} {}
     StateVectorCudaBase() = delete;
     StateVectorCudaBase(const StateVectorCudaBase &other) = delete;
     StateVectorCudaBase(StateVectorCudaBase &&other) = delete;
@@ -264,7 +464,28 @@ class StateVectorCudaBase : public StateVectorBase<Precision, Derived> {
     }
 
   private:
+    /**
+     * @brief Get the pinned host mirror of the GPU data, allocating it on
+     * first use.
+     */
+    auto getHostMirror() -> CUDA::PinnedHostBuffer<std::complex<Precision>> & {
+        if (host_mirror_ == nullptr) {
+            // The completion event is created on the current device, and must
+            // belong to the device of the stream it is recorded on
+            cuUtil::CudaScopedDevice scoped_device(
+                data_buffer_->getDevTag().getDeviceID());
+            host_mirror_ = std::make_unique<
+                CUDA::PinnedHostBuffer<std::complex<Precision>>>(
+                BaseType::getLength());
+        }
+        return *host_mirror_;
+    }
+
     std::unique_ptr<CUDA::DataBuffer<CFP_t>> data_buffer_;
+    std::size_t data_version_{0};
+    std::unique_ptr<CUDA::PinnedHostBuffer<std::complex<Precision>>>
+        host_mirror_{nullptr};
+    std::size_t mirror_version_{std::numeric_limits<std::size_t>::max()};
     const std::unordered_set<std::string> const_gates_{
         "Identity", "PauliX", "PauliY", "PauliZ", "Hadamard", "T",
         "S",        "CNOT",   "SWAP",   "CZ",     "CSWAP",    "Toffoli"};
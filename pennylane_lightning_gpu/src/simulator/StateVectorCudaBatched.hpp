@@ -0,0 +1,418 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file StateVectorCudaBatched.hpp
+ */
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cuComplex.h>
+#include <cuda.h>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "Error.hpp"
+#include "GateFusion.hpp"
+#include "cuda_helpers.hpp"
+
+/// @cond DEV
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+using namespace Pennylane::CUDA;
+} // namespace
+/// @endcond
+
+namespace Pennylane {
+
+// Kernel launchers defined in batchKernels.cu
+extern unsigned int getMaxBatchedTargets_CUDA();
+extern cudaError_t applyBatchedMatrix_CUDA(cuComplex *sv,
+                                           unsigned int num_qubits,
+                                           std::size_t batch_size,
+                                           const cuComplex *matrices,
+                                           std::size_t matrix_stride,
+                                           const int *tgts,
+                                           unsigned int num_tgts,
+                                           cudaStream_t stream);
+extern cudaError_t applyBatchedMatrix_CUDA(cuDoubleComplex *sv,
+                                           unsigned int num_qubits,
+                                           std::size_t batch_size,
+                                           const cuDoubleComplex *matrices,
+                                           std::size_t matrix_stride,
+                                           const int *tgts,
+                                           unsigned int num_tgts,
+                                           cudaStream_t stream);
+
+// Kernel launchers defined in measurementKernels.cu
+extern unsigned int getMaxMomentWires_CUDA();
+extern cudaError_t computeBatchedMoments_CUDA(
+    const cuComplex *sv, unsigned int num_qubits, std::size_t batch_size,
+    const cuComplex *matrix, const int *tgts, unsigned int num_tgts,
+    double *result, cudaStream_t stream);
+extern cudaError_t computeBatchedMoments_CUDA(
+    const cuDoubleComplex *sv, unsigned int num_qubits, std::size_t batch_size,
+    const cuDoubleComplex *matrix, const int *tgts, unsigned int num_tgts,
+    double *result, cudaStream_t stream);
+
+/**
+ * @brief A batch of state-vectors of the same size, held in one contiguous
+ * device allocation, to evaluate the same circuit for many parameter sets.
+ *
+ * Each gate is applied to all state-vectors of the batch by a single kernel,
+ * with one matrix per state-vector for parametric gates, and expectation
+ * values of all state-vectors are reduced by a single kernel. This keeps the
+ * device busy at qubit counts where one state-vector does not fill it.
+ *
+ * State-vector `b` of the batch occupies elements
+ * `[b * getLength(), (b + 1) * getLength())` of the allocation.
+ *
+ * @tparam Precision Floating-point precision type.
+ */
+template <class Precision> class StateVectorCudaBatched {
+  public:
+    using CFP_t = decltype(cuUtil::getCudaType(Precision{}));
+
+    /// Largest batch size, bounded by the number of grid rows of a launch.
+    static constexpr std::size_t max_batch_size = 65535;
+
+    StateVectorCudaBatched() = delete;
+
+    /**
+     * @brief Allocate `batch_size` state-vectors, initialized to |0>.
+     *
+     * @param num_qubits Number of qubits of each state-vector.
+     * @param batch_size Number of state-vectors.
+     * @param dev_tag Device and stream holding the batch.
+     */
+    StateVectorCudaBatched(std::size_t num_qubits, std::size_t batch_size,
+                           const DevTag<int> &dev_tag = {0, 0})
+        : num_qubits_{num_qubits}, batch_size_{checkBatchSize(batch_size)},
+          data_{Util::exp2(num_qubits) * batch_size, dev_tag} {
+        initSV();
+    }
+
+    [[nodiscard]] auto getNumQubits() const -> std::size_t {
+        return num_qubits_;
+    }
+    [[nodiscard]] auto getBatchSize() const -> std::size_t {
+        return batch_size_;
+    }
+    /**
+     * @brief Number of elements of each state-vector of the batch.
+     */
+    [[nodiscard]] auto getLength() const -> std::size_t {
+        return Util::exp2(num_qubits_);
+    }
+    [[nodiscard]] auto getData() -> CFP_t * { return data_.getData(); }
+    [[nodiscard]] auto getData() const -> const CFP_t * {
+        return data_.getData();
+    }
+    [[nodiscard]] auto getStream() const -> cudaStream_t {
+        return data_.getStream();
+    }
+
+    /**
+     * @brief Largest number of wires of a gate or observable accepted by the
+     * batched kernels.
+     */
+    [[nodiscard]] static auto getMaxGateWires() -> std::size_t {
+        return getMaxBatchedTargets_CUDA();
+    }
+    [[nodiscard]] static auto getMaxObservableWires() -> std::size_t {
+        return getMaxMomentWires_CUDA();
+    }
+
+    /**
+     * @brief Largest number of state-vectors of `num_qubits` qubits in a
+     * batch on `device_id`, given its free memory and the `max_batch_size`
+     * grid rows of the batched kernels.
+     *
+     * @param num_qubits Number of qubits of each state-vector.
+     * @param device_id CUDA device index.
+     * @return std::size_t Batch size, or 0 if a single state-vector does not
+     * fit.
+     */
+    [[nodiscard]] static auto getMaxBatchSize(std::size_t num_qubits,
+                                              int device_id = 0)
+        -> std::size_t {
+        std::size_t free_bytes = 0;
+        std::size_t total_bytes = 0;
+        {
+            cuUtil::CudaScopedDevice scoped_device(device_id);
+            PL_CUDA_IS_SUCCESS(cudaMemGetInfo(&free_bytes, &total_bytes));
+        }
+        // Leave headroom for the gate matrices and the moments
+        const auto budget = static_cast<std::size_t>(free_bytes * 0.9);
+        const std::size_t sv_bytes = Util::exp2(num_qubits) * sizeof(CFP_t);
+        return std::min(budget / sv_bytes, max_batch_size);
+    }
+
+    /**
+     * @brief Set every state-vector of the batch to |0>.
+     */
+    void initSV() {
+        const std::size_t length = getLength();
+        PL_CUDA_IS_SUCCESS(cudaMemsetAsync(data_.getData(), 0,
+                                           sizeof(CFP_t) * data_.getLength(),
+                                           getStream()));
+        // One strided copy writes the first amplitude of every state-vector
+        const std::vector<CFP_t> ones(
+            batch_size_, cuUtil::complexToCu(std::complex<Precision>{1, 0}));
+        PL_CUDA_IS_SUCCESS(cudaMemcpy2DAsync(
+            data_.getData(), sizeof(CFP_t) * length, ones.data(),
+            sizeof(CFP_t), sizeof(CFP_t), batch_size_, cudaMemcpyHostToDevice,
+            getStream()));
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(getStream()));
+    }
+
+    /**
+     * @brief Apply a named gate to all state-vectors of the batch.
+     *
+     * @param opName Name of the gate.
+     * @param wires Wires of the gate.
+     * @param adjoint Apply the adjoint of the gate.
+     * @param batch_params Parameters of the gate for each state-vector, or
+     * empty for a gate without parameters.
+     */
+    void applyOperation(
+        const std::string &opName, const std::vector<std::size_t> &wires,
+        bool adjoint,
+        const std::vector<std::vector<Precision>> &batch_params = {}) {
+        if (opName == "Identity") {
+            return;
+        }
+        PL_ABORT_IF(!batch_params.empty() &&
+                        batch_params.size() != batch_size_,
+                    "One parameter set is required per state-vector.");
+        // Gates without parameters share one matrix
+        const std::size_t num_matrices =
+            batch_params.empty() ? 1 : batch_size_;
+        const std::size_t dim = Util::exp2(wires.size());
+        std::vector<CFP_t> matrices(num_matrices * dim * dim);
+        for (std::size_t b = 0; b < num_matrices; b++) {
+            const auto matrix = getGateMatrix<Precision>(
+                opName,
+                batch_params.empty() ? std::vector<Precision>{}
+                                     : batch_params[b],
+                adjoint);
+            if (matrix.size() != dim * dim) {
+                throw LightningException("Currently unsupported gate: " +
+                                         opName);
+            }
+            std::transform(matrix.begin(), matrix.end(),
+                           matrices.begin() + b * dim * dim,
+                           [](const std::complex<Precision> &value) {
+                               return cuUtil::complexToCu(value);
+                           });
+        }
+        applyMatrices(matrices, wires, (num_matrices > 1) ? dim * dim : 0);
+    }
+
+    /**
+     * @brief Apply a list of named gates to all state-vectors of the batch.
+     *
+     * @param opNames Names of the gates.
+     * @param wires Wires of each gate.
+     * @param adjoints Adjoint flag of each gate.
+     * @param params Parameters of each gate for each state-vector, indexed as
+     * `params[op][batch]`. Empty for gates without parameters.
+     */
+    void applyOperations(
+        const std::vector<std::string> &opNames,
+        const std::vector<std::vector<std::size_t>> &wires,
+        const std::vector<bool> &adjoints,
+        const std::vector<std::vector<std::vector<Precision>>> &params) {
+        PL_ABORT_IF(opNames.size() != wires.size() ||
+                        opNames.size() != adjoints.size() ||
+                        opNames.size() != params.size(),
+                    "Incompatible number of ops, wires, adjoints and params");
+        for (std::size_t op = 0; op < opNames.size(); op++) {
+            applyOperation(opNames[op], wires[op], adjoints[op], params[op]);
+        }
+    }
+
+    /**
+     * @brief Expectation value of an observable, given as a tensor product
+     * of factors, for every state-vector of the batch.
+     *
+     * @param obsNames Name of each factor: a named gate such as "PauliZ", or
+     * "Hermitian" with its matrix in `matrices`.
+     * @param wires Wires of each factor.
+     * @param matrices Row-major matrix of each "Hermitian" factor. May be
+     * empty if there is none.
+     * @return std::vector<Precision> Expectation value of each state-vector.
+     */
+    auto expval(
+        const std::vector<std::string> &obsNames,
+        const std::vector<std::vector<std::size_t>> &wires,
+        const std::vector<std::vector<std::complex<Precision>>> &matrices = {})
+        -> std::vector<Precision> {
+        PL_ABORT_IF(obsNames.size() != wires.size(),
+                    "Incompatible number of observables and wires");
+
+        // Combine the factors into one matrix over the union of their wires
+        std::vector<std::size_t> obs_wires;
+        for (const auto &factor_wires : wires) {
+            for (const auto wire : factor_wires) {
+                PL_ABORT_IF(std::find(obs_wires.begin(), obs_wires.end(),
+                                      wire) != obs_wires.end(),
+                            "The factors of the observable must act on "
+                            "distinct wires.");
+                obs_wires.push_back(wire);
+            }
+        }
+        PL_ABORT_IF(obs_wires.size() > getMaxObservableWires(),
+                    "The observable acts on too many wires for the batched "
+                    "expectation value.");
+        const std::size_t dim = Util::exp2(obs_wires.size());
+        std::vector<std::complex<Precision>> matrix(dim * dim, {0, 0});
+        for (std::size_t i = 0; i < dim; i++) {
+            matrix[i * dim + i] = {1, 0};
+        }
+        std::size_t position = 0;
+        for (std::size_t f = 0; f < obsNames.size(); f++) {
+            const auto factor =
+                (obsNames[f] == "Hermitian")
+                    ? matrices.at(f)
+                    : getGateMatrix<Precision>(obsNames[f], {}, false);
+            PL_ABORT_IF(factor.size() != Util::exp2(2 * wires[f].size()),
+                        "Currently unsupported observable: " + obsNames[f]);
+            std::vector<std::size_t> positions(wires[f].size());
+            for (auto &pos : positions) {
+                pos = position++;
+            }
+            applyGateToMatrix(matrix, obs_wires.size(), factor, positions);
+        }
+
+        std::vector<CFP_t> matrix_cu(matrix.size());
+        std::transform(matrix.begin(), matrix.end(), matrix_cu.begin(),
+                       [](const std::complex<Precision> &value) {
+                           return cuUtil::complexToCu(value);
+                       });
+        auto &matrix_dev = getMatrixBuffer(matrix_cu.size());
+        matrix_dev.CopyHostDataToGpu(matrix_cu.data(), matrix_cu.size(), true);
+
+        if (moments_ == nullptr) {
+            moments_ = std::make_unique<DataBuffer<double>>(
+                2 * batch_size_, data_.getDevTag());
+        }
+        const auto tgts = getTargetBits(obs_wires);
+        PL_CUDA_IS_SUCCESS(computeBatchedMoments_CUDA(
+            data_.getData(), static_cast<unsigned int>(num_qubits_),
+            batch_size_, matrix_dev.getData(), tgts.data(),
+            static_cast<unsigned int>(tgts.size()), moments_->getData(),
+            getStream()));
+
+        std::vector<double> moments(2 * batch_size_);
+        moments_->CopyGpuDataToHost(moments.data(), moments.size(), true);
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(getStream()));
+        std::vector<Precision> expvals(batch_size_);
+        for (std::size_t b = 0; b < batch_size_; b++) {
+            expvals[b] = static_cast<Precision>(moments[2 * b]);
+        }
+        return expvals;
+    }
+
+    /**
+     * @brief Copy one state-vector of the batch to the host.
+     *
+     * @param batch_idx Index of the state-vector in the batch.
+     * @param host_out Host buffer of `getLength()` elements.
+     * @param length Length of `host_out`.
+     */
+    void CopyGpuDataToHost(std::size_t batch_idx,
+                           std::complex<Precision> *host_out,
+                           std::size_t length) const {
+        PL_ABORT_IF(batch_idx >= batch_size_, "Invalid batch index.");
+        PL_ABORT_IF(length != getLength(),
+                    "Sizes do not match for host & GPU data.");
+        PL_CUDA_IS_SUCCESS(
+            cudaMemcpyAsync(host_out, data_.getData() + batch_idx * length,
+                            sizeof(CFP_t) * length, cudaMemcpyDeviceToHost,
+                            getStream()));
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(getStream()));
+    }
+
+  private:
+    std::size_t num_qubits_;
+    std::size_t batch_size_;
+    DataBuffer<CFP_t> data_;
+    /// Gate and observable matrices, grown as needed.
+    std::unique_ptr<DataBuffer<CFP_t>> matrices_{nullptr};
+    std::unique_ptr<DataBuffer<double>> moments_{nullptr};
+
+    static auto checkBatchSize(std::size_t batch_size) -> std::size_t {
+        PL_ABORT_IF(batch_size == 0, "The batch must not be empty.");
+        PL_ABORT_IF(batch_size > max_batch_size,
+                    "The batch exceeds the largest supported batch size.");
+        return batch_size;
+    }
+
+    /**
+     * @brief Get a device buffer of at least `length` elements for matrices.
+     * Its previous content may still be read by queued kernels; copies into
+     * it must be ordered on the stream of the batch.
+     */
+    auto getMatrixBuffer(std::size_t length) -> DataBuffer<CFP_t> & {
+        if (matrices_ == nullptr || matrices_->getLength() < length) {
+            matrices_ =
+                std::make_unique<DataBuffer<CFP_t>>(length, data_.getDevTag());
+        }
+        return *matrices_;
+    }
+
+    /**
+     * @brief Index bits of a row-major matrix over `wires`, with matrix bit
+     * `i` acting on state-vector bit `tgts[i]`.
+     */
+    [[nodiscard]] auto getTargetBits(const std::vector<std::size_t> &wires)
+        const -> std::vector<int> {
+        std::vector<int> tgts(wires.size());
+        for (std::size_t i = 0; i < wires.size(); i++) {
+            // The first wire is the most significant bit of the matrix
+            tgts[i] = static_cast<int>(num_qubits_ - 1 -
+                                       wires[wires.size() - 1 - i]);
+        }
+        return tgts;
+    }
+
+    /**
+     * @brief Apply row-major matrices over `wires`, `matrix_stride` elements
+     * apart, to the state-vectors of the batch.
+     */
+    void applyMatrices(const std::vector<CFP_t> &matrices,
+                       const std::vector<std::size_t> &wires,
+                       std::size_t matrix_stride) {
+        PL_ABORT_IF(wires.size() > getMaxGateWires(),
+                    "The gate acts on too many wires for the batched "
+                    "state-vector.");
+        auto &matrix_dev = getMatrixBuffer(matrices.size());
+        PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+            matrix_dev.getData(), matrices.data(),
+            sizeof(CFP_t) * matrices.size(), cudaMemcpyHostToDevice,
+            getStream()));
+        const auto tgts = getTargetBits(wires);
+        PL_CUDA_IS_SUCCESS(applyBatchedMatrix_CUDA(
+            data_.getData(), static_cast<unsigned int>(num_qubits_),
+            batch_size_, matrix_dev.getData(), matrix_stride, tgts.data(),
+            static_cast<unsigned int>(tgts.size()), getStream()));
+    }
+};
+
+} // namespace Pennylane
@@ -0,0 +1,656 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file StateVectorCudaDistributed.hpp
+ */
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cuComplex.h> // cuDoubleComplex
+#include <cuda.h>
+#include <custatevec.h> // custatevecMultiDeviceSwapIndexBits
+
+#include "DevTag.hpp"
+#include "DevicePool.hpp"
+#include "DeviceWorkspace.hpp"
+#include "Error.hpp"
+#include "StateVectorCudaBase.hpp"
+#include "StateVectorCudaManaged.hpp"
+#include "cuda_helpers.hpp"
+
+/// @cond DEV
+namespace {
+namespace cuUtil = Pennylane::CUDA::Util;
+using namespace Pennylane::CUDA;
+using namespace Pennylane::Util;
+} // namespace
+/// @endcond
+
+namespace Pennylane {
+
+/**
+ * @brief CUDA state-vector class distributed over multiple devices.
+ *
+ * The state of `num_qubits` qubits is split into `2^g` sub-state-vectors of
+ * `num_qubits - g` qubits, one per device, where the `g` global wires are the
+ * most significant PL wires `0, ..., g-1`. Sub-state-vector `i` holds the
+ * amplitudes whose global wires read the bits of `i`.
+ *
+ * The class tracks which index bit of the whole state holds each wire.
+ * Gates and observables acting on wires held by local index bits are applied
+ * to every sub-state-vector directly. Those touching wires held by global
+ * index bits first exchange these bits with unused local ones via
+ * `custatevecMultiDeviceSwapIndexBits`, and leave the wires where they are
+ * afterwards, so consecutive operations on the same wires exchange data only
+ * once. The canonical layout above is restored by `restoreWireOrder`, which
+ * probabilities, samples and host copies call first.
+ *
+ * Whole-state accessors of `StateVectorCudaBase` (`getData`,
+ * `getDataBuffer`, ...) do not hold data for this class; use
+ * `getSubStateVector` and the copy methods below instead.
+ *
+ * @tparam Precision Floating-point precision type.
+ */
+template <class Precision>
+class StateVectorCudaDistributed
+    : public StateVectorCudaBase<Precision,
+                                 StateVectorCudaDistributed<Precision>> {
+  private:
+    using BaseType = StateVectorCudaBase<Precision, StateVectorCudaDistributed>;
+    using SubSVType = StateVectorCudaManaged<Precision>;
+
+  public:
+    using CFP_t =
+        typename StateVectorCudaBase<Precision,
+                                     StateVectorCudaDistributed>::CFP_t;
+
+    StateVectorCudaDistributed() = delete;
+
+    /**
+     * @brief Construct a distributed state-vector in the |0...0> state.
+     *
+     * @param num_qubits Total number of qubits.
+     * @param num_devices Number of devices to distribute over, which must be a
+     * power of 2. Defaults to the largest power of 2 not exceeding the number
+     * of available devices.
+     * @param network_type Interconnect topology between the devices.
+     */
+    StateVectorCudaDistributed(size_t num_qubits, size_t num_devices = 0,
+                               custatevecDeviceNetworkType_t network_type =
+                                   CUSTATEVEC_DEVICE_NETWORK_TYPE_SWITCH)
+        : StateVectorCudaBase<Precision, StateVectorCudaDistributed<Precision>>(
+              num_qubits, DevTag<int>{0, 0}, false),
+          network_type_{network_type} {
+        if (num_devices == 0) {
+            num_devices = Util::exp2(
+                Util::log2(DevicePool<int>::getTotalDevices()));
+        }
+        PL_ABORT_IF_NOT(num_devices > 0 &&
+                            (num_devices & (num_devices - 1)) == 0,
+                        "The number of devices must be a power of 2.");
+        PL_ABORT_IF(num_devices > DevicePool<int>::getTotalDevices(),
+                    "Not enough CUDA devices available.");
+
+        num_global_qubits_ = Util::log2(num_devices);
+        PL_ABORT_IF(num_qubits <= num_global_qubits_,
+                    "Each device must hold at least one local qubit.");
+        num_local_qubits_ = num_qubits - num_global_qubits_;
+
+        for (int i = 0; i < static_cast<int>(num_devices); i++) {
+            for (int j = 0; j < static_cast<int>(num_devices); j++) {
+                PL_ABORT_IF_NOT(cuUtil::enablePeerAccess(i, j),
+                                "Distributed state-vectors require peer "
+                                "access between all devices.");
+            }
+        }
+
+        int current_device;
+        PL_CUDA_IS_SUCCESS(cudaGetDevice(&current_device));
+        for (int dev = 0; dev < static_cast<int>(num_devices); dev++) {
+            const DevTag<int> dev_tag{dev, 0};
+            sub_svs_.emplace_back(
+                std::make_unique<SubSVType>(num_local_qubits_, dev_tag));
+            workspaces_.emplace_back(
+                std::make_unique<DeviceWorkspace<int>>(dev_tag));
+        }
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(current_device));
+        initSV();
+    }
+
+    ~StateVectorCudaDistributed() = default;
+
+    [[nodiscard]] auto getNumDevices() const -> std::size_t {
+        return sub_svs_.size();
+    }
+    [[nodiscard]] auto getNumGlobalQubits() const -> std::size_t {
+        return num_global_qubits_;
+    }
+    [[nodiscard]] auto getNumLocalQubits() const -> std::size_t {
+        return num_local_qubits_;
+    }
+
+    /**
+     * @brief Get the sub-state-vector held by the given device. Its wires
+     * follow the canonical layout only after `restoreWireOrder`.
+     *
+     * @param idx Index of the sub-state-vector, equal to its device index.
+     */
+    [[nodiscard]] auto getSubStateVector(std::size_t idx) -> SubSVType & {
+        return *sub_svs_.at(idx);
+    }
+    [[nodiscard]] auto getSubStateVector(std::size_t idx) const
+        -> const SubSVType & {
+        return *sub_svs_.at(idx);
+    }
+
+    /**
+     * @brief Initialize the statevector data to the |0...0> state
+     */
+    void initSV() {
+        const auto sub_length = Util::exp2(num_local_qubits_);
+        const CFP_t one = cuUtil::ONE<CFP_t>();
+        forEachSubSV([&](std::size_t idx, SubSVType &sv) {
+            PL_CUDA_IS_SUCCESS(cudaMemsetAsync(sv.getData(), 0,
+                                               sizeof(CFP_t) * sub_length,
+                                               sv.getStream()));
+            if (idx == 0) {
+                // The pageable source is staged before the call returns
+                PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+                    sv.getData(), &one, sizeof(CFP_t),
+                    cudaMemcpyHostToDevice, sv.getStream()));
+            }
+            sv.markModified();
+        });
+        resetWireOrder();
+    }
+
+    /**
+     * @brief Bring every wire back to its canonical index bit, exchanging
+     * data between the devices as needed.
+     */
+    void restoreWireOrder() {
+        const auto num_qubits = BaseType::getNumQubits();
+        // Global index bits first, as only they require exchanges
+        for (std::size_t bit = num_local_qubits_; bit < num_qubits; bit++) {
+            auto src = wire_bits_[num_qubits - 1 - bit];
+            if (src == bit) {
+                continue;
+            }
+            if (src >= num_local_qubits_) {
+                // Global bits are only swapped with local ones
+                swapIndexBits({{static_cast<int>(src), 0}});
+                src = 0;
+            }
+            swapIndexBits({{static_cast<int>(bit), static_cast<int>(src)}});
+        }
+
+        std::vector<int2> local_swaps;
+        for (std::size_t bit = 0; bit < num_local_qubits_; bit++) {
+            const auto src = wire_bits_[num_qubits - 1 - bit];
+            if (src != bit) {
+                local_swaps.push_back(
+                    {static_cast<int>(bit), static_cast<int>(src)});
+                updateWireOrder(local_swaps.back());
+            }
+        }
+        if (local_swaps.empty()) {
+            return;
+        }
+        forEachSubSV([&](std::size_t, SubSVType &sv) {
+            // Swaps are applied one by one, in the order they were found
+            for (const auto &swap : local_swaps) {
+                PL_CUSTATEVEC_IS_SUCCESS(custatevecSwapIndexBits(
+                    /* custatevecHandle_t */ sv.getCusvHandle(),
+                    /* void* */ sv.getData(),
+                    /* cudaDataType_t */ getDataType(),
+                    /* const uint32_t */ num_local_qubits_,
+                    /* const int2* */ &swap,
+                    /* const uint32_t */ 1,
+                    /* const int32_t* */ nullptr,
+                    /* const int32_t* */ nullptr,
+                    /* const uint32_t */ 0));
+            }
+            sv.markModified();
+        });
+    }
+
+    /**
+     * @brief Explicitly copy data from host memory to the devices.
+     *
+     * @param host_sv Complex data pointer to array.
+     * @param length Number of complex elements.
+     */
+    void CopyHostDataToGpu(const std::complex<Precision> *host_sv,
+                           std::size_t length) {
+        PL_ABORT_IF_NOT(BaseType::getLength() == length,
+                        "Sizes do not match for Host and GPU data");
+        const auto sub_length = Util::exp2(num_local_qubits_);
+        forEachSubSV([&](std::size_t idx, SubSVType &sv) {
+            sv.CopyHostDataToGpu(host_sv + idx * sub_length, sub_length,
+                                 false);
+        });
+        // The whole state is overwritten in the canonical layout
+        resetWireOrder();
+    }
+
+    /**
+     * @brief Explicitly copy data from the devices to host memory.
+     *
+     * @param host_sv Complex data pointer to receive data from the devices.
+     * @param length Number of complex elements.
+     */
+    void CopyGpuDataToHost(std::complex<Precision> *host_sv,
+                           std::size_t length) {
+        PL_ABORT_IF_NOT(BaseType::getLength() == length,
+                        "Sizes do not match for Host and GPU data");
+        restoreWireOrder();
+        const auto sub_length = Util::exp2(num_local_qubits_);
+        forEachSubSV([&](std::size_t idx, const SubSVType &sv) {
+            sv.CopyGpuDataToHost(host_sv + idx * sub_length, sub_length,
+                                 false);
+        });
+    }
+
+    /**
+     * @brief Apply a single gate to the state-vector. See
+     * `StateVectorCudaManaged::applyOperation`.
+     *
+     * @param opName Name of gate to apply.
+     * @param wires Wires to apply gate to.
+     * @param adjoint Indicates whether to use adjoint of gate.
+     * @param params Optional parameter list for parametric gates.
+     * @param gate_matrix Optional gate matrix, used if the gate is not known.
+     */
+    void applyOperation(const std::string &opName,
+                        const std::vector<size_t> &wires, bool adjoint = false,
+                        const std::vector<Precision> &params = {0.0},
+                        const std::vector<CFP_t> &gate_matrix = {}) {
+        const auto local_wires = localizeWires(wires);
+        forEachSubSV([&](std::size_t, SubSVType &sv) {
+            sv.applyOperation(opName, local_wires, adjoint, params,
+                              gate_matrix);
+        });
+    }
+
+    /**
+     * @brief Multi-op variant of `applyOperation`.
+     *
+     * @param opNames
+     * @param wires
+     * @param adjoints
+     * @param params
+     */
+    void applyOperation(const std::vector<std::string> &opNames,
+                        const std::vector<std::vector<size_t>> &wires,
+                        const std::vector<bool> &adjoints,
+                        const std::vector<std::vector<Precision>> &params) {
+        PL_ABORT_IF(opNames.size() != wires.size(),
+                    "Incompatible number of ops and wires");
+        PL_ABORT_IF(opNames.size() != adjoints.size(),
+                    "Incompatible number of ops and adjoints");
+        const auto num_ops = opNames.size();
+        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
+            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx],
+                           params[op_idx]);
+        }
+    }
+
+    /**
+     * @brief Multi-op variant of `applyOperation`.
+     *
+     * @param opNames
+     * @param wires
+     * @param adjoints
+     */
+    void applyOperation(const std::vector<std::string> &opNames,
+                        const std::vector<std::vector<size_t>> &wires,
+                        const std::vector<bool> &adjoints) {
+        PL_ABORT_IF(opNames.size() != wires.size(),
+                    "Incompatible number of ops and wires");
+        PL_ABORT_IF(opNames.size() != adjoints.size(),
+                    "Incompatible number of ops and adjoints");
+        const auto num_ops = opNames.size();
+        for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
+            applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx]);
+        }
+    }
+
+    /**
+     * @brief Utility method for expectation value calculations. See
+     * `StateVectorCudaManaged::expval`.
+     *
+     * @param obsName String label for observable.
+     * @param wires Target wires for expectation value.
+     * @param params Parameters for a parametric gate.
+     * @param gate_matrix Optional matrix for observable.
+     * @return auto Expectation value.
+     */
+    auto expval(const std::string &obsName, const std::vector<size_t> &wires,
+                const std::vector<Precision> &params = {0.0},
+                const std::vector<CFP_t> &gate_matrix = {}) {
+        return expvalDistributed(obsName, wires, params, gate_matrix);
+    }
+    /**
+     * @brief See `expval(const std::string &obsName, const std::vector<size_t>
+     &wires, const std::vector<Precision> &params = {0.0}, const
+     std::vector<CFP_t> &gate_matrix = {})`
+     */
+    auto expval(const std::string &obsName, const std::vector<size_t> &wires,
+                const std::vector<Precision> &params = {0.0},
+                const std::vector<std::complex<Precision>> &gate_matrix = {}) {
+        return expvalDistributed(obsName, wires, params, gate_matrix);
+    }
+
+    /**
+     * @brief Utility method for probability calculation using given wires.
+     *
+     * Each device reduces its sub-state-vector over the requested local wires;
+     * the global wires are fixed per device, so once the canonical layout is
+     * restored no data is exchanged.
+     *
+     * @param wires List of wires to return probabilities for in lexicographical
+     * order.
+     * @return std::vector<double>
+     */
+    auto probability(const std::vector<size_t> &wires) -> std::vector<double> {
+        restoreWireOrder();
+        std::vector<size_t> sub_wires;
+        std::vector<size_t> sub_positions;
+        for (std::size_t k = 0; k < wires.size(); k++) {
+            if (wires[k] >= num_global_qubits_) {
+                sub_wires.push_back(wires[k] - num_global_qubits_);
+                sub_positions.push_back(wires.size() - 1 - k);
+            }
+        }
+
+        std::vector<double> probabilities(Util::exp2(wires.size()), 0);
+        forEachSubSV([&](std::size_t idx, SubSVType &sv) {
+            // Output bits fixed by the global wires held by this device
+            std::size_t global_offset = 0;
+            for (std::size_t k = 0; k < wires.size(); k++) {
+                if (wires[k] < num_global_qubits_) {
+                    const auto bit =
+                        (idx >> (num_global_qubits_ - 1 - wires[k])) & 1U;
+                    global_offset |= bit << (wires.size() - 1 - k);
+                }
+            }
+            const auto sub_probs = sv.probability(sub_wires);
+            for (std::size_t j = 0; j < sub_probs.size(); j++) {
+                std::size_t out_idx = global_offset;
+                for (std::size_t m = 0; m < sub_wires.size(); m++) {
+                    const auto bit = (j >> (sub_wires.size() - 1 - m)) & 1U;
+                    out_idx |= bit << sub_positions[m];
+                }
+                probabilities[out_idx] += sub_probs[j];
+            }
+        });
+        return probabilities;
+    }
+
+    /**
+     * @brief Utility method for samples. See
+     * `StateVectorCudaManaged::generate_samples`.
+     *
+     * The random numbers are sorted and split over the devices by the norms of
+     * their sub-state-vectors; each device samples its share with
+     * `custatevecSamplerApplySubSVOffset` placing it within the whole state.
+     *
+     * @param num_samples Number of Samples
+     *
+     * @return std::vector<size_t> A 1-d array storing the samples.
+     */
+    auto generate_samples(size_t num_samples) -> std::vector<size_t> {
+        restoreWireOrder();
+        const size_t num_qubits = BaseType::getNumQubits();
+        const auto num_sub_svs = sub_svs_.size();
+
+        std::vector<double> norms(num_sub_svs);
+        forEachSubSV([&](std::size_t idx, SubSVType &sv) {
+            norms[idx] = sv.probability({}).front();
+        });
+        std::vector<double> offsets(num_sub_svs + 1, 0);
+        std::partial_sum(norms.begin(), norms.end(), offsets.begin() + 1);
+        const double total_norm = offsets.back();
+
+        std::vector<double> rand_nums(num_samples);
+        std::mt19937 gen(std::random_device{}());
+        std::uniform_real_distribution<Precision> dis(0.0, 1.0);
+        for (size_t n = 0; n < num_samples; n++) {
+            rand_nums[n] = dis(gen);
+        }
+        std::sort(rand_nums.begin(), rand_nums.end());
+
+        std::vector<int> bitOrdering(num_local_qubits_);
+        std::iota(std::begin(bitOrdering), std::end(bitOrdering), 0);
+        std::vector<custatevecIndex_t> bitStrings(num_samples);
+
+        forEachSubSV([&](std::size_t idx, SubSVType &sv) {
+            const auto first = std::lower_bound(rand_nums.begin(),
+                                                rand_nums.end(),
+                                                offsets[idx] / total_norm);
+            const auto last =
+                (idx + 1 == num_sub_svs)
+                    ? rand_nums.end()
+                    : std::lower_bound(first, rand_nums.end(),
+                                       offsets[idx + 1] / total_norm);
+            const auto num_sub_samples =
+                static_cast<std::size_t>(std::distance(first, last));
+            if (num_sub_samples == 0) {
+                return;
+            }
+            const auto sample_offset =
+                static_cast<std::size_t>(first - rand_nums.begin());
+
+            custatevecSamplerDescriptor_t sampler;
+            size_t extraWorkspaceSizeInBytes = 0;
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerCreate(
+                sv.getCusvHandle(), sv.getData(), getDataType(),
+                num_local_qubits_, &sampler, num_sub_samples,
+                &extraWorkspaceSizeInBytes));
+            void *extraWorkspace =
+                workspaces_[idx]->getWorkspace(extraWorkspaceSizeInBytes);
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerPreprocess(
+                sv.getCusvHandle(), sampler, extraWorkspace,
+                extraWorkspaceSizeInBytes));
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerApplySubSVOffset(
+                sv.getCusvHandle(), sampler, static_cast<int32_t>(idx),
+                num_sub_svs, offsets[idx], total_norm));
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerSample(
+                sv.getCusvHandle(), sampler,
+                bitStrings.data() + sample_offset, bitOrdering.data(),
+                num_local_qubits_, rand_nums.data() + sample_offset,
+                num_sub_samples, CUSTATEVEC_SAMPLER_OUTPUT_ASCENDING_ORDER));
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerDestroy(sampler));
+
+            for (std::size_t i = sample_offset;
+                 i < sample_offset + num_sub_samples; i++) {
+                bitStrings[i] |= static_cast<custatevecIndex_t>(idx)
+                                 << num_local_qubits_;
+            }
+        });
+
+        std::vector<size_t> samples(num_samples * num_qubits, 0);
+        for (size_t i = 0; i < num_samples; i++) {
+            const auto idx = bitStrings[i];
+            for (size_t j = 0; j < num_qubits; j++) {
+                samples[i * num_qubits + (num_qubits - 1 - j)] =
+                    (idx >> j) & 1U;
+            }
+        }
+        return samples;
+    }
+
+  private:
+    std::size_t num_global_qubits_;
+    std::size_t num_local_qubits_;
+    custatevecDeviceNetworkType_t network_type_;
+    std::vector<std::unique_ptr<SubSVType>> sub_svs_;
+    std::vector<std::unique_ptr<DeviceWorkspace<int>>> workspaces_;
+    /// Index bit of the whole state holding each PL wire.
+    std::vector<std::size_t> wire_bits_;
+    /// PL wire held by each index bit of the whole state.
+    std::vector<std::size_t> bit_wires_;
+
+    static constexpr auto getDataType() -> cudaDataType_t {
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            return CUDA_C_64F;
+        } else {
+            return CUDA_C_32F;
+        }
+    }
+
+    /**
+     * @brief Run `f(idx, sub_sv)` for every sub-state-vector, with its device
+     * selected.
+     */
+    template <class F> void forEachSubSV(F &&f) {
+        for (std::size_t idx = 0; idx < sub_svs_.size(); idx++) {
+            cuUtil::CudaScopedDevice scoped_device(
+                sub_svs_[idx]->getDataBuffer().getDevTag().getDeviceID());
+            f(idx, *sub_svs_[idx]);
+        }
+    }
+
+    /**
+     * @brief Place every wire on its canonical index bit, without moving any
+     * data.
+     */
+    void resetWireOrder() {
+        const auto num_qubits = BaseType::getNumQubits();
+        wire_bits_.resize(num_qubits);
+        bit_wires_.resize(num_qubits);
+        for (std::size_t wire = 0; wire < num_qubits; wire++) {
+            wire_bits_[wire] = num_qubits - 1 - wire;
+            bit_wires_[num_qubits - 1 - wire] = wire;
+        }
+    }
+
+    /**
+     * @brief Record the exchange of the wires held by two index bits.
+     */
+    void updateWireOrder(const int2 &swap) {
+        const auto bit0 = static_cast<std::size_t>(swap.x);
+        const auto bit1 = static_cast<std::size_t>(swap.y);
+        std::swap(bit_wires_[bit0], bit_wires_[bit1]);
+        wire_bits_[bit_wires_[bit0]] = bit0;
+        wire_bits_[bit_wires_[bit1]] = bit1;
+    }
+
+    /**
+     * @brief Map PL wires to sub-state-vector wires, first moving the wires
+     * held by global index bits onto local bits not used by the operation.
+     * The moved wires stay on their new bits.
+     *
+     * @param wires PL wires of the operation.
+     * @return Sub-state-vector wires of the operation.
+     */
+    auto localizeWires(const std::vector<size_t> &wires)
+        -> std::vector<size_t> {
+        std::vector<bool> used(num_local_qubits_, false);
+        for (const auto wire : wires) {
+            if (wire_bits_[wire] < num_local_qubits_) {
+                used[wire_bits_[wire]] = true;
+            }
+        }
+
+        std::vector<int2> swaps;
+        // Pick free bits starting from the least significant ones
+        std::size_t candidate = 0;
+        for (const auto wire : wires) {
+            if (wire_bits_[wire] < num_local_qubits_) {
+                continue;
+            }
+            while (candidate < num_local_qubits_ && used[candidate]) {
+                candidate++;
+            }
+            PL_ABORT_IF(candidate == num_local_qubits_,
+                        "Not enough local qubits to apply the operation.");
+            used[candidate] = true;
+            swaps.push_back({static_cast<int>(wire_bits_[wire]),
+                             static_cast<int>(candidate)});
+        }
+        swapIndexBits(swaps);
+
+        std::vector<size_t> local_wires(wires.size());
+        for (std::size_t k = 0; k < wires.size(); k++) {
+            local_wires[k] = num_local_qubits_ - 1 - wire_bits_[wires[k]];
+        }
+        return local_wires;
+    }
+
+    /**
+     * @brief Exchange index bits between the global and local ranges of the
+     * distributed state, and record the new position of the wires.
+     *
+     * @param swaps Pairs of (global, local) index bits.
+     */
+    void swapIndexBits(const std::vector<int2> &swaps) {
+        if (swaps.empty()) {
+            return;
+        }
+        std::vector<custatevecHandle_t> handles;
+        std::vector<void *> sub_data;
+        forEachSubSV([&](std::size_t, SubSVType &sv) {
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(sv.getStream()));
+            handles.push_back(sv.getCusvHandle());
+            sub_data.push_back(sv.getData());
+        });
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecMultiDeviceSwapIndexBits(
+            /* custatevecHandle_t* */ handles.data(),
+            /* const uint32_t */ handles.size(),
+            /* void** */ sub_data.data(),
+            /* const cudaDataType_t */ getDataType(),
+            /* const uint32_t */ num_global_qubits_,
+            /* const uint32_t */ num_local_qubits_,
+            /* const int2* */ swaps.data(),
+            /* const uint32_t */ swaps.size(),
+            /* const int32_t* */ nullptr,
+            /* const int32_t* */ nullptr,
+            /* const uint32_t */ 0,
+            /* const custatevecDeviceNetworkType_t */ network_type_));
+        forEachSubSV([&](std::size_t, SubSVType &sv) {
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(sv.getStream()));
+            sv.markModified();
+        });
+        for (const auto &swap : swaps) {
+            updateWireOrder(swap);
+        }
+    }
+
+    template <class MatrixT>
+    auto expvalDistributed(const std::string &obsName,
+                           const std::vector<size_t> &wires,
+                           const std::vector<Precision> &params,
+                           const std::vector<MatrixT> &gate_matrix) -> CFP_t {
+        const auto local_wires = localizeWires(wires);
+        CFP_t expect = cuUtil::ZERO<CFP_t>();
+        forEachSubSV([&](std::size_t, SubSVType &sv) {
+            const CFP_t sub_expect =
+                sv.expval(obsName, local_wires, params, gate_matrix);
+            expect.x += sub_expect.x;
+            expect.y += sub_expect.y;
+        });
+        return expect;
+    }
+};
+
+}; // namespace Pennylane
@@ -16,6 +16,8 @@
  */
 #pragma once
 
+#include <array>
+#include <limits>
 #include <random>
 #include <unordered_map>
 #include <unordered_set>
@@ -25,8 +27,14 @@
 #include <cuda.h>
 #include <custatevec.h> // custatevecApplyMatrix
 
+#include "CompiledOps.hpp"
 #include "Constant.hpp"
+#include "CudaGraph.hpp"
+#include "DeviceContext.hpp"
+#include "DeviceWorkspace.hpp"
 #include "Error.hpp"
+#include "GateFusion.hpp"
+#include "NvtxRange.hpp"
 #include "StateVectorCudaBase.hpp"
 #include "cuGateCache.hpp"
 #include "cuGates_host.hpp"
@@ -42,6 +50,80 @@ using namespace Pennylane::Util;
 
 namespace Pennylane {
 
+// Kernel launchers defined in gateMatrices.cu
+extern cudaError_t generateExcitationMatrix_CUDA(cuComplex *matrix,
+                                                 unsigned int dim,
+                                                 unsigned int lo,
+                                                 unsigned int hi, float c,
+                                                 float s, cuComplex e,
+                                                 cudaStream_t stream);
+extern cudaError_t
+generateExcitationMatrix_CUDA(cuDoubleComplex *matrix, unsigned int dim,
+                              unsigned int lo, unsigned int hi, double c,
+                              double s, cuDoubleComplex e,
+                              cudaStream_t stream);
+
+// Kernel launchers defined in measurementKernels.cu
+extern unsigned int getMaxMomentWires_CUDA();
+extern cudaError_t computeChunkProbabilities_CUDA(const cuComplex *sv,
+                                                  std::size_t length,
+                                                  std::size_t chunk_size,
+                                                  double *chunk_cdf,
+                                                  cudaStream_t stream);
+extern cudaError_t computeChunkProbabilities_CUDA(const cuDoubleComplex *sv,
+                                                  std::size_t length,
+                                                  std::size_t chunk_size,
+                                                  double *chunk_cdf,
+                                                  cudaStream_t stream);
+extern cudaError_t
+sampleIndices_CUDA(const cuComplex *sv, std::size_t length,
+                   std::size_t chunk_size, const double *chunk_cdf,
+                   const double *uniforms, std::size_t num_samples,
+                   unsigned long long *indices, cudaStream_t stream);
+extern cudaError_t
+sampleIndices_CUDA(const cuDoubleComplex *sv, std::size_t length,
+                   std::size_t chunk_size, const double *chunk_cdf,
+                   const double *uniforms, std::size_t num_samples,
+                   unsigned long long *indices, cudaStream_t stream);
+extern cudaError_t unpackSamples_CUDA(const unsigned long long *indices,
+                                      std::size_t num_samples,
+                                      unsigned int num_qubits,
+                                      unsigned char *bits,
+                                      cudaStream_t stream);
+extern cudaError_t countSamples_CUDA(unsigned long long *indices,
+                                     std::size_t num_samples,
+                                     unsigned long long *unique_indices,
+                                     unsigned long long *counts,
+                                     std::size_t *num_unique,
+                                     cudaStream_t stream);
+extern cudaError_t computeMoments_CUDA(const cuComplex *sv,
+                                       unsigned int num_qubits,
+                                       const cuComplex *matrix,
+                                       const int *tgts, unsigned int num_tgts,
+                                       double *result, cudaStream_t stream);
+extern cudaError_t
+computeMoments_CUDA(const cuDoubleComplex *sv, unsigned int num_qubits,
+                    const cuDoubleComplex *matrix, const int *tgts,
+                    unsigned int num_tgts, double *result, cudaStream_t stream);
+extern cudaError_t innerProdsMixed_CUDA(const cuComplex *vecs,
+                                        const cuComplex *v,
+                                        std::size_t data_size,
+                                        std::size_t num_vecs,
+                                        cuDoubleComplex *result,
+                                        cudaStream_t stream);
+
+// Kernel launchers defined in diagonalKernels.cu
+extern cudaError_t applyDiagonalGenerator_CUDA(cuComplex *sv,
+                                               std::size_t length,
+                                               std::size_t z_mask,
+                                               std::size_t projector_mask,
+                                               cudaStream_t stream);
+extern cudaError_t applyDiagonalGenerator_CUDA(cuDoubleComplex *sv,
+                                               std::size_t length,
+                                               std::size_t z_mask,
+                                               std::size_t projector_mask,
+                                               cudaStream_t stream);
+
 /**
  * @brief Managed memory CUDA state-vector class using custateVec backed
  * gate-calls.
@@ -64,55 +146,78 @@ class StateVectorCudaManaged
     StateVectorCudaManaged(size_t num_qubits)
         : StateVectorCudaBase<Precision, StateVectorCudaManaged<Precision>>(
               num_qubits),
-          gate_cache_(true) {
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(
-            /* custatevecHandle_t* */ &handle));
+          gate_cache_(false) {
+        bindDeviceContext();
     };
 
     StateVectorCudaManaged(size_t num_qubits, const DevTag<int> &dev_tag,
                            bool alloc = true)
         : StateVectorCudaBase<Precision, StateVectorCudaManaged<Precision>>(
               num_qubits, dev_tag, alloc),
-          gate_cache_(true, dev_tag) {
+          gate_cache_(false, dev_tag) {
+        bindDeviceContext();
         BaseType::initSV();
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(
-            /* custatevecHandle_t* */ &handle));
     };
 
+    /**
+     * @brief Construct a state-vector view over existing device memory. No
+     * data is copied or initialized, and the memory is not freed on
+     * destruction.
+     *
+     * @param num_qubits Number of qubits.
+     * @param gpu_data Device pointer to 2^num_qubits elements.
+     * @param dev_tag Device tag of the device holding `gpu_data`.
+     */
+    StateVectorCudaManaged(size_t num_qubits, CFP_t *gpu_data,
+                           const DevTag<int> &dev_tag)
+        : StateVectorCudaBase<Precision, StateVectorCudaManaged<Precision>>(
+              num_qubits, gpu_data, dev_tag),
+          gate_cache_(false, dev_tag) {
+        bindDeviceContext();
+    }
+
     StateVectorCudaManaged(const CFP_t *gpu_data, size_t length)
         : StateVectorCudaManaged(Util::log2(length)) {
         BaseType::CopyGpuDataToGpuIn(gpu_data, length, false);
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(
-            /* custatevecHandle_t* */ &handle));
     }
 
     StateVectorCudaManaged(const CFP_t *gpu_data, size_t length,
                            DevTag<int> dev_tag)
         : StateVectorCudaManaged(Util::log2(length), dev_tag) {
         BaseType::CopyGpuDataToGpuIn(gpu_data, length, false);
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(
-            /* custatevecHandle_t* */ &handle));
     }
 
     StateVectorCudaManaged(const std::complex<Precision> *host_data,
                            size_t length)
         : StateVectorCudaManaged(Util::log2(length)) {
         BaseType::CopyHostDataToGpu(host_data, length, false);
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(
-            /* custatevecHandle_t* */ &handle));
+    }
+
+    StateVectorCudaManaged(const std::complex<Precision> *host_data,
+                           size_t length, const DevTag<int> &dev_tag)
+        : StateVectorCudaManaged(Util::log2(length), dev_tag) {
+        BaseType::CopyHostDataToGpu(host_data, length, false);
     }
 
     StateVectorCudaManaged(const StateVectorCudaManaged &other)
         : StateVectorCudaManaged(other.getNumQubits(),
                                  other.getDataBuffer().getDevTag()) {
         BaseType::CopyGpuDataToGpuIn(other);
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecCreate(
-            /* custatevecHandle_t* */ &handle));
     }
 
     ~StateVectorCudaManaged() {
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecDestroy(
-            /* custatevecHandle_t */ handle));
+        if (sampler_ != nullptr) {
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerDestroy(sampler_));
+        }
+        if (rng_ != nullptr) {
+            PL_CURAND_IS_SUCCESS(curandDestroyGenerator(rng_));
+        }
+        if (capture_stream_ != nullptr) {
+            DeviceContext<Precision>::getInstance(
+                BaseType::getDataBuffer().getDevTag().getDeviceID())
+                .releaseHandle(capture_stream_);
+            PL_CUDA_IS_SUCCESS(cudaStreamDestroy(capture_stream_));
+        }
     }
 
     /**
@@ -130,6 +235,7 @@ class StateVectorCudaManaged
         const std::string &opName, const std::vector<size_t> &wires,
         bool adjoint = false, const std::vector<Precision> &params = {0.0},
         [[maybe_unused]] const std::vector<CFP_t> &gate_matrix = {}) {
+        PL_NVTX_RANGE(opName.c_str());
         const auto ctrl_offset = (BaseType::getCtrlMap().find(opName) !=
                                   BaseType::getCtrlMap().end())
                                      ? BaseType::getCtrlMap().at(opName)
@@ -211,10 +317,15 @@ class StateVectorCudaManaged
                         const std::vector<std::vector<size_t>> &wires,
                         const std::vector<bool> &adjoints,
                         const std::vector<std::vector<Precision>> &params) {
+        PL_NVTX_RANGE("applyOperations");
         PL_ABORT_IF(opNames.size() != wires.size(),
                     "Incompatible number of ops and wires");
         PL_ABORT_IF(opNames.size() != adjoints.size(),
                     "Incompatible number of ops and adjoints");
+        if (fusion_max_width_ > 1) {
+            applyFusedOperations(opNames, wires, adjoints, params);
+            return;
+        }
         const auto num_ops = opNames.size();
         for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
             applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx],
@@ -235,16 +346,205 @@ class StateVectorCudaManaged
     void applyOperation(const std::vector<std::string> &opNames,
                         const std::vector<std::vector<size_t>> &wires,
                         const std::vector<bool> &adjoints) {
+        PL_NVTX_RANGE("applyOperations");
         PL_ABORT_IF(opNames.size() != wires.size(),
                     "Incompatible number of ops and wires");
         PL_ABORT_IF(opNames.size() != adjoints.size(),
                     "Incompatible number of ops and adjoints");
+        if (fusion_max_width_ > 1) {
+            applyFusedOperations(opNames, wires, adjoints, {});
+            return;
+        }
         const auto num_ops = opNames.size();
         for (std::size_t op_idx = 0; op_idx < num_ops; op_idx++) {
             applyOperation(opNames[op_idx], wires[op_idx], adjoints[op_idx]);
         }
     }
 
+    /**
+     * @brief Enable gate fusion for the multi-op `applyOperation` calls.
+     *
+     * Runs of consecutive gates acting on at most `max_width` wires in total
+     * are merged on the host into one dense matrix (see `fuseOperations`),
+     * and applied with a single custatevec call, reading and writing the
+     * state once per run instead of once per gate. Gates that do not fuse
+     * with a neighbour keep their native implementation.
+     *
+     * @param max_width Maximum number of wires of a fused gate. Values of 0
+     * or 1 disable fusion. Widths of 2 to 5 usually pay off; the cost of
+     * building a fused matrix grows as 4^max_width.
+     */
+    void setFusionMaxWidth(std::size_t max_width) {
+        PL_ABORT_IF(max_width > BaseType::getNumQubits() && max_width > 1,
+                    "The fused gate width exceeds the number of qubits.");
+        fusion_max_width_ = max_width;
+    }
+
+    /**
+     * @brief Get the maximum number of wires of a fused gate, or 0 if gate
+     * fusion is disabled.
+     */
+    [[nodiscard]] auto getFusionMaxWidth() const -> std::size_t {
+        return fusion_max_width_;
+    }
+
+    /**
+     * @brief Accumulate the reductions of a single-precision state-vector in
+     * double precision.
+     *
+     * The state is still stored and updated in complex64. Expectation values
+     * computed by custatevec then use `CUSTATEVEC_COMPUTE_64F` with a
+     * complex128 copy of the observable matrix, and inner products use double
+     * accumulators. Probabilities and the fused moments of `expvalAndVar` are
+     * always reduced in double precision. No effect in double precision.
+     *
+     * @param mixed_precision Use double-precision reductions.
+     */
+    void setMixedPrecision(bool mixed_precision) {
+        mixed_precision_ = mixed_precision;
+    }
+
+    /**
+     * @brief Indicate whether reductions are accumulated in double precision.
+     */
+    [[nodiscard]] auto getMixedPrecision() const -> bool {
+        return mixed_precision_ || std::is_same_v<Precision, double>;
+    }
+
+    /**
+     * @brief Lower a list of operations for replay on this state-vector with
+     * `applyCompiledOperations`. Gate names are resolved, wires converted,
+     * and gate matrices uploaded once, so replaying the list does no host
+     * allocation. The list can be replayed on any state-vector with the same
+     * number of qubits on the same device.
+     *
+     * @param opNames Names of the operations.
+     * @param wires Wires of each operation.
+     * @param adjoints Adjoint flag of each operation.
+     * @param params Parameters of each operation.
+     * @param matrices Optional matrix of each operation, used for gates
+     * without a known matrix.
+     * @return CompiledOps<Precision> Compiled operation list.
+     */
+    auto compileOperations(
+        const std::vector<std::string> &opNames,
+        const std::vector<std::vector<size_t>> &wires,
+        const std::vector<bool> &adjoints,
+        const std::vector<std::vector<Precision>> &params,
+        const std::vector<std::vector<std::complex<Precision>>> &matrices = {})
+        -> CompiledOps<Precision> {
+        CompiledOps<Precision> ops(BaseType::getNumQubits(),
+                                   BaseType::getDataBuffer().getDevTag(),
+                                   opNames, wires, adjoints, params, matrices);
+
+        // Size the workspace once, for the largest matrix of the list
+        const auto types = getCudaTypes();
+        std::size_t workspace_size = 0;
+        for (const auto &kernel : ops.getKernels()) {
+            if (kernel.type != CompiledOps<Precision>::KernelType::Matrix) {
+                continue;
+            }
+            std::size_t kernel_size = 0;
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrixGetWorkspaceSize(
+                /* custatevecHandle_t */ handle,
+                /* cudaDataType_t */ types.first,
+                /* const uint32_t */ BaseType::getNumQubits(),
+                /* const void* */ ops.getMatrix(kernel),
+                /* cudaDataType_t */ types.first,
+                /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+                /* const int32_t */ kernel.adjoint,
+                /* const uint32_t */ kernel.num_targets,
+                /* const uint32_t */ kernel.num_controls,
+                /* custatevecComputeType_t */ types.second,
+                /* size_t* */ &kernel_size));
+            workspace_size = std::max(workspace_size, kernel_size);
+        }
+        ops.setWorkspaceSize(workspace_size);
+        return ops;
+    }
+
+    /**
+     * @brief Apply a single operation of a compiled list.
+     *
+     * @param ops Compiled operation list.
+     * @param op_idx Index of the operation to apply.
+     * @param adjoint Apply the adjoint of the operation.
+     */
+    void applyCompiledOperation(const CompiledOps<Precision> &ops,
+                                std::size_t op_idx, bool adjoint = false) {
+        checkCompiledOps(ops);
+        void *workspace = workspace_.getWorkspace(ops.getWorkspaceSize());
+        applyCompiledOp(ops, op_idx, adjoint, workspace, handle);
+    }
+
+    /**
+     * @brief Apply all operations of a compiled list, or their adjoints in
+     * reverse order.
+     *
+     * @param ops Compiled operation list.
+     * @param adjoint Apply the adjoint of the whole list.
+     */
+    void applyCompiledOperations(const CompiledOps<Precision> &ops,
+                                 bool adjoint = false) {
+        checkCompiledOps(ops);
+        void *workspace = workspace_.getWorkspace(ops.getWorkspaceSize());
+        if (use_graphs_ && ops.getNumOps() > 0) {
+            applyCompiledGraph(ops, adjoint, workspace);
+            return;
+        }
+        issueCompiledOps(ops, adjoint, workspace, handle);
+    }
+
+    /**
+     * @brief Replay `applyCompiledOperations` through CUDA graphs. The
+     * custatevec calls of a compiled list are captured once into a graph,
+     * which later applications of the same list launch with a single call,
+     * removing the per-gate host dispatch and launch overhead.
+     *
+     * The graph is captured again, and updated in place, when the rotation
+     * angles of the list change through `CompiledOps::updateParameters`, or
+     * when the list, the data pointer or the workspace differ from the
+     * captured ones. Matrix updates are read from device memory by the
+     * captured graph and need no capture. If the capture fails, graphs are
+     * disabled and the calls are issued directly.
+     *
+     * @param use_graphs Use CUDA graphs for compiled operation lists.
+     */
+    void setUseGraphs(bool use_graphs) {
+        use_graphs_ = use_graphs;
+        if (!use_graphs) {
+            for (auto &captured : graphs_) {
+                captured.graph.reset();
+            }
+        }
+    }
+
+    /**
+     * @brief Indicate whether compiled operation lists are replayed through
+     * CUDA graphs.
+     */
+    [[nodiscard]] auto getUseGraphs() const -> bool { return use_graphs_; }
+
+    /**
+     * @brief Number of stream captures performed for compiled operation
+     * lists, including those applied as in-place graph updates.
+     */
+    [[nodiscard]] auto getNumGraphCaptures() const -> std::size_t {
+        std::size_t num_captures = 0;
+        for (const auto &captured : graphs_) {
+            num_captures += captured.graph.getNumInstantiations() +
+                            captured.graph.getNumUpdates();
+        }
+        return num_captures;
+    }
+
+    /**
+     * @brief Number of graph launches performed for compiled operation lists.
+     */
+    [[nodiscard]] auto getNumGraphLaunches() const -> std::size_t {
+        return graph_launches_;
+    }
+
     //****************************************************************************//
     // Explicit gate calls for bindings
     //****************************************************************************//
@@ -426,37 +726,16 @@ class StateVectorCudaManaged
     }
     inline void applySingleExcitation(const std::vector<std::size_t> &wires,
                                       bool adjoint, Precision param) {
-        static const std::string name{"SingleExcitation"};
-        const auto gate_key = std::make_pair(name, param);
-        if (!gate_cache_.gateExists(gate_key)) {
-            gate_cache_.add_gate(gate_key,
-                                 cuGates::getSingleExcitation<CFP_t>(param));
-        }
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(gate_key), {},
-                              wires, adjoint);
+        applyExcitationGate(wires, adjoint, param, 1, 2, 0);
     }
     inline void
     applySingleExcitationMinus(const std::vector<std::size_t> &wires,
                                bool adjoint, Precision param) {
-        static const std::string name{"SingleExcitationMinus"};
-        const auto gate_key = std::make_pair(name, param);
-        if (!gate_cache_.gateExists(gate_key)) {
-            gate_cache_.add_gate(
-                gate_key, cuGates::getSingleExcitationMinus<CFP_t>(param));
-        }
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(gate_key), {},
-                              wires, adjoint);
+        applyExcitationGate(wires, adjoint, param, 1, 2, -1);
     }
     inline void applySingleExcitationPlus(const std::vector<std::size_t> &wires,
                                           bool adjoint, Precision param) {
-        static const std::string name{"SingleExcitationPlus"};
-        const auto gate_key = std::make_pair(name, param);
-        if (!gate_cache_.gateExists(gate_key)) {
-            gate_cache_.add_gate(
-                gate_key, cuGates::getSingleExcitationPlus<CFP_t>(param));
-        }
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(gate_key), {},
-                              wires, adjoint);
+        applyExcitationGate(wires, adjoint, param, 1, 2, 1);
     }
 
     /* three-qubit gates */
@@ -480,19 +759,16 @@ class StateVectorCudaManaged
     /* four-qubit gates */
     inline void applyDoubleExcitation(const std::vector<std::size_t> &wires,
                                       bool adjoint, Precision param) {
-        auto &&mat = cuGates::getDoubleExcitation<CFP_t>(param);
-        applyDeviceMatrixGate(mat.data(), {}, wires, adjoint);
+        applyExcitationGate(wires, adjoint, param, 3, 12, 0);
     }
     inline void
     applyDoubleExcitationMinus(const std::vector<std::size_t> &wires,
                                bool adjoint, Precision param) {
-        auto &&mat = cuGates::getDoubleExcitationMinus<CFP_t>(param);
-        applyDeviceMatrixGate(mat.data(), {}, wires, adjoint);
+        applyExcitationGate(wires, adjoint, param, 3, 12, -1);
     }
     inline void applyDoubleExcitationPlus(const std::vector<std::size_t> &wires,
                                           bool adjoint, Precision param) {
-        auto &&mat = cuGates::getDoubleExcitationPlus<CFP_t>(param);
-        applyDeviceMatrixGate(mat.data(), {}, wires, adjoint);
+        applyExcitationGate(wires, adjoint, param, 3, 12, 1);
     }
 
     /* Multi-qubit gates */
@@ -528,16 +804,8 @@ class StateVectorCudaManaged
                               wires, adjoint);
     }
     inline void applyGeneratorIsingZZ(const std::vector<std::size_t> &wires,
-                                      bool adjoint) {
-        static const std::string name{"GeneratorIsingZZ"};
-        static const Precision param = 0.0;
-        const auto gate_key = std::make_pair(name, param);
-        if (!gate_cache_.gateExists(gate_key)) {
-            gate_cache_.add_gate(gate_key,
-                                 cuGates::getGeneratorIsingZZ<CFP_t>());
-        }
-        applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(gate_key), {},
-                              wires, adjoint);
+                                      [[maybe_unused]] bool adjoint) {
+        applyDiagonalGenerator(wires, {});
     }
 
     inline void
@@ -621,13 +889,51 @@ class StateVectorCudaManaged
     }
 
     inline void applyGeneratorMultiRZ(const std::vector<std::size_t> &wires,
-                                      bool adjoint) {
-        static const std::string name{"PauliZ"};
-        static const Precision param = 0.0;
-        for (const auto &w : wires) {
-            applyDeviceMatrixGate(gate_cache_.get_gate_device_ptr(name, param),
-                                  {}, {w}, adjoint);
-        }
+                                      [[maybe_unused]] bool adjoint) {
+        applyDiagonalGenerator(wires, {});
+    }
+    inline void applyGeneratorPhaseShift(const std::vector<std::size_t> &wires,
+                                         [[maybe_unused]] bool adjoint) {
+        applyDiagonalGenerator({}, wires);
+    }
+    /**
+     * @brief Apply the generator of ControlledPhaseShift, the projector onto
+     * the state where the control and target wires are all 1.
+     */
+    inline void
+    applyGeneratorControlledPhaseShift(const std::vector<std::size_t> &wires,
+                                       [[maybe_unused]] bool adjoint) {
+        applyDiagonalGenerator({}, wires);
+    }
+
+    /**
+     * @brief Apply the diagonal operator `P Z_s` in a single sweep of the
+     * state-vector, where `Z_s` is the tensor product of Pauli-Z on `z_wires`
+     * and `P` the projector onto the states with all `projector_wires` in 1.
+     * The operator is Hermitian, so it is its own adjoint.
+     *
+     * This covers the generators of the diagonal gates, which would otherwise
+     * take one dense matrix application per wire.
+     *
+     * @param z_wires Wires of the Pauli-Z string.
+     * @param projector_wires Wires projected onto 1.
+     */
+    void
+    applyDiagonalGenerator(const std::vector<std::size_t> &z_wires,
+                           const std::vector<std::size_t> &projector_wires) {
+        const std::size_t num_qubits = BaseType::getNumQubits();
+        auto toMask = [num_qubits](const std::vector<std::size_t> &wires) {
+            std::size_t mask = 0;
+            for (const auto w : wires) {
+                PL_ABORT_IF_NOT(w < num_qubits, "Invalid wire index.");
+                mask |= std::size_t{1} << (num_qubits - 1 - w);
+            }
+            return mask;
+        };
+        PL_CUDA_IS_SUCCESS(applyDiagonalGenerator_CUDA(
+            BaseType::getData(), BaseType::getLength(), toMask(z_wires),
+            toMask(projector_wires), BaseType::getStream()));
+        BaseType::markModified();
     }
 
     /**
@@ -645,7 +951,7 @@ class StateVectorCudaManaged
     auto expval(const std::string &obsName, const std::vector<size_t> &wires,
                 const std::vector<Precision> &params = {0.0},
                 const std::vector<CFP_t> &gate_matrix = {}) {
-
+        PL_NVTX_RANGE("expval");
         auto &&par = (params.empty()) ? std::vector<Precision>{0.0} : params;
         auto &&local_wires =
             (gate_matrix.empty())
@@ -655,16 +961,8 @@ class StateVectorCudaManaged
                       wires.rend()}; // ensure wire indexing correctly preserved
                                      // for tensor-observables
 
-        if (!(gate_cache_.gateExists(obsName, par[0]) || gate_matrix.empty())) {
-            gate_cache_.add_gate(obsName, par[0], gate_matrix);
-        } else if (!gate_cache_.gateExists(obsName, par[0]) &&
-                   gate_matrix.empty()) {
-            std::string message =
-                "Currently unsupported observable: " + obsName;
-            throw LightningException(message.c_str());
-        }
         auto expect_val = getExpectationValueDeviceMatrix(
-            gate_cache_.get_gate_device_ptr(obsName, par[0]), local_wires);
+            getObservableDevicePtr(obsName, par[0], gate_matrix), local_wires);
         return expect_val;
     }
     /**
@@ -692,21 +990,279 @@ class StateVectorCudaManaged
         }
         return expval(obsName, wires, params, matrix_cu);
     }
+
     /**
-     * @brief Utility method for probability calculation using given wires.
+     * @brief Expectation value and variance of an observable.
      *
-     * @param wires List of wires to return probabilities for in lexicographical
-     * order.
-     * @return std::vector<double>
+     * For observables on up to `getMaxMomentWires_CUDA()` wires, both
+     * `<O>` and `<O^2> = |O psi|^2` are accumulated by a single kernel
+     * sweeping the state-vector once, without a scratch state or a squared
+     * matrix. Larger observables square the cached matrix on the device and
+     * take two expectation values.
+     *
+     * @param obsName String label for observable. See `expval`.
+     * @param wires Target wires of the observable.
+     * @param params Parameters for a parametric observable.
+     * @param gate_matrix Optional matrix of the Hermitian observable. Cached
+     * under `obsName` for future use, and shared with `expval`.
+     * @return std::pair<Precision, Precision> Expectation value and variance.
      */
-    auto probability(const std::vector<size_t> &wires) -> std::vector<double> {
-        // Data return type fixed as double in custatevec function call
-        std::vector<double> probabilities(Util::exp2(wires.size()));
-        // this should be built upon by the wires not participating
-        int maskLen =
-            0; // static_cast<int>(BaseType::getNumQubits() - wires.size());
-        int *maskBitString = nullptr; //
-        int *maskOrdering = nullptr;
+    auto expvalAndVar(const std::string &obsName,
+                      const std::vector<size_t> &wires,
+                      const std::vector<Precision> &params = {0.0},
+                      const std::vector<std::complex<Precision>> &gate_matrix =
+                          {}) -> std::pair<Precision, Precision> {
+        auto &&par = (params.empty()) ? std::vector<Precision>{0.0} : params;
+        std::vector<CFP_t> matrix_cu(gate_matrix.size());
+        std::transform(gate_matrix.begin(), gate_matrix.end(),
+                       matrix_cu.begin(), [](const auto &value) {
+                           return cuUtil::complexToCu(value);
+                       });
+        const CFP_t *matrix =
+            getObservableDevicePtr(obsName, par[0], matrix_cu);
+        const std::vector<size_t> local_wires =
+            (gate_matrix.empty())
+                ? wires
+                : std::vector<size_t>{wires.rbegin(), wires.rend()};
+
+        if (local_wires.size() > getMaxMomentWires_CUDA()) {
+            const size_t dim = Util::exp2(local_wires.size());
+            DataBuffer<CFP_t> matrix_sqr{dim * dim,
+                                         BaseType::getDataBuffer().getDevTag(),
+                                         true};
+            squareDeviceMatrix(matrix, matrix_sqr.getData(), dim);
+            const auto mean =
+                getExpectationValueDeviceMatrix(matrix, local_wires).x;
+            const auto mean_sqr =
+                getExpectationValueDeviceMatrix(matrix_sqr.getData(),
+                                                local_wires)
+                    .x;
+            return {mean, mean_sqr - mean * mean};
+        }
+
+        std::vector<int> tgtsInt(local_wires.size());
+        std::transform(local_wires.begin(), local_wires.end(), tgtsInt.begin(),
+                       [&](std::size_t x) {
+                           return static_cast<int>(BaseType::getNumQubits() -
+                                                   1 - x);
+                       });
+        if (moments_ == nullptr) {
+            moments_ = std::make_unique<DataBuffer<double>>(
+                2, BaseType::getDataBuffer().getDevTag(), true);
+        }
+        PL_CUDA_IS_SUCCESS(computeMoments_CUDA(
+            BaseType::getData(),
+            static_cast<unsigned int>(BaseType::getNumQubits()), matrix,
+            tgtsInt.data(), static_cast<unsigned int>(tgtsInt.size()),
+            moments_->getData(), BaseType::getStream()));
+
+        std::array<double, 2> moments{};
+        moments_->CopyGpuDataToHost(moments.data(), moments.size(), true);
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(BaseType::getStream()));
+        return {static_cast<Precision>(moments[0]),
+                static_cast<Precision>(moments[1] - moments[0] * moments[0])};
+    }
+
+    /**
+     * @brief Expectation values of a list of Pauli words, evaluated with a
+     * single batched custatevec call.
+     *
+     * @param pauli_words Operator names of each word, from "PauliX",
+     * "PauliY", "PauliZ" and "Identity".
+     * @param wires Target wires of each word, one per operator name.
+     * @return std::vector<double> Expectation value of each word.
+     */
+    auto expvalPauliWords(
+        const std::vector<std::vector<std::string>> &pauli_words,
+        const std::vector<std::vector<size_t>> &wires) -> std::vector<double> {
+        PL_ABORT_IF_NOT(pauli_words.size() == wires.size(),
+                        "Each Pauli word requires a list of wires");
+        const size_t num_words = pauli_words.size();
+        std::vector<double> expect(num_words);
+        if (num_words == 0) {
+            return expect;
+        }
+
+        std::vector<std::vector<custatevecPauli_t>> paulis(num_words);
+        std::vector<std::vector<int32_t>> basis_bits(num_words);
+        std::vector<const custatevecPauli_t *> paulis_ptr(num_words);
+        std::vector<const int32_t *> basis_bits_ptr(num_words);
+        std::vector<uint32_t> num_basis_bits(num_words);
+        for (size_t word = 0; word < num_words; word++) {
+            PL_ABORT_IF_NOT(pauli_words[word].size() == wires[word].size(),
+                            "Each Pauli operator requires a single wire");
+            for (size_t op = 0; op < pauli_words[word].size(); op++) {
+                const auto it = pauli_basis_.find(pauli_words[word][op]);
+                PL_ABORT_IF(it == pauli_basis_.end(),
+                            "Pauli words only support PauliX, PauliY, "
+                            "PauliZ and Identity");
+                paulis[word].push_back(it->second);
+                basis_bits[word].push_back(static_cast<int32_t>(
+                    BaseType::getNumQubits() - 1 - wires[word][op]));
+            }
+            // An empty word is the identity
+            if (paulis[word].empty()) {
+                paulis[word].push_back(CUSTATEVEC_PAULI_I);
+                basis_bits[word].push_back(0);
+            }
+            paulis_ptr[word] = paulis[word].data();
+            basis_bits_ptr[word] = basis_bits[word].data();
+            num_basis_bits[word] =
+                static_cast<uint32_t>(basis_bits[word].size());
+        }
+
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectationsOnPauliBasis(
+            /* custatevecHandle_t */ handle,
+            /* const void* */ BaseType::getData(),
+            /* cudaDataType_t */ getCudaTypes().first,
+            /* const uint32_t */ BaseType::getNumQubits(),
+            /* double* */ expect.data(),
+            /* const custatevecPauli_t ** */ paulis_ptr.data(),
+            /* const uint32_t */ static_cast<uint32_t>(num_words),
+            /* const int32_t ** */ basis_bits_ptr.data(),
+            /* const uint32_t */ num_basis_bits.data()));
+        return expect;
+    }
+
+    /**
+     * @brief Expectation value of a Hamiltonian given as a linear combination
+     * of Pauli words. All words are evaluated in one batched call.
+     *
+     * @param coeffs Coefficient of each Pauli word.
+     * @param pauli_words Operator names of each word, from "PauliX",
+     * "PauliY", "PauliZ" and "Identity".
+     * @param wires Target wires of each word, one per operator name.
+     * @return Precision Expectation value.
+     */
+    auto expvalHamiltonian(
+        const std::vector<Precision> &coeffs,
+        const std::vector<std::vector<std::string>> &pauli_words,
+        const std::vector<std::vector<size_t>> &wires) -> Precision {
+        PL_ABORT_IF_NOT(coeffs.size() == pauli_words.size(),
+                        "Each Pauli word requires a coefficient");
+        const auto expect = expvalPauliWords(pauli_words, wires);
+        double result = 0.0;
+        for (size_t word = 0; word < expect.size(); word++) {
+            result += static_cast<double>(coeffs[word]) * expect[word];
+        }
+        return static_cast<Precision>(result);
+    }
+
+    /**
+     * @brief Expectation value of a Hamiltonian given as a sparse matrix in
+     * CSR format over all wires. The product with the state-vector is formed
+     * with cuSPARSE, and reduced with cuBLAS, without leaving the device.
+     *
+     * @tparam IndexT Integer type of the CSR indices (32 or 64 bit).
+     * @param row_offsets CSR row offsets, of length `2^num_qubits + 1`.
+     * @param columns CSR column index of each non-zero value.
+     * @param values Non-zero values of the matrix.
+     * @return Precision Expectation value.
+     */
+    template <class IndexT>
+    auto expvalSparseHamiltonian(
+        const std::vector<IndexT> &row_offsets,
+        const std::vector<IndexT> &columns,
+        const std::vector<std::complex<Precision>> &values) -> Precision {
+        static_assert(std::is_integral_v<IndexT> &&
+                          (sizeof(IndexT) == 4 || sizeof(IndexT) == 8),
+                      "CSR indices must be 32 or 64 bit integers");
+        const size_t length = BaseType::getLength();
+        PL_ABORT_IF_NOT(row_offsets.size() == length + 1,
+                        "The sparse Hamiltonian must act on all wires");
+        PL_ABORT_IF_NOT(columns.size() == values.size(),
+                        "Each non-zero value requires a column index");
+
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const auto data_type = getCudaTypes().first;
+        constexpr auto index_type = (sizeof(IndexT) == 4) ? CUSPARSE_INDEX_32I
+                                                          : CUSPARSE_INDEX_64I;
+
+        DataBuffer<IndexT> d_row_offsets{row_offsets.size(), dev_tag, true};
+        DataBuffer<IndexT> d_columns{columns.size(), dev_tag, true};
+        DataBuffer<CFP_t> d_values{values.size(), dev_tag, true};
+        DataBuffer<CFP_t> d_result{length, dev_tag, true};
+        d_row_offsets.CopyHostDataToGpu(row_offsets.data(),
+                                        row_offsets.size(), true);
+        d_columns.CopyHostDataToGpu(columns.data(), columns.size(), true);
+        d_values.CopyHostDataToGpu(values.data(), values.size(), true);
+
+        cusparseHandle_t sparse_handle =
+            cuUtil::CusparseHandleRegistry::getInstance().getHandle(
+                dev_tag.getDeviceID(), BaseType::getStream());
+        cusparseSpMatDescr_t mat;
+        cusparseDnVecDescr_t vec_sv;
+        cusparseDnVecDescr_t vec_result;
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateCsr(
+            &mat, static_cast<int64_t>(length), static_cast<int64_t>(length),
+            static_cast<int64_t>(values.size()), d_row_offsets.getData(),
+            d_columns.getData(), d_values.getData(), index_type, index_type,
+            CUSPARSE_INDEX_BASE_ZERO, data_type));
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            &vec_sv, static_cast<int64_t>(length), BaseType::getData(),
+            data_type));
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreateDnVec(
+            &vec_result, static_cast<int64_t>(length), d_result.getData(),
+            data_type));
+
+        const CFP_t alpha = cuUtil::ONE<CFP_t>();
+        const CFP_t beta = cuUtil::ZERO<CFP_t>();
+        size_t buffer_size = 0;
+        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV_bufferSize(
+            sparse_handle, CUSPARSE_OPERATION_NON_TRANSPOSE, &alpha, mat,
+            vec_sv, &beta, vec_result, data_type, CUSPARSE_SPMV_ALG_DEFAULT,
+            &buffer_size));
+        PL_CUSPARSE_IS_SUCCESS(cusparseSpMV(
+            sparse_handle, CUSPARSE_OPERATION_NON_TRANSPOSE, &alpha, mat,
+            vec_sv, &beta, vec_result, data_type, CUSPARSE_SPMV_ALG_DEFAULT,
+            workspace_.getWorkspace(buffer_size)));
+
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vec_result));
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroyDnVec(vec_sv));
+        PL_CUSPARSE_IS_SUCCESS(cusparseDestroySpMat(mat));
+
+        if constexpr (std::is_same_v<CFP_t, cuComplex>) {
+            if (mixed_precision_) {
+                return static_cast<Precision>(
+                    innerProductMixed(BaseType::getData(), d_result.getData())
+                        .x);
+            }
+        }
+        const auto expect = cuUtil::innerProdC_CUDA(
+            BaseType::getData(), d_result.getData(), static_cast<int>(length),
+            dev_tag.getDeviceID(), BaseType::getStream());
+        return static_cast<Precision>(expect.x);
+    }
+    /**
+     * @brief Compute the probabilities of the given wires, written to `probs`.
+     *
+     * The output has `2^wires.size()` entries in PennyLane order: the first
+     * wire in `wires` is the most significant bit of the output index.
+     * `probs` may point to device memory, in which case the reduction is
+     * enqueued on the state-vector stream with no host synchronization, or to
+     * (preferably pinned) host memory.
+     *
+     * With a mask, only the basis states where `mask_wires` take the values
+     * `mask_bits` contribute, so the outputs are the joint probabilities
+     * P(wires = x, mask_wires = mask_bits). Dividing by their sum gives the
+     * conditional probabilities.
+     *
+     * @param probs Output buffer of length `2^wires.size()`.
+     * @param wires List of wires to return probabilities for.
+     * @param mask_wires Wires fixed by the mask, disjoint from `wires`.
+     * @param mask_bits Value (0 or 1) of each wire in `mask_wires`.
+     */
+    void computeProbabilities(double *probs, const std::vector<size_t> &wires,
+                              const std::vector<size_t> &mask_wires = {},
+                              const std::vector<int> &mask_bits = {}) {
+        const size_t num_qubits = BaseType::getNumQubits();
+        PL_ABORT_IF_NOT(mask_wires.size() == mask_bits.size(),
+                        "Each mask wire needs exactly one mask bit.");
+        for (const auto wire : mask_wires) {
+            PL_ABORT_IF(std::find(wires.begin(), wires.end(), wire) !=
+                            wires.end(),
+                        "Mask wires must not overlap the measured wires.");
+        }
 
         cudaDataType_t data_type;
 
@@ -717,26 +1273,67 @@ class StateVectorCudaManaged
             data_type = CUDA_C_32F;
         }
 
+        // custatevec lists the output bits from least to most significant, so
+        // reversing the wires yields PennyLane ordering directly.
         std::vector<int> wires_int(wires.size());
-
-        // Transform indices between PL & cuQuantum ordering
-        std::transform(
-            wires.begin(), wires.end(), wires_int.begin(), [&](std::size_t x) {
-                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
-            });
+        std::transform(wires.rbegin(), wires.rend(), wires_int.begin(),
+                       [&](std::size_t x) {
+                           return static_cast<int>(num_qubits - 1 - x);
+                       });
+        std::vector<int> mask_int(mask_wires.size());
+        std::transform(mask_wires.begin(), mask_wires.end(), mask_int.begin(),
+                       [&](std::size_t x) {
+                           return static_cast<int>(num_qubits - 1 - x);
+                       });
 
         PL_CUSTATEVEC_IS_SUCCESS(custatevecAbs2SumArray(
             /* custatevecHandle_t */ handle,
             /* const void* */ BaseType::getData(),
             /* cudaDataType_t */ data_type,
-            /* const uint32_t */ BaseType::getNumQubits(),
-            /* double* */ probabilities.data(),
+            /* const uint32_t */ num_qubits,
+            /* double* */ probs,
             /* const int32_t* */ wires_int.data(),
             /* const uint32_t */ wires_int.size(),
-            /* const int32_t* */ maskBitString,
-            /* const int32_t* */ maskOrdering,
-            /* const uint32_t */ maskLen));
+            /* const int32_t* */ mask_bits.empty() ? nullptr : mask_bits.data(),
+            /* const int32_t* */ mask_int.empty() ? nullptr : mask_int.data(),
+            /* const uint32_t */ mask_int.size()));
+    }
+
+    /**
+     * @brief Utility method for probability calculation using given wires.
+     * See `computeProbabilities`.
+     *
+     * @param wires List of wires to return probabilities for in lexicographical
+     * order.
+     * @param mask_wires Wires fixed by the mask, disjoint from `wires`.
+     * @param mask_bits Value (0 or 1) of each wire in `mask_wires`.
+     * @return std::vector<double> Probabilities in PennyLane order.
+     */
+    auto probability(const std::vector<size_t> &wires,
+                     const std::vector<size_t> &mask_wires = {},
+                     const std::vector<int> &mask_bits = {})
+        -> std::vector<double> {
+        // Data return type fixed as double in custatevec function call
+        std::vector<double> probabilities(Util::exp2(wires.size()));
+        computeProbabilities(probabilities.data(), wires, mask_wires,
+                             mask_bits);
+        return probabilities;
+    }
 
+    /**
+     * @brief Compute the probabilities of the given wires into a device
+     * buffer, without synchronizing with the host. See
+     * `computeProbabilities`.
+     */
+    auto probability_device(const std::vector<size_t> &wires,
+                            const std::vector<size_t> &mask_wires = {},
+                            const std::vector<int> &mask_bits = {})
+        -> std::unique_ptr<DataBuffer<double>> {
+        auto probabilities = std::make_unique<DataBuffer<double>>(
+            Util::exp2(wires.size()), BaseType::getDataBuffer().getDevTag(),
+            true);
+        computeProbabilities(probabilities->getData(), wires, mask_wires,
+                             mask_bits);
         return probabilities;
     }
 
@@ -751,9 +1348,9 @@ class StateVectorCudaManaged
      * number between 0 and num_samples-1.
      */
     auto generate_samples(size_t num_samples) -> std::vector<size_t> {
+        PL_NVTX_RANGE("generate_samples");
 
         std::vector<double> rand_nums(num_samples);
-        custatevecSamplerDescriptor_t sampler;
 
         const size_t num_qubits = BaseType::getNumQubits();
         const int bitStringLen = BaseType::getNumQubits();
@@ -780,31 +1377,15 @@ class StateVectorCudaManaged
         std::unordered_map<size_t, size_t> cache;
         std::vector<custatevecIndex_t> bitStrings(num_samples);
 
-        void *extraWorkspace = nullptr;
-        size_t extraWorkspaceSizeInBytes = 0;
-        // create sampler and check the size of external workspace
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerCreate(
-            handle, BaseType::getData(), data_type, num_qubits, &sampler,
-            num_samples, &extraWorkspaceSizeInBytes));
-
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0)
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-
-        // sample preprocess
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerPreprocess(
-            handle, sampler, extraWorkspace, extraWorkspaceSizeInBytes));
+        // reuse the preprocessed sampler while the state is unchanged
+        prepareSampler(data_type, num_samples);
 
         // sample bit strings
         PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerSample(
-            handle, sampler, bitStrings.data(), bitOrdering.data(),
+            handle, sampler_, bitStrings.data(), bitOrdering.data(),
             bitStringLen, rand_nums.data(), num_samples,
             CUSTATEVEC_SAMPLER_OUTPUT_ASCENDING_ORDER));
 
-        // destroy descriptor and handle
-        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerDestroy(sampler));
-
         // Pick samples
         for (size_t i = 0; i < num_samples; i++) {
             auto idx = bitStrings[i];
@@ -825,14 +1406,243 @@ class StateVectorCudaManaged
             }
         }
 
-        if (extraWorkspaceSizeInBytes > 0)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+        return samples;
+    }
+
+    /**
+     * @brief Seed the device random number generator used by the
+     * device-side samplers. Without a seed, the generator is seeded from
+     * `std::random_device` on first use.
+     *
+     * @param seed Seed of the generator.
+     */
+    void setSeed(unsigned long long seed) {
+        PL_CURAND_IS_SUCCESS(
+            curandSetPseudoRandomGeneratorSeed(getRng(), seed));
+    }
+
+    /**
+     * @brief Sample basis states entirely on the device.
+     *
+     * Uniform numbers are drawn with cuRAND, and mapped to basis states using
+     * the cumulative probabilities of chunks of the state-vector, so no
+     * per-amplitude prefix sum is stored. The samples never leave the device.
+     *
+     * @param num_samples Number of samples.
+     * @return std::unique_ptr<DataBuffer<unsigned long long>> Index of each
+     * sampled basis state, with wire 0 as the most significant bit.
+     */
+    auto generate_samples_device(size_t num_samples)
+        -> std::unique_ptr<DataBuffer<unsigned long long>> {
+        PL_NVTX_RANGE("generate_samples_device");
+        PL_ABORT_IF(num_samples == 0, "At least one sample is required");
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const size_t length = BaseType::getLength();
+        const size_t chunk_size = std::min(length, sample_chunk_size_);
+        const size_t num_chunks = length / chunk_size;
+
+        if (sample_cdf_ == nullptr) {
+            sample_cdf_ =
+                std::make_unique<DataBuffer<double>>(num_chunks, dev_tag, true);
+        }
+        if (sample_cdf_version_ != BaseType::getDataVersion()) {
+            PL_CUDA_IS_SUCCESS(computeChunkProbabilities_CUDA(
+                BaseType::getData(), length, chunk_size,
+                sample_cdf_->getData(), BaseType::getStream()));
+            sample_cdf_version_ = BaseType::getDataVersion();
+            sampler_preprocess_count_++;
+        }
+
+        DataBuffer<double> uniforms{num_samples, dev_tag, true};
+        PL_CURAND_IS_SUCCESS(
+            curandGenerateUniformDouble(getRng(), uniforms.getData(),
+                                        num_samples));
+
+        auto indices = std::make_unique<DataBuffer<unsigned long long>>(
+            num_samples, dev_tag, true);
+        PL_CUDA_IS_SUCCESS(sampleIndices_CUDA(
+            BaseType::getData(), length, chunk_size, sample_cdf_->getData(),
+            uniforms.getData(), num_samples, indices->getData(),
+            BaseType::getStream()));
+        return indices;
+    }
+
+    /**
+     * @brief Sample basis states on the device, and return one packed word
+     * per sample. See `generate_samples_device`.
+     *
+     * @param num_samples Number of samples.
+     * @return std::vector<uint64_t> Index of each sampled basis state, with
+     * wire 0 as the most significant bit.
+     */
+    auto generate_samples_packed(size_t num_samples) -> std::vector<uint64_t> {
+        const auto indices = generate_samples_device(num_samples);
+        std::vector<uint64_t> samples(num_samples);
+        indices->CopyGpuDataToHost(samples.data(), samples.size(), true);
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(BaseType::getStream()));
+        return samples;
+    }
 
+    /**
+     * @brief Sample basis states on the device, and unpack them on the device
+     * into one byte per wire. See `generate_samples_device`.
+     *
+     * @param num_samples Number of samples.
+     * @return std::vector<uint8_t> Row-major `num_samples x num_qubits` array
+     * of sampled bits.
+     */
+    auto generate_samples_bits(size_t num_samples) -> std::vector<uint8_t> {
+        const size_t num_qubits = BaseType::getNumQubits();
+        const auto indices = generate_samples_device(num_samples);
+        DataBuffer<unsigned char> bits{num_samples * num_qubits,
+                                       BaseType::getDataBuffer().getDevTag(),
+                                       true};
+        PL_CUDA_IS_SUCCESS(unpackSamples_CUDA(
+            indices->getData(), num_samples,
+            static_cast<unsigned int>(num_qubits), bits.getData(),
+            BaseType::getStream()));
+        std::vector<uint8_t> samples(num_samples * num_qubits);
+        bits.CopyGpuDataToHost(samples.data(), samples.size(), true);
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(BaseType::getStream()));
         return samples;
     }
 
+    /**
+     * @brief Sample basis states on the device, and return only how often
+     * each basis state was drawn. The histogram is built on the device, so no
+     * per-sample array is copied to the host. See `generate_samples_device`.
+     *
+     * @param num_samples Number of samples.
+     * @return std::pair<std::vector<uint64_t>, std::vector<uint64_t>> Sampled
+     * basis state indices in ascending order, and their counts.
+     */
+    auto generate_counts(size_t num_samples)
+        -> std::pair<std::vector<uint64_t>, std::vector<uint64_t>> {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        const auto indices = generate_samples_device(num_samples);
+        DataBuffer<unsigned long long> unique_indices{num_samples, dev_tag,
+                                                      true};
+        DataBuffer<unsigned long long> counts{num_samples, dev_tag, true};
+        size_t num_unique = 0;
+        PL_CUDA_IS_SUCCESS(countSamples_CUDA(
+            indices->getData(), num_samples, unique_indices.getData(),
+            counts.getData(), &num_unique, BaseType::getStream()));
+
+        std::pair<std::vector<uint64_t>, std::vector<uint64_t>> result{
+            std::vector<uint64_t>(num_unique),
+            std::vector<uint64_t>(num_unique)};
+        PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+            result.first.data(), unique_indices.getData(),
+            num_unique * sizeof(uint64_t), cudaMemcpyDeviceToHost,
+            BaseType::getStream()));
+        PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+            result.second.data(), counts.getData(),
+            num_unique * sizeof(uint64_t), cudaMemcpyDeviceToHost,
+            BaseType::getStream()));
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(BaseType::getStream()));
+        return result;
+    }
+
+    /**
+     * @brief Get the number of times a sampling distribution was computed
+     * from the state, by either sampler. Repeated sampling of an unchanged
+     * state reuses the previous distribution.
+     */
+    [[nodiscard]] auto getSamplerPreprocessCount() const -> std::size_t {
+        return sampler_preprocess_count_;
+    }
+
+    /**
+     * @brief Get the custatevec handle used by this object. The handle is
+     * bound to the stream of the object's device tag, and shared with the
+     * other state-vectors on that stream through their `DeviceContext`.
+     */
+    [[nodiscard]] auto getCusvHandle() const -> custatevecHandle_t {
+        return handle;
+    }
+
+    /**
+     * @brief Get the largest custatevec workspace request made by this object,
+     * in bytes.
+     */
+    [[nodiscard]] auto getWorkspaceHighWaterMark() const -> std::size_t {
+        return workspace_.getHighWaterMark();
+    }
+
+    /**
+     * @brief Bound the device memory of the gate cache of this object. See
+     * `GateCache::setCapacity`.
+     *
+     * @param capacity_bytes Capacity in bytes, or 0 for an unbounded cache.
+     */
+    void setGateCacheCapacity(std::size_t capacity_bytes) {
+        gate_cache_.setCapacity(capacity_bytes);
+    }
+
+    /**
+     * @brief Get the gate cache of this object, e.g. to read its counters.
+     */
+    [[nodiscard]] auto getGateCache() const -> const GateCache<Precision> & {
+        return gate_cache_;
+    }
+
+    /**
+     * @brief Get the number of bytes currently held by the custatevec
+     * workspace of this object.
+     */
+    [[nodiscard]] auto getWorkspaceCapacity() const -> std::size_t {
+        return workspace_.getCapacity();
+    }
+
   private:
     GateCache<Precision> gate_cache_;
+
+    /**
+     * @brief Identity of the work captured in a graph.
+     */
+    struct GraphKey {
+        std::size_t ops_id;
+        std::size_t ops_revision;
+        const void *data;
+        const void *workspace;
+
+        auto operator==(const GraphKey &other) const -> bool {
+            return ops_id == other.ops_id &&
+                   ops_revision == other.ops_revision &&
+                   data == other.data && workspace == other.workspace;
+        }
+    };
+    struct CapturedGraph {
+        GraphKey key{};
+        CudaGraph graph;
+    };
+    bool use_graphs_{false};
+    /// Forward and adjoint graphs of the last compiled lists applied.
+    std::array<CapturedGraph, 2> graphs_;
+    std::size_t graph_launches_{0};
+    cudaStream_t capture_stream_{nullptr};
+    DeviceWorkspace<int> workspace_{BaseType::getDataBuffer().getDevTag()};
+    std::size_t fusion_max_width_{0};
+    bool mixed_precision_{false};
+    // Device slot receiving matrices generated on the device
+    std::unique_ptr<DataBuffer<CFP_t>> gate_scratch_;
+    // Device slot receiving the moments reduced by `expvalAndVar`
+    std::unique_ptr<DataBuffer<double>> moments_;
+    // Number of amplitudes per entry of the sampling distribution
+    static constexpr size_t sample_chunk_size_ = 1024;
+    // Cumulative probabilities of each chunk, filled by the device sampler
+    std::unique_ptr<DataBuffer<double>> sample_cdf_;
+    std::size_t sample_cdf_version_{std::numeric_limits<std::size_t>::max()};
+    // Preprocessed custatevec sampler, valid for the state at
+    // `sampler_version_` and up to `sampler_max_shots_` shots per call
+    custatevecSamplerDescriptor_t sampler_{nullptr};
+    std::size_t sampler_max_shots_{0};
+    std::size_t sampler_version_{std::numeric_limits<std::size_t>::max()};
+    std::size_t sampler_workspace_size_{0};
+    DeviceWorkspace<int> sampler_workspace_{
+        BaseType::getDataBuffer().getDevTag()};
+    std::size_t sampler_preprocess_count_{0};
+    curandGenerator_t rng_{nullptr};
     using ParFunc = std::function<void(const std::vector<size_t> &, bool,
                                        const std::vector<Precision> &)>;
     using FMap = std::unordered_map<std::string, ParFunc>;
@@ -916,10 +1726,53 @@ class StateVectorCudaManaged
                       std::forward<decltype(adjoint)>(adjoint),
                       std::forward<decltype(params)>(params));
          }},
-        {"CRot", [&](auto &&wires, auto &&adjoint, auto &&params) {
+        {"CRot",
+         [&](auto &&wires, auto &&adjoint, auto &&params) {
              applyCRot(std::forward<decltype(wires)>(wires),
                        std::forward<decltype(adjoint)>(adjoint),
                        std::forward<decltype(params)>(params));
+         }},
+        {"SingleExcitation",
+         [&](auto &&wires, auto &&adjoint, auto &&params) {
+             applySingleExcitation(
+                 std::forward<decltype(wires)>(wires),
+                 std::forward<decltype(adjoint)>(adjoint),
+                 std::forward<decltype(params[0])>(params[0]));
+         }},
+        {"SingleExcitationMinus",
+         [&](auto &&wires, auto &&adjoint, auto &&params) {
+             applySingleExcitationMinus(
+                 std::forward<decltype(wires)>(wires),
+                 std::forward<decltype(adjoint)>(adjoint),
+                 std::forward<decltype(params[0])>(params[0]));
+         }},
+        {"SingleExcitationPlus",
+         [&](auto &&wires, auto &&adjoint, auto &&params) {
+             applySingleExcitationPlus(
+                 std::forward<decltype(wires)>(wires),
+                 std::forward<decltype(adjoint)>(adjoint),
+                 std::forward<decltype(params[0])>(params[0]));
+         }},
+        {"DoubleExcitation",
+         [&](auto &&wires, auto &&adjoint, auto &&params) {
+             applyDoubleExcitation(
+                 std::forward<decltype(wires)>(wires),
+                 std::forward<decltype(adjoint)>(adjoint),
+                 std::forward<decltype(params[0])>(params[0]));
+         }},
+        {"DoubleExcitationMinus",
+         [&](auto &&wires, auto &&adjoint, auto &&params) {
+             applyDoubleExcitationMinus(
+                 std::forward<decltype(wires)>(wires),
+                 std::forward<decltype(adjoint)>(adjoint),
+                 std::forward<decltype(params[0])>(params[0]));
+         }},
+        {"DoubleExcitationPlus",
+         [&](auto &&wires, auto &&adjoint, auto &&params) {
+             applyDoubleExcitationPlus(
+                 std::forward<decltype(wires)>(wires),
+                 std::forward<decltype(adjoint)>(adjoint),
+                 std::forward<decltype(params[0])>(params[0]));
          }}};
     custatevecHandle_t handle;
 
@@ -929,6 +1782,12 @@ class StateVectorCudaManaged
         {"CRY", CUSTATEVEC_PAULI_Y},      {"CRZ", CUSTATEVEC_PAULI_Z},
         {"Identity", CUSTATEVEC_PAULI_I}, {"I", CUSTATEVEC_PAULI_I}};
 
+    const std::unordered_map<std::string, custatevecPauli_t> pauli_basis_{
+        {"PauliX", CUSTATEVEC_PAULI_X},
+        {"PauliY", CUSTATEVEC_PAULI_Y},
+        {"PauliZ", CUSTATEVEC_PAULI_Z},
+        {"Identity", CUSTATEVEC_PAULI_I}};
+
     /**
      * @brief Normalize the index ordering to match PennyLane.
      *
@@ -946,6 +1805,344 @@ class StateVectorCudaManaged
         return t_indices;
     }
 
+    /**
+     * @brief Apply a sequence of operations, merging runs of small gates into
+     * dense matrices of at most `fusion_max_width_` wires. As for
+     * `CompiledOps`, the fused matrices are uploaded at once into a single
+     * device block before being applied.
+     *
+     * @param opNames Names of the operations.
+     * @param wires Wires of each operation.
+     * @param adjoints Adjoint flag of each operation.
+     * @param params Parameters of each operation. May be empty.
+     */
+    void
+    applyFusedOperations(const std::vector<std::string> &opNames,
+                         const std::vector<std::vector<size_t>> &wires,
+                         const std::vector<bool> &adjoints,
+                         const std::vector<std::vector<Precision>> &params) {
+        const auto fused = fuseOperations<Precision>(opNames, wires, adjoints,
+                                                     params, fusion_max_width_);
+        std::vector<CFP_t> host_matrices;
+        std::vector<std::size_t> offsets(fused.size(), 0);
+        for (std::size_t i = 0; i < fused.size(); i++) {
+            offsets[i] = host_matrices.size();
+            if (fused[i].num_ops > 1) {
+                for (const auto &value : fused[i].matrix) {
+                    host_matrices.push_back(
+                        cuUtil::complexToCu<std::complex<Precision>>(value));
+                }
+            }
+        }
+        // Its release waits for the gates below, which read it on our stream
+        std::unique_ptr<DataBuffer<CFP_t>> matrices;
+        if (!host_matrices.empty()) {
+            matrices = std::make_unique<DataBuffer<CFP_t>>(
+                host_matrices.size(), BaseType::getDataBuffer().getDevTag());
+            matrices->CopyHostDataToGpu(host_matrices.data(),
+                                        host_matrices.size());
+        }
+
+        for (std::size_t i = 0; i < fused.size(); i++) {
+            const auto &gate = fused[i];
+            if (gate.num_ops == 1) {
+                const auto op_idx = gate.first_op;
+                applyOperation(opNames[op_idx], wires[op_idx],
+                               adjoints[op_idx],
+                               params.empty() ? std::vector<Precision>{0.0}
+                                              : params[op_idx]);
+            } else {
+                // custatevec expects the least significant target first
+                applyDeviceMatrixGate(
+                    matrices->getData() + offsets[i], {},
+                    std::vector<size_t>{gate.wires.rbegin(), gate.wires.rend()},
+                    false);
+            }
+        }
+    }
+
+    /**
+     * @brief Apply a gate of the SingleExcitation or DoubleExcitation
+     * families. The matrix is written from the angle by a kernel on the
+     * stream of this object, into a device slot reused by every such gate,
+     * so no host matrix is built or copied.
+     *
+     * @param wires Wires to apply the gate to.
+     * @param adjoint Apply the adjoint of the gate.
+     * @param param Rotation angle.
+     * @param lo First basis state of the rotation subspace.
+     * @param hi Second basis state of the rotation subspace.
+     * @param phase_sign Sign of the phase `exp(+-i param / 2)` outside the
+     * rotation subspace, or 0 for no phase.
+     */
+    void applyExcitationGate(const std::vector<std::size_t> &wires,
+                             bool adjoint, Precision param, unsigned int lo,
+                             unsigned int hi, int phase_sign) {
+        constexpr std::size_t max_dim = 16;
+        const auto dim = static_cast<unsigned int>(1U << wires.size());
+        if (gate_scratch_ == nullptr) {
+            gate_scratch_ = std::make_unique<DataBuffer<CFP_t>>(
+                max_dim * max_dim, BaseType::getDataBuffer().getDevTag());
+        }
+        const Precision p2 = param / 2;
+        const CFP_t phase =
+            (phase_sign == 0)
+                ? cuUtil::ONE<CFP_t>()
+                : cuUtil::complexToCu<std::complex<Precision>>(std::exp(
+                      std::complex<Precision>(0, phase_sign * p2)));
+        PL_CUDA_IS_SUCCESS(generateExcitationMatrix_CUDA(
+            gate_scratch_->getData(), dim, lo, hi, std::cos(p2), std::sin(p2),
+            phase, BaseType::getStream()));
+        applyDeviceMatrixGate(gate_scratch_->getData(), {}, wires, adjoint);
+    }
+
+    /**
+     * @brief Borrow the custatevec handle for this object's stream and the
+     * default gates of its device from the shared `DeviceContext`, instead of
+     * creating and uploading them per object.
+     */
+    void bindDeviceContext() {
+        const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+        auto &context =
+            DeviceContext<Precision>::getInstance(dev_tag.getDeviceID());
+        handle = context.getHandle(BaseType::getStream());
+        gate_cache_.setSharedGates(context.getDefaultGates());
+    }
+
+    /**
+     * @brief Make the custatevec sampler ready for `num_samples` shots of the
+     * current state. The descriptor is recreated only when more shots are
+     * requested than it was created for, and preprocessed only when the state
+     * changed since the last preprocessing. The preprocessed data lives in a
+     * workspace owned by the sampler, so other calls cannot overwrite it.
+     */
+    void prepareSampler(cudaDataType_t data_type, size_t num_samples) {
+        if (sampler_ == nullptr || num_samples > sampler_max_shots_) {
+            if (sampler_ != nullptr) {
+                PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerDestroy(sampler_));
+                sampler_ = nullptr;
+            }
+            PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerCreate(
+                handle, BaseType::getData(), data_type,
+                BaseType::getNumQubits(), &sampler_, num_samples,
+                &sampler_workspace_size_));
+            sampler_max_shots_ = num_samples;
+            sampler_version_ = std::numeric_limits<std::size_t>::max();
+        }
+        if (sampler_version_ == BaseType::getDataVersion()) {
+            return;
+        }
+        void *workspace =
+            sampler_workspace_.getWorkspace(sampler_workspace_size_);
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecSamplerPreprocess(
+            handle, sampler_, workspace, sampler_workspace_size_));
+        sampler_version_ = BaseType::getDataVersion();
+        sampler_preprocess_count_++;
+    }
+
+    /**
+     * @brief Get the device random number generator, bound to the stream of
+     * this object, creating it on first use.
+     */
+    auto getRng() -> curandGenerator_t {
+        if (rng_ == nullptr) {
+            PL_CURAND_IS_SUCCESS(
+                curandCreateGenerator(&rng_, CURAND_RNG_PSEUDO_PHILOX4_32_10));
+            PL_CURAND_IS_SUCCESS(curandSetStream(rng_, BaseType::getStream()));
+            PL_CURAND_IS_SUCCESS(curandSetPseudoRandomGeneratorSeed(
+                rng_, std::random_device{}()));
+        }
+        return rng_;
+    }
+
+    /**
+     * @brief Get the cached device matrix of an observable, caching
+     * `gate_matrix` under `obsName` first if it is not cached yet.
+     */
+    auto getObservableDevicePtr(const std::string &obsName, Precision param,
+                                const std::vector<CFP_t> &gate_matrix)
+        -> const CFP_t * {
+        if (!(gate_cache_.gateExists(obsName, param) || gate_matrix.empty())) {
+            gate_cache_.add_gate(obsName, param, gate_matrix);
+        } else if (!gate_cache_.gateExists(obsName, param) &&
+                   gate_matrix.empty()) {
+            std::string message =
+                "Currently unsupported observable: " + obsName;
+            throw LightningException(message.c_str());
+        }
+        return gate_cache_.get_gate_device_ptr(obsName, param);
+    }
+
+    /**
+     * @brief Write the square of a row-major `dim x dim` device matrix to
+     * `result`, using cuBLAS on the state-vector stream.
+     */
+    void squareDeviceMatrix(const CFP_t *matrix, CFP_t *result, size_t dim) {
+        cublasHandle_t blas_handle =
+            BaseType::getDataBuffer().getCublasHandle();
+        const CFP_t alpha = cuUtil::ONE<CFP_t>();
+        const CFP_t beta = cuUtil::ZERO<CFP_t>();
+        const int n = static_cast<int>(dim);
+        // (M M)^T = M^T M^T, so the column-major product of the row-major
+        // data is the row-major square
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            PL_CUBLAS_IS_SUCCESS(cublasZgemm(blas_handle, CUBLAS_OP_N,
+                                             CUBLAS_OP_N, n, n, n, &alpha,
+                                             matrix, n, matrix, n, &beta,
+                                             result, n));
+        } else {
+            PL_CUBLAS_IS_SUCCESS(cublasCgemm(blas_handle, CUBLAS_OP_N,
+                                             CUBLAS_OP_N, n, n, n, &alpha,
+                                             matrix, n, matrix, n, &beta,
+                                             result, n));
+        }
+    }
+
+    /**
+     * @brief Get the custatevec data and compute types of this precision.
+     */
+    static auto getCudaTypes()
+        -> std::pair<cudaDataType_t, custatevecComputeType_t> {
+        if constexpr (std::is_same_v<CFP_t, cuDoubleComplex> ||
+                      std::is_same_v<CFP_t, double2>) {
+            return {CUDA_C_64F, CUSTATEVEC_COMPUTE_64F};
+        } else {
+            return {CUDA_C_32F, CUSTATEVEC_COMPUTE_32F};
+        }
+    }
+
+    /**
+     * @brief Check that a compiled list targets this state-vector.
+     */
+    void checkCompiledOps(const CompiledOps<Precision> &ops) const {
+        PL_ABORT_IF(ops.getNumQubits() != BaseType::getNumQubits(),
+                    "The compiled operations target a different number of "
+                    "qubits.");
+        PL_ABORT_IF(ops.getDevTag().getDeviceID() !=
+                        BaseType::getDataBuffer().getDevTag().getDeviceID(),
+                    "The compiled operations belong to a different device.");
+    }
+
+    /**
+     * @brief Issue the custatevec calls of all operations of a compiled list,
+     * or of their adjoints in reverse order.
+     */
+    void issueCompiledOps(const CompiledOps<Precision> &ops, bool adjoint,
+                          void *workspace, custatevecHandle_t cusv_handle) {
+        const auto num_ops = ops.getNumOps();
+        for (std::size_t i = 0; i < num_ops; i++) {
+            applyCompiledOp(ops, adjoint ? num_ops - 1 - i : i, adjoint,
+                            workspace, cusv_handle);
+        }
+    }
+
+    /**
+     * @brief Apply a compiled list by launching its captured graph,
+     * capturing it first if needed. See `setUseGraphs`.
+     */
+    void applyCompiledGraph(const CompiledOps<Precision> &ops, bool adjoint,
+                            void *workspace) {
+        // Report unsupported gates before any capture
+        for (std::size_t i = 0; i < ops.getNumOps(); i++) {
+            if (!ops.getOp(i).supported) {
+                throw LightningException("Currently unsupported gate: " +
+                                         ops.getOpName(i));
+            }
+        }
+        const GraphKey key{ops.getId(), ops.getRevision(), BaseType::getData(),
+                           workspace};
+        auto &captured = graphs_[adjoint ? 1 : 0];
+        if (!captured.graph.isInstantiated() || !(captured.key == key)) {
+            const auto &dev_tag = BaseType::getDataBuffer().getDevTag();
+            auto &context =
+                DeviceContext<Precision>::getInstance(dev_tag.getDeviceID());
+            if (capture_stream_ == nullptr) {
+                // The legacy default stream cannot be captured
+                cuUtil::CudaScopedDevice scoped_device(dev_tag.getDeviceID());
+                PL_CUDA_IS_SUCCESS(cudaStreamCreateWithFlags(
+                    &capture_stream_, cudaStreamNonBlocking));
+            }
+            auto capture_handle = context.getHandle(capture_stream_);
+            try {
+                captured.graph.capture(capture_stream_, [&]() {
+                    issueCompiledOps(ops, adjoint, workspace, capture_handle);
+                });
+            } catch (const LightningException &) {
+                // Not capturable: fall back to direct calls from now on
+                setUseGraphs(false);
+                issueCompiledOps(ops, adjoint, workspace, handle);
+                return;
+            }
+            captured.key = key;
+        }
+        captured.graph.launch(BaseType::getStream());
+        graph_launches_++;
+        BaseType::markModified();
+    }
+
+    /**
+     * @brief Issue the custatevec calls of one compiled operation.
+     *
+     * @param ops Compiled operation list.
+     * @param op_idx Index of the operation to apply.
+     * @param adjoint Apply the adjoint of the operation.
+     * @param workspace Workspace of at least `ops.getWorkspaceSize()` bytes.
+     * @param cusv_handle custatevec handle bound to the stream to issue on.
+     */
+    void applyCompiledOp(const CompiledOps<Precision> &ops, std::size_t op_idx,
+                         bool adjoint, void *workspace,
+                         custatevecHandle_t cusv_handle) {
+        using KernelType = typename CompiledOps<Precision>::KernelType;
+        const auto &op = ops.getOp(op_idx);
+        if (!op.supported) {
+            throw LightningException("Currently unsupported gate: " +
+                                     ops.getOpName(op_idx));
+        }
+        const auto types = getCudaTypes();
+        const auto &kernels = ops.getKernels();
+        for (std::size_t k = 0; k < op.num_kernels; k++) {
+            const auto &kernel =
+                kernels[op.first_kernel +
+                        (adjoint ? op.num_kernels - 1 - k : k)];
+            const bool use_adjoint = kernel.adjoint ^ adjoint;
+            if (kernel.type == KernelType::PauliRotation) {
+                PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyPauliRotation(
+                    /* custatevecHandle_t */ cusv_handle,
+                    /* void* */ BaseType::getData(),
+                    /* cudaDataType_t */ types.first,
+                    /* const uint32_t */ BaseType::getNumQubits(),
+                    /* double */ use_adjoint ? -kernel.angle : kernel.angle,
+                    /* const custatevecPauli_t* */ ops.getPaulis(kernel),
+                    /* const int32_t* */ ops.getTargets(kernel),
+                    /* const uint32_t */ kernel.num_targets,
+                    /* const int32_t* */ ops.getControls(kernel),
+                    /* const int32_t* */ nullptr,
+                    /* const uint32_t */ kernel.num_controls));
+                BaseType::markModified();
+            } else {
+                PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrix(
+                    /* custatevecHandle_t */ cusv_handle,
+                    /* void* */ BaseType::getData(),
+                    /* cudaDataType_t */ types.first,
+                    /* const uint32_t */ BaseType::getNumQubits(),
+                    /* const void* */ ops.getMatrix(kernel),
+                    /* cudaDataType_t */ types.first,
+                    /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+                    /* const int32_t */ use_adjoint,
+                    /* const int32_t* */ ops.getTargets(kernel),
+                    /* const uint32_t */ kernel.num_targets,
+                    /* const int32_t* */ ops.getControls(kernel),
+                    /* const int32_t* */ nullptr,
+                    /* const uint32_t */ kernel.num_controls,
+                    /* custatevecComputeType_t */ types.second,
+                    /* void* */ workspace,
+                    /* size_t */ ops.getWorkspaceSize()));
+                BaseType::markModified();
+            }
+        }
+    }
+
     /**
      * @brief Apply parametric Pauli gates using custateVec calls.
      *
@@ -1002,6 +2199,7 @@ class StateVectorCudaManaged
             /* const int32_t* */ ctrlsInt.data(),
             /* const int32_t* */ nullptr,
             /* const uint32_t */ ctrls.size()));
+        BaseType::markModified();
     }
 
     /**
@@ -1020,6 +2218,7 @@ class StateVectorCudaManaged
                                const std::vector<std::size_t> &ctrls,
                                const std::vector<std::size_t> &tgts,
                                bool use_adjoint = false) {
+        PL_NVTX_RANGE("applyDeviceMatrixGate");
         void *extraWorkspace = nullptr;
         size_t extraWorkspaceSizeInBytes = 0;
         int nIndexBits = BaseType::getNumQubits();
@@ -1062,11 +2261,8 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse external workspace, growing it if necessary
+        extraWorkspace = workspace_.getWorkspace(extraWorkspaceSizeInBytes);
 
         // apply gate
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrix(
@@ -1086,8 +2282,7 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+        BaseType::markModified();
     }
 
     /**
@@ -1146,11 +2341,8 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        // allocate external workspace if necessary
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse external workspace, growing it if necessary
+        extraWorkspace = workspace_.getWorkspace(extraWorkspaceSizeInBytes);
 
         // apply gate
         PL_CUSTATEVEC_IS_SUCCESS(custatevecApplyMatrix(
@@ -1170,8 +2362,7 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
+        BaseType::markModified();
     }
     void applyHostMatrixGate(const std::vector<std::complex<Precision>> &matrix,
                              const std::vector<std::size_t> &ctrls,
@@ -1195,6 +2386,11 @@ class StateVectorCudaManaged
      */
     auto getExpectationValueHostMatrix(const std::vector<CFP_t> &matrix,
                                        const std::vector<std::size_t> &tgts) {
+        if constexpr (std::is_same_v<CFP_t, cuComplex>) {
+            if (mixed_precision_) {
+                return getExpectationValueMixed(matrix.data(), tgts);
+            }
+        }
         void *extraWorkspace = nullptr;
         size_t extraWorkspaceSizeInBytes = 0;
 
@@ -1229,10 +2425,8 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse external workspace, growing it if necessary
+        extraWorkspace = workspace_.getWorkspace(extraWorkspaceSizeInBytes);
 
         CFP_t expect;
 
@@ -1253,8 +2447,6 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
         return expect;
     }
 
@@ -1267,6 +2459,11 @@ class StateVectorCudaManaged
      */
     auto getExpectationValueDeviceMatrix(const CFP_t *matrix,
                                          const std::vector<std::size_t> &tgts) {
+        if constexpr (std::is_same_v<CFP_t, cuComplex>) {
+            if (mixed_precision_) {
+                return getExpectationValueMixed(matrix, tgts);
+            }
+        }
         void *extraWorkspace = nullptr;
         size_t extraWorkspaceSizeInBytes = 0;
 
@@ -1301,10 +2498,8 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* size_t* */ &extraWorkspaceSizeInBytes));
 
-        if (extraWorkspaceSizeInBytes > 0) {
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(&extraWorkspace, extraWorkspaceSizeInBytes));
-        }
+        // reuse external workspace, growing it if necessary
+        extraWorkspace = workspace_.getWorkspace(extraWorkspaceSizeInBytes);
 
         CFP_t expect;
 
@@ -1325,11 +2520,95 @@ class StateVectorCudaManaged
             /* custatevecComputeType_t */ compute_type,
             /* void* */ extraWorkspace,
             /* size_t */ extraWorkspaceSizeInBytes));
-
-        if (extraWorkspaceSizeInBytes)
-            PL_CUDA_IS_SUCCESS(cudaFree(extraWorkspace));
         return expect;
     }
+
+    /**
+     * @brief Get the expectation value of a host or device matrix for a
+     * single-precision state-vector, accumulated in double precision.
+     *
+     * @param matrix Host or device defined row-major order gate matrix array.
+     * @param tgts Target qubits.
+     * @return cuComplex Expectation value.
+     */
+    auto getExpectationValueMixed(const cuComplex *matrix,
+                                  const std::vector<std::size_t> &tgts)
+        -> cuComplex {
+        std::vector<int> tgtsInt(tgts.size());
+        std::transform(
+            tgts.begin(), tgts.end(), tgtsInt.begin(), [&](std::size_t x) {
+                return static_cast<int>(BaseType::getNumQubits() - 1 - x);
+            });
+
+        // The 64-bit compute type requires a complex128 matrix
+        const std::size_t dim = Util::exp2(tgts.size());
+        std::vector<cuComplex> matrix_host(dim * dim);
+        PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+            matrix_host.data(), matrix, sizeof(cuComplex) * matrix_host.size(),
+            cudaMemcpyDefault, BaseType::getStream()));
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(BaseType::getStream()));
+        std::vector<cuDoubleComplex> matrix_64(matrix_host.size());
+        std::transform(matrix_host.begin(), matrix_host.end(),
+                       matrix_64.begin(), [](const cuComplex &value) {
+                           return make_cuDoubleComplex(value.x, value.y);
+                       });
+
+        const auto nIndexBits =
+            static_cast<uint32_t>(BaseType::getNumQubits());
+        size_t extraWorkspaceSizeInBytes = 0;
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectationGetWorkspaceSize(
+            /* custatevecHandle_t */ handle,
+            /* cudaDataType_t */ CUDA_C_32F,
+            /* const uint32_t */ nIndexBits,
+            /* const void* */ matrix_64.data(),
+            /* cudaDataType_t */ CUDA_C_64F,
+            /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+            /* const uint32_t */ tgtsInt.size(),
+            /* custatevecComputeType_t */ CUSTATEVEC_COMPUTE_64F,
+            /* size_t* */ &extraWorkspaceSizeInBytes));
+        void *extraWorkspace =
+            workspace_.getWorkspace(extraWorkspaceSizeInBytes);
+
+        cuDoubleComplex expect;
+        PL_CUSTATEVEC_IS_SUCCESS(custatevecComputeExpectation(
+            /* custatevecHandle_t */ handle,
+            /* void* */ BaseType::getData(),
+            /* cudaDataType_t */ CUDA_C_32F,
+            /* const uint32_t */ nIndexBits,
+            /* void* */ &expect,
+            /* cudaDataType_t */ CUDA_C_64F,
+            /* double* */ nullptr,
+            /* const void* */ matrix_64.data(),
+            /* cudaDataType_t */ CUDA_C_64F,
+            /* custatevecMatrixLayout_t */ CUSTATEVEC_MATRIX_LAYOUT_ROW,
+            /* const int32_t* */ tgtsInt.data(),
+            /* const uint32_t */ tgtsInt.size(),
+            /* custatevecComputeType_t */ CUSTATEVEC_COMPUTE_64F,
+            /* void* */ extraWorkspace,
+            /* size_t */ extraWorkspaceSizeInBytes));
+        return make_cuFloatComplex(static_cast<float>(expect.x),
+                                   static_cast<float>(expect.y));
+    }
+
+    /**
+     * @brief Inner product `<sv|other>` of single-precision vectors of the
+     * length of this state-vector, accumulated in double precision.
+     *
+     * @param sv Device data of the bra.
+     * @param other Device data of the ket.
+     */
+    auto innerProductMixed(const cuComplex *sv, const cuComplex *other)
+        -> cuDoubleComplex {
+        DataBuffer<cuDoubleComplex> result{
+            1, BaseType::getDataBuffer().getDevTag()};
+        PL_CUDA_IS_SUCCESS(innerProdsMixed_CUDA(sv, other,
+                                                BaseType::getLength(), 1,
+                                                result.getData(),
+                                                BaseType::getStream()));
+        cuDoubleComplex value;
+        result.CopyGpuDataToHost(&value, 1, false);
+        return value;
+    }
 };
 
 }; // namespace Pennylane
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <vector>
+
+#include "DeviceContext.hpp"
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Fixed-size pool of non-blocking CUDA streams on a single device, with
+ * the events needed to fork work out from, and join it back into, another
+ * stream.
+ *
+ * Streams are created with `cudaStreamNonBlocking`, so they do not implicitly
+ * synchronize with the legacy default stream; ordering with other streams is
+ * only established through `fork`, `join` and `synchronize`. The handles
+ * bound to the streams (see `releaseStreamHandles`) are released with the
+ * pool.
+ */
+class StreamPool {
+  public:
+    /**
+     * @brief Create `num_streams` streams on the given device.
+     *
+     * @param device_id CUDA device index.
+     * @param num_streams Number of streams in the pool.
+     */
+    StreamPool(int device_id, std::size_t num_streams)
+        : device_id_{device_id}, streams_(num_streams),
+          join_events_(num_streams) {
+        Util::CudaScopedDevice scoped_device(device_id_);
+        PL_CUDA_IS_SUCCESS(
+            cudaEventCreateWithFlags(&fork_event_, cudaEventDisableTiming));
+        for (std::size_t i = 0; i < num_streams; i++) {
+            PL_CUDA_IS_SUCCESS(
+                cudaStreamCreateWithFlags(&streams_[i], cudaStreamNonBlocking));
+            PL_CUDA_IS_SUCCESS(cudaEventCreateWithFlags(
+                &join_events_[i], cudaEventDisableTiming));
+        }
+    }
+
+    StreamPool() = delete;
+    StreamPool(const StreamPool &) = delete;
+    StreamPool &operator=(const StreamPool &) = delete;
+
+    ~StreamPool() {
+        // Throwing exceptions from a destructor can be dangerous; ignore
+        // errors on teardown.
+        try {
+            Util::CudaScopedDevice scoped_device(device_id_);
+            for (std::size_t i = 0; i < streams_.size(); i++) {
+                cudaStreamSynchronize(streams_[i]);
+                // State-vectors bound to the stream may have requested
+                // handles for it
+                releaseStreamHandles(device_id_, streams_[i]);
+                cudaEventDestroy(join_events_[i]);
+                cudaStreamDestroy(streams_[i]);
+            }
+            cudaEventDestroy(fork_event_);
+        } catch (...) {
+        }
+    }
+
+    [[nodiscard]] auto getStream(std::size_t idx) const -> cudaStream_t {
+        return streams_.at(idx);
+    }
+    [[nodiscard]] auto getNumStreams() const -> std::size_t {
+        return streams_.size();
+    }
+    [[nodiscard]] auto getDeviceID() const -> int { return device_id_; }
+
+    /**
+     * @brief Make all pool streams wait for the work currently enqueued on
+     * `upstream`.
+     *
+     * @param upstream Stream to fork from.
+     */
+    void fork(cudaStream_t upstream) {
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(fork_event_, upstream));
+        for (auto &stream : streams_) {
+            PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(stream, fork_event_, 0));
+        }
+    }
+
+    /**
+     * @brief Make `downstream` wait for the work currently enqueued on all
+     * pool streams.
+     *
+     * @param downstream Stream to join into.
+     */
+    void join(cudaStream_t downstream) {
+        for (std::size_t i = 0; i < streams_.size(); i++) {
+            PL_CUDA_IS_SUCCESS(cudaEventRecord(join_events_[i], streams_[i]));
+            PL_CUDA_IS_SUCCESS(
+                cudaStreamWaitEvent(downstream, join_events_[i], 0));
+        }
+    }
+
+    /**
+     * @brief Block the host until all pool streams are idle.
+     */
+    void synchronize() {
+        for (auto &stream : streams_) {
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(stream));
+        }
+    }
+
+  private:
+    int device_id_;
+    std::vector<cudaStream_t> streams_;
+    std::vector<cudaEvent_t> join_events_;
+    cudaEvent_t fork_event_;
+};
+
+} // namespace Pennylane::CUDA
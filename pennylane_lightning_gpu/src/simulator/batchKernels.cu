@@ -0,0 +1,149 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file batchKernels.cu
+ * Gate application over batches of contiguous state-vectors.
+ */
+#include <algorithm>
+#include <cstddef>
+
+#include <cuComplex.h>
+#include <cuda_runtime.h>
+
+namespace {
+/// Largest number of gate wires handled by the batched matrix kernel.
+constexpr unsigned int max_batched_targets = 4;
+
+/**
+ * @brief Target index bits of a gate, passed to the kernel by value.
+ */
+struct BatchedTargets {
+    int bits[max_batched_targets];        // Matrix bit i acts on bits[i]
+    int sorted_bits[max_batched_targets]; // bits in ascending order
+    unsigned int num_bits;
+};
+
+/**
+ * @brief Apply a dense matrix to each state-vector of a contiguous batch.
+ *
+ * Each thread owns a group of the `2^num_bits` amplitudes coupled by the
+ * gate in one state-vector of the batch, and multiplies them by the matrix
+ * of that state-vector, at `matrices + batch * matrix_stride`. A stride of 0
+ * applies the same matrix to all state-vectors.
+ */
+template <class CFP_t>
+__global__ void batchedMatrixKernel(CFP_t *sv, std::size_t state_length,
+                                    std::size_t num_groups,
+                                    std::size_t batch_size,
+                                    const CFP_t *matrices,
+                                    std::size_t matrix_stride,
+                                    BatchedTargets targets) {
+    using fp_t = decltype(CFP_t{}.x);
+    const unsigned int dim = 1U << targets.num_bits;
+    CFP_t amps[1U << max_batched_targets];
+    std::size_t offsets[1U << max_batched_targets];
+
+    for (std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+         idx < num_groups * batch_size; idx += blockDim.x * gridDim.x) {
+        const std::size_t batch = idx / num_groups;
+        std::size_t base = idx % num_groups;
+        for (unsigned int t = 0; t < targets.num_bits; t++) {
+            const int bit = targets.sorted_bits[t];
+            const std::size_t low = base & ((std::size_t{1} << bit) - 1);
+            base = ((base >> bit) << (bit + 1)) | low;
+        }
+        CFP_t *state = sv + batch * state_length;
+        const CFP_t *mat = matrices + batch * matrix_stride;
+
+        for (unsigned int local = 0; local < dim; local++) {
+            std::size_t offset = base;
+            for (unsigned int t = 0; t < targets.num_bits; t++) {
+                if ((local >> t) & 1U) {
+                    offset |= std::size_t{1} << targets.bits[t];
+                }
+            }
+            offsets[local] = offset;
+            amps[local] = state[offset];
+        }
+        for (unsigned int row = 0; row < dim; row++) {
+            fp_t re = 0;
+            fp_t im = 0;
+            for (unsigned int col = 0; col < dim; col++) {
+                const CFP_t m = mat[row * dim + col];
+                const CFP_t a = amps[col];
+                re += m.x * a.x - m.y * a.y;
+                im += m.x * a.y + m.y * a.x;
+            }
+            state[offsets[row]].x = re;
+            state[offsets[row]].y = im;
+        }
+    }
+}
+
+template <class CFP_t>
+auto launchBatchedMatrix(CFP_t *sv, unsigned int num_qubits,
+                         std::size_t batch_size, const CFP_t *matrices,
+                         std::size_t matrix_stride, const int *tgts,
+                         unsigned int num_tgts, cudaStream_t stream)
+    -> cudaError_t {
+    if (num_tgts > max_batched_targets || num_tgts > num_qubits) {
+        return cudaErrorInvalidValue;
+    }
+    if (batch_size == 0) {
+        return cudaSuccess;
+    }
+    BatchedTargets targets{};
+    targets.num_bits = num_tgts;
+    std::copy(tgts, tgts + num_tgts, targets.bits);
+    std::copy(tgts, tgts + num_tgts, targets.sorted_bits);
+    std::sort(targets.sorted_bits, targets.sorted_bits + num_tgts);
+
+    const std::size_t num_groups = std::size_t{1} << (num_qubits - num_tgts);
+    const std::size_t num_threads = num_groups * batch_size;
+    const unsigned int block_size = 256;
+    const unsigned int num_blocks = static_cast<unsigned int>(std::min<
+        std::size_t>((num_threads + block_size - 1) / block_size, 65535));
+    batchedMatrixKernel<CFP_t><<<num_blocks, block_size, 0, stream>>>(
+        sv, std::size_t{1} << num_qubits, num_groups, batch_size, matrices,
+        matrix_stride, targets);
+    return cudaGetLastError();
+}
+} // namespace
+
+namespace Pennylane {
+
+unsigned int getMaxBatchedTargets_CUDA() { return max_batched_targets; }
+
+cudaError_t applyBatchedMatrix_CUDA(cuComplex *sv, unsigned int num_qubits,
+                                    std::size_t batch_size,
+                                    const cuComplex *matrices,
+                                    std::size_t matrix_stride, const int *tgts,
+                                    unsigned int num_tgts,
+                                    cudaStream_t stream) {
+    return launchBatchedMatrix(sv, num_qubits, batch_size, matrices,
+                               matrix_stride, tgts, num_tgts, stream);
+}
+
+cudaError_t applyBatchedMatrix_CUDA(cuDoubleComplex *sv,
+                                    unsigned int num_qubits,
+                                    std::size_t batch_size,
+                                    const cuDoubleComplex *matrices,
+                                    std::size_t matrix_stride, const int *tgts,
+                                    unsigned int num_tgts,
+                                    cudaStream_t stream) {
+    return launchBatchedMatrix(sv, num_qubits, batch_size, matrices,
+                               matrix_stride, tgts, num_tgts, stream);
+}
+
+} // namespace Pennylane
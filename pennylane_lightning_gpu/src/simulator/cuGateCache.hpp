@@ -2,6 +2,10 @@
 
 #include <cmath>
 #include <complex>
+#include <iterator>
+#include <list>
+#include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -48,6 +52,18 @@ template <class fp_t> class GateCache {
             defaultPopulateCache();
         }
     }
+    /**
+     * @brief Create a cache bounded to `capacity_bytes` of device memory.
+     * See `setCapacity`.
+     */
+    GateCache(bool populate, const DevTag<int> &device_tag,
+              std::size_t capacity_bytes)
+        : GateCache(false, device_tag) {
+        setCapacity(capacity_bytes);
+        if (populate) {
+            defaultPopulateCache();
+        }
+    }
     virtual ~GateCache(){};
 
     /**
@@ -143,14 +159,94 @@ template <class fp_t> class GateCache {
             std::forward_as_tuple(
                 host_gates_.at(std::make_pair(std::string{"SWAP"}, 0.0))));
 
-        for (const auto &[h_gate_k, h_gate_v] : host_gates_) {
-            device_gates_.emplace(
-                std::piecewise_construct, std::forward_as_tuple(h_gate_k),
-                std::forward_as_tuple(h_gate_v.size(), device_tag_));
-            device_gates_.at(h_gate_k).CopyHostDataToGpu(h_gate_v.data(),
-                                                         h_gate_v.size());
-            total_alloc_bytes_ += (sizeof(CFP_t) * h_gate_v.size());
+        // Default gates are pinned, so the explicit gate calls can always
+        // find them
+        auto defaults = std::move(host_gates_);
+        host_gates_.clear();
+        for (auto &[h_gate_k, h_gate_v] : defaults) {
+            insertGate(h_gate_k, std::move(h_gate_v), true);
+        }
+    }
+
+    /**
+     * @brief Bound the device memory used by the cache. In bounded mode all
+     * matrices are placed in a single device slab of `capacity_bytes`, and
+     * the least recently used gates are evicted to make room for new ones.
+     * A capacity of 0 restores the default unbounded mode, with one device
+     * allocation per gate. Gates added since construction are dropped, while
+     * the default gates are kept.
+     *
+     * @param capacity_bytes Size of the device slab in bytes, or 0.
+     */
+    void setCapacity(std::size_t capacity_bytes) {
+        std::vector<std::pair<gate_id, std::vector<CFP_t>>> pinned;
+        for (auto &[gate_key, entry] : device_gates_) {
+            if (entry.pinned) {
+                pinned.emplace_back(gate_key,
+                                    std::move(host_gates_.at(gate_key)));
+            }
+        }
+        device_gates_.clear();
+        host_gates_.clear();
+        lru_.clear();
+        free_ranges_.clear();
+        slab_.reset();
+        total_alloc_bytes_ = 0;
+        used_bytes_ = 0;
+
+        capacity_bytes_ = capacity_bytes;
+        if (capacity_bytes_ > 0) {
+            const std::size_t slab_length = capacity_bytes_ / sizeof(CFP_t);
+            PL_ABORT_IF(slab_length == 0,
+                        "The gate cache capacity is too small.");
+            slab_ = std::make_unique<CUDA::DataBuffer<CFP_t>>(slab_length,
+                                                              device_tag_);
+            free_ranges_.emplace(0, slab_length);
+            total_alloc_bytes_ = slab_length * sizeof(CFP_t);
         }
+        for (auto &[gate_key, host_data] : pinned) {
+            insertGate(gate_key, std::move(host_data), true);
+        }
+    }
+
+    /**
+     * @brief Get the capacity in bytes of the cache, or 0 if unbounded.
+     */
+    [[nodiscard]] auto getCapacity() const -> std::size_t {
+        return capacity_bytes_;
+    }
+
+    /**
+     * @brief Get the device memory in bytes allocated by the cache. In
+     * bounded mode this is the size of the slab.
+     */
+    [[nodiscard]] auto getTotalAllocBytes() const -> std::size_t {
+        return total_alloc_bytes_;
+    }
+
+    /**
+     * @brief Get the device memory in bytes held by cached gates.
+     */
+    [[nodiscard]] auto getUsedBytes() const -> std::size_t {
+        return used_bytes_;
+    }
+
+    /**
+     * @brief Get the number of device pointer lookups served by a gate
+     * already in the cache.
+     */
+    [[nodiscard]] auto getHits() const -> std::size_t { return hits_; }
+
+    /**
+     * @brief Get the number of gates added to the cache after construction.
+     */
+    [[nodiscard]] auto getMisses() const -> std::size_t { return misses_; }
+
+    /**
+     * @brief Get the number of gates evicted to make room for new ones.
+     */
+    [[nodiscard]] auto getEvictions() const -> std::size_t {
+        return evictions_;
     }
 
     /**
@@ -161,8 +257,9 @@ template <class fp_t> class GateCache {
      * @return false Gate does not exist in cache.
      */
     bool gateExists(const gate_id &gate) {
-        return ((host_gates_.find(gate) != host_gates_.end()) &&
-                (device_gates_.find(gate)) != device_gates_.end());
+        return device_gates_.find(gate) != device_gates_.end() ||
+               (shared_gates_ != nullptr &&
+                shared_gates_->find_gate_device_ptr(gate) != nullptr);
     }
     /**
      * @brief Check for the existence of a given gate.
@@ -173,10 +270,7 @@ template <class fp_t> class GateCache {
      * @return false Gate does not exist in cache.
      */
     bool gateExists(const std::string &gate_name, fp_t gate_param) {
-        return (host_gates_.find(std::make_pair(gate_name, gate_param)) !=
-                host_gates_.end()) &&
-               (device_gates_.find(std::make_pair(gate_name, gate_param)) !=
-                device_gates_.end());
+        return gateExists(std::make_pair(gate_name, gate_param));
     }
 
     /**
@@ -189,16 +283,7 @@ template <class fp_t> class GateCache {
      */
     void add_gate(const std::string &gate_name, fp_t gate_param,
                   std::vector<CFP_t> host_data) {
-        const auto gate_key = std::make_pair(gate_name, gate_param);
-        host_gates_[gate_key] = std::move(host_data);
-        auto &gate = host_gates_[gate_key];
-
-        device_gates_.emplace(std::piecewise_construct,
-                              std::forward_as_tuple(gate_key),
-                              std::forward_as_tuple(gate.size(), device_tag_));
-        device_gates_.at(gate_key).CopyHostDataToGpu(gate.data(), gate.size());
-
-        this->total_alloc_bytes_ += (sizeof(CFP_t) * gate.size());
+        add_gate(std::make_pair(gate_name, gate_param), std::move(host_data));
     }
 
     /**
@@ -209,20 +294,13 @@ template <class fp_t> class GateCache {
      * @param host_data
      */
     void add_gate(const gate_id &gate_key, std::vector<CFP_t> host_data) {
-        host_gates_[gate_key] = std::move(host_data);
-        auto &gate = host_gates_[gate_key];
-
-        device_gates_.emplace(std::piecewise_construct,
-                              std::forward_as_tuple(gate_key),
-                              std::forward_as_tuple(gate.size(), device_tag_));
-        device_gates_.at(gate_key).CopyHostDataToGpu(gate.data(), gate.size());
-
-        total_alloc_bytes_ += (sizeof(CFP_t) * gate.size());
+        misses_++;
+        insertGate(gate_key, std::move(host_data), false);
     }
 
     /**
      * @brief Returns a pointer to the GPU device memory where the gate is
-     * stored.
+     * stored. The pointer stays valid until the next gate is added.
      *
      * @param gate_name String representing the name of the given gate.
      * @param gate_param Gate parameter value. `0.0` if non-parametric gate.
@@ -230,32 +308,220 @@ template <class fp_t> class GateCache {
      */
     const CFP_t *get_gate_device_ptr(const std::string &gate_name,
                                      fp_t gate_param) {
-        return device_gates_.at(std::make_pair(gate_name, gate_param))
-            .getData();
+        return get_gate_device_ptr(std::make_pair(gate_name, gate_param));
     }
     const CFP_t *get_gate_device_ptr(const gate_id &gate_key) {
-        return device_gates_.at(gate_key).getData();
+        if (shared_gates_ != nullptr &&
+            device_gates_.find(gate_key) == device_gates_.end()) {
+            if (const auto *ptr = shared_gates_->find_gate_device_ptr(gate_key);
+                ptr != nullptr) {
+                hits_++;
+                return ptr;
+            }
+        }
+        auto &entry = device_gates_.at(gate_key);
+        if (entry.fresh) {
+            // First use right after the miss that added it
+            entry.fresh = false;
+        } else {
+            hits_++;
+        }
+        if (!entry.pinned) {
+            lru_.splice(lru_.end(), lru_, entry.lru_pos);
+        }
+        return (entry.buffer != nullptr) ? entry.buffer->getData()
+                                         : slab_->getData() + entry.offset;
     }
     auto get_gate_host(const std::string &gate_name, fp_t gate_param) {
         return host_gates_.at(std::make_pair(gate_name, gate_param));
     }
     auto get_gate_host(const gate_id &gate_key) {
+        if (shared_gates_ != nullptr &&
+            host_gates_.find(gate_key) == host_gates_.end()) {
+            return shared_gates_->host_gates_.at(gate_key);
+        }
         return host_gates_.at(gate_key);
     }
 
+    /**
+     * @brief Read-only lookup of a gate, without updating the counters or
+     * the eviction order, so that a cache can be shared between threads.
+     *
+     * @return const CFP_t* Pointer to gate values on device, or `nullptr` if
+     * the gate is not stored in this cache.
+     */
+    [[nodiscard]] auto find_gate_device_ptr(const gate_id &gate_key) const
+        -> const CFP_t * {
+        const auto it = device_gates_.find(gate_key);
+        if (it == device_gates_.end()) {
+            return nullptr;
+        }
+        const auto &entry = it->second;
+        return (entry.buffer != nullptr) ? entry.buffer->getData()
+                                         : slab_->getData() + entry.offset;
+    }
+
+    /**
+     * @brief Fall back to `shared_gates` for the gates missing from this
+     * cache. The shared cache is only read through `find_gate_device_ptr`,
+     * so a single populated cache, such as the default gates of a
+     * `DeviceContext`, can serve many caches without copies of its gates.
+     *
+     * @param shared_gates Cache on the same device, or `nullptr`.
+     */
+    void setSharedGates(std::shared_ptr<const GateCache> shared_gates) {
+        shared_gates_ = std::move(shared_gates);
+    }
+
   private:
     const DevTag<int> device_tag_;
+    std::shared_ptr<const GateCache> shared_gates_{nullptr};
     std::size_t total_alloc_bytes_;
+    std::size_t capacity_bytes_{0};
+    std::size_t used_bytes_{0};
+    std::size_t hits_{0};
+    std::size_t misses_{0};
+    std::size_t evictions_{0};
 
     struct gate_id_hash {
         template <class T1, class T2>
         std::size_t operator()(const std::pair<T1, T2> &pair) const {
-            return std::hash<T1>()(pair.first) ^ std::hash<T2>()(pair.second);
+            // Mix the hashes as boost::hash_combine does; a plain XOR maps
+            // every zero-parameter gate onto the hash of its name alone.
+            std::size_t seed = std::hash<T1>()(pair.first);
+            seed ^= std::hash<T2>()(pair.second) + 0x9e3779b97f4a7c15ULL +
+                    (seed << 6U) + (seed >> 2U);
+            return seed;
         }
     };
 
-    std::unordered_map<gate_id, CUDA::DataBuffer<CFP_t>, gate_id_hash>
-        device_gates_;
+    struct Entry {
+        /// Own device storage, used when the cache is unbounded.
+        std::unique_ptr<CUDA::DataBuffer<CFP_t>> buffer;
+        /// Offset into the slab, used when the cache is bounded.
+        std::size_t offset{0};
+        std::size_t length{0};
+        /// Default gates are never evicted.
+        bool pinned{false};
+        /// Added since its last lookup.
+        bool fresh{false};
+        typename std::list<gate_id>::iterator lru_pos;
+    };
+
+    std::unordered_map<gate_id, Entry, gate_id_hash> device_gates_;
     std::unordered_map<gate_id, std::vector<CFP_t>, gate_id_hash> host_gates_;
+    /// Evictable gates, least recently used first.
+    std::list<gate_id> lru_;
+    std::unique_ptr<CUDA::DataBuffer<CFP_t>> slab_;
+    /// Free ranges of the slab, as offset and length in elements.
+    std::map<std::size_t, std::size_t> free_ranges_;
+
+    /**
+     * @brief Store a gate on the host and the device, replacing any gate with
+     * the same key.
+     */
+    void insertGate(const gate_id &gate_key, std::vector<CFP_t> host_data,
+                    bool pinned) {
+        const auto existing = device_gates_.find(gate_key);
+        if (existing != device_gates_.end()) {
+            pinned = pinned || existing->second.pinned;
+            removeGate(gate_key);
+        }
+        auto &gate = host_gates_[gate_key];
+        gate = std::move(host_data);
+
+        Entry entry;
+        entry.length = gate.size();
+        entry.pinned = pinned;
+        if (slab_ == nullptr) {
+            entry.buffer = std::make_unique<CUDA::DataBuffer<CFP_t>>(
+                gate.size(), device_tag_);
+            entry.buffer->CopyHostDataToGpu(gate.data(), gate.size());
+            total_alloc_bytes_ += (sizeof(CFP_t) * gate.size());
+        } else {
+            entry.offset = allocateSlot(gate.size());
+            // Stream-ordered, so kernels still reading the matrix of an
+            // evicted gate complete before its slot is overwritten
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
+                slab_->getData() + entry.offset, gate.data(),
+                sizeof(CFP_t) * gate.size(), cudaMemcpyHostToDevice,
+                device_tag_.getStreamID()));
+        }
+        used_bytes_ += sizeof(CFP_t) * gate.size();
+        if (!pinned) {
+            entry.lru_pos = lru_.insert(lru_.end(), gate_key);
+            entry.fresh = true;
+        }
+        device_gates_.emplace(gate_key, std::move(entry));
+    }
+
+    /**
+     * @brief Drop a gate from the host and the device.
+     */
+    void removeGate(const gate_id &gate_key) {
+        auto &entry = device_gates_.at(gate_key);
+        if (entry.buffer == nullptr) {
+            releaseSlot(entry.offset, entry.length);
+        } else {
+            total_alloc_bytes_ -= sizeof(CFP_t) * entry.length;
+        }
+        if (!entry.pinned) {
+            lru_.erase(entry.lru_pos);
+        }
+        used_bytes_ -= sizeof(CFP_t) * entry.length;
+        device_gates_.erase(gate_key);
+        host_gates_.erase(gate_key);
+    }
+
+    /**
+     * @brief Reserve `length` contiguous elements of the slab, evicting the
+     * least recently used gates until a large enough range is free.
+     *
+     * @return Offset of the reserved range.
+     */
+    auto allocateSlot(std::size_t length) -> std::size_t {
+        PL_ABORT_IF(length > slab_->getLength(),
+                    "The gate matrix exceeds the gate cache capacity.");
+        while (true) {
+            for (auto it = free_ranges_.begin(); it != free_ranges_.end();
+                 ++it) {
+                if (it->second >= length) {
+                    const auto offset = it->first;
+                    const auto remaining = it->second - length;
+                    free_ranges_.erase(it);
+                    if (remaining > 0) {
+                        free_ranges_.emplace(offset + length, remaining);
+                    }
+                    return offset;
+                }
+            }
+            PL_ABORT_IF(lru_.empty(),
+                        "The gate cache capacity is exhausted by its default "
+                        "gates.");
+            const auto victim = lru_.front();
+            removeGate(victim);
+            evictions_++;
+        }
+    }
+
+    /**
+     * @brief Return a range to the slab, merging it with its free neighbours.
+     */
+    void releaseSlot(std::size_t offset, std::size_t length) {
+        auto next = free_ranges_.lower_bound(offset);
+        if (next != free_ranges_.end() && offset + length == next->first) {
+            length += next->second;
+            next = free_ranges_.erase(next);
+        }
+        if (next != free_ranges_.begin()) {
+            auto prev = std::prev(next);
+            if (prev->first + prev->second == offset) {
+                prev->second += length;
+                return;
+            }
+        }
+        free_ranges_.emplace_hint(next, offset, length);
+    }
 };
+
 } // namespace Pennylane::CUDA
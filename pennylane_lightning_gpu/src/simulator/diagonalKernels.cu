@@ -0,0 +1,85 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file diagonalKernels.cu
+ * Single-sweep application of diagonal gate generators.
+ */
+#include <algorithm>
+#include <cstddef>
+
+#include <cuComplex.h>
+#include <cuda_runtime.h>
+
+namespace {
+/**
+ * @brief Apply the diagonal operator `P Z_s` to a state-vector, where `Z_s` is
+ * the tensor product of Pauli-Z on the index bits of `z_mask`, and `P` the
+ * projector onto the states with all index bits of `projector_mask` set.
+ *
+ * Amplitudes outside the projector are zeroed, and the others are negated
+ * when an odd number of their `z_mask` bits are set.
+ */
+template <class CFP_t>
+__global__ void diagonalGeneratorKernel(CFP_t *sv, std::size_t length,
+                                        unsigned long long z_mask,
+                                        unsigned long long projector_mask) {
+    for (std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+         idx < length; idx += blockDim.x * gridDim.x) {
+        const auto index = static_cast<unsigned long long>(idx);
+        if ((index & projector_mask) != projector_mask) {
+            sv[idx].x = 0;
+            sv[idx].y = 0;
+        } else if (__popcll(index & z_mask) & 1) {
+            sv[idx].x = -sv[idx].x;
+            sv[idx].y = -sv[idx].y;
+        }
+    }
+}
+
+template <class CFP_t>
+auto launchDiagonalGenerator(CFP_t *sv, std::size_t length,
+                             std::size_t z_mask, std::size_t projector_mask,
+                             cudaStream_t stream) -> cudaError_t {
+    if (length == 0 || (z_mask == 0 && projector_mask == 0)) {
+        return cudaSuccess;
+    }
+    const unsigned int block_size = 256;
+    const unsigned int num_blocks = static_cast<unsigned int>(std::min<
+        std::size_t>((length + block_size - 1) / block_size, 65535));
+    diagonalGeneratorKernel<CFP_t><<<num_blocks, block_size, 0, stream>>>(
+        sv, length, z_mask, projector_mask);
+    return cudaGetLastError();
+}
+} // namespace
+
+namespace Pennylane {
+
+cudaError_t applyDiagonalGenerator_CUDA(cuComplex *sv, std::size_t length,
+                                        std::size_t z_mask,
+                                        std::size_t projector_mask,
+                                        cudaStream_t stream) {
+    return launchDiagonalGenerator(sv, length, z_mask, projector_mask,
+                                   stream);
+}
+
+cudaError_t applyDiagonalGenerator_CUDA(cuDoubleComplex *sv,
+                                        std::size_t length,
+                                        std::size_t z_mask,
+                                        std::size_t projector_mask,
+                                        cudaStream_t stream) {
+    return launchDiagonalGenerator(sv, length, z_mask, projector_mask,
+                                   stream);
+}
+
+} // namespace Pennylane
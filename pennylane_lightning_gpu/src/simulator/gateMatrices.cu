@@ -0,0 +1,79 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file gateMatrices.cu
+ * Device-side generation of parametric gate matrices.
+ */
+#include <cuComplex.h>
+#include <cuda_runtime.h>
+
+namespace {
+/**
+ * @brief Write the row-major matrix of an excitation gate: a rotation by
+ * `(c, s)` on the basis states `lo` and `hi`, and the phase `e` on every
+ * other diagonal entry.
+ */
+template <class CFP_t, class PrecisionT>
+__global__ void excitationMatrixKernel(CFP_t *matrix, unsigned int dim,
+                                       unsigned int lo, unsigned int hi,
+                                       PrecisionT c, PrecisionT s, CFP_t e) {
+    const unsigned int idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= dim * dim) {
+        return;
+    }
+    const unsigned int row = idx / dim;
+    const unsigned int col = idx % dim;
+    CFP_t value{0, 0};
+    if (row == col) {
+        value = (row == lo || row == hi) ? CFP_t{c, 0} : e;
+    } else if (row == lo && col == hi) {
+        value = CFP_t{s, 0};
+    } else if (row == hi && col == lo) {
+        value = CFP_t{-s, 0};
+    }
+    matrix[idx] = value;
+}
+
+template <class CFP_t, class PrecisionT>
+auto launchExcitationMatrix(CFP_t *matrix, unsigned int dim, unsigned int lo,
+                            unsigned int hi, PrecisionT c, PrecisionT s,
+                            CFP_t e, cudaStream_t stream) -> cudaError_t {
+    const unsigned int num_elements = dim * dim;
+    const unsigned int block_size = 256;
+    const unsigned int num_blocks =
+        (num_elements + block_size - 1) / block_size;
+    excitationMatrixKernel<CFP_t, PrecisionT>
+        <<<num_blocks, block_size, 0, stream>>>(matrix, dim, lo, hi, c, s, e);
+    return cudaGetLastError();
+}
+} // namespace
+
+namespace Pennylane {
+
+cudaError_t generateExcitationMatrix_CUDA(cuComplex *matrix, unsigned int dim,
+                                          unsigned int lo, unsigned int hi,
+                                          float c, float s, cuComplex e,
+                                          cudaStream_t stream) {
+    return launchExcitationMatrix(matrix, dim, lo, hi, c, s, e, stream);
+}
+
+cudaError_t generateExcitationMatrix_CUDA(cuDoubleComplex *matrix,
+                                          unsigned int dim, unsigned int lo,
+                                          unsigned int hi, double c, double s,
+                                          cuDoubleComplex e,
+                                          cudaStream_t stream) {
+    return launchExcitationMatrix(matrix, dim, lo, hi, c, s, e, stream);
+}
+
+} // namespace Pennylane
@@ -0,0 +1,473 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file measurementKernels.cu
+ * Device-side reductions used by state-vector measurements.
+ */
+#include <algorithm>
+#include <cstddef>
+
+#include <cuComplex.h>
+#include <cuda_runtime.h>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
+
+namespace {
+/// Largest number of observable wires handled by the fused moments kernel.
+constexpr unsigned int max_moment_wires = 5;
+
+/**
+ * @brief Target index bits of an observable, passed to the kernel by value.
+ */
+struct MomentTargets {
+    int bits[max_moment_wires];        // Matrix bit i acts on bits[i]
+    int sorted_bits[max_moment_wires]; // bits in ascending order
+    unsigned int num_bits;
+};
+
+/**
+ * @brief Accumulate Re<psi|O|psi> and <psi|O^2|psi> = |O psi|^2 for a
+ * Hermitian observable `O` in a single sweep over the state-vector.
+ *
+ * Each thread owns groups of the `2^num_bits` amplitudes coupled by the
+ * observable, applies the matrix to them locally and adds both moments to
+ * its partial sums. Partial sums are reduced per block in shared memory and
+ * added to `result[0]` and `result[1]`.
+ *
+ * With a grid of several rows, row `blockIdx.y` handles the state-vector at
+ * `sv + blockIdx.y * state_length` and adds its moments to
+ * `result[2 * blockIdx.y]` and `result[2 * blockIdx.y + 1]`.
+ */
+template <class CFP_t>
+__global__ void momentsKernel(const CFP_t *sv, std::size_t state_length,
+                              std::size_t num_groups, const CFP_t *matrix,
+                              MomentTargets targets, double *result) {
+    extern __shared__ double2 moment_shared[];
+    sv += blockIdx.y * state_length;
+    result += 2 * blockIdx.y;
+    const unsigned int dim = 1U << targets.num_bits;
+    auto *partial = reinterpret_cast<double *>(moment_shared);
+    auto *mat = reinterpret_cast<CFP_t *>(partial + 2 * blockDim.x);
+
+    for (unsigned int idx = threadIdx.x; idx < dim * dim; idx += blockDim.x) {
+        mat[idx] = matrix[idx];
+    }
+    __syncthreads();
+
+    double expval = 0.0;
+    double sqr = 0.0;
+    CFP_t amps[1U << max_moment_wires];
+    for (std::size_t group = blockIdx.x * blockDim.x + threadIdx.x;
+         group < num_groups; group += blockDim.x * gridDim.x) {
+        std::size_t base = group;
+        for (unsigned int t = 0; t < targets.num_bits; t++) {
+            const int bit = targets.sorted_bits[t];
+            const std::size_t low = base & ((std::size_t{1} << bit) - 1);
+            base = ((base >> bit) << (bit + 1)) | low;
+        }
+        for (unsigned int local = 0; local < dim; local++) {
+            std::size_t offset = base;
+            for (unsigned int t = 0; t < targets.num_bits; t++) {
+                if ((local >> t) & 1U) {
+                    offset |= std::size_t{1} << targets.bits[t];
+                }
+            }
+            amps[local] = sv[offset];
+        }
+        for (unsigned int row = 0; row < dim; row++) {
+            double re = 0.0;
+            double im = 0.0;
+            for (unsigned int col = 0; col < dim; col++) {
+                const CFP_t m = mat[row * dim + col];
+                const CFP_t a = amps[col];
+                re += static_cast<double>(m.x) * a.x -
+                      static_cast<double>(m.y) * a.y;
+                im += static_cast<double>(m.x) * a.y +
+                      static_cast<double>(m.y) * a.x;
+            }
+            expval += amps[row].x * re + amps[row].y * im;
+            sqr += re * re + im * im;
+        }
+    }
+
+    partial[threadIdx.x] = expval;
+    partial[blockDim.x + threadIdx.x] = sqr;
+    __syncthreads();
+    for (unsigned int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+        if (threadIdx.x < stride) {
+            partial[threadIdx.x] += partial[threadIdx.x + stride];
+            partial[blockDim.x + threadIdx.x] +=
+                partial[blockDim.x + threadIdx.x + stride];
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+        atomicAdd(&result[0], partial[0]);
+        atomicAdd(&result[1], partial[blockDim.x]);
+    }
+}
+
+template <class CFP_t>
+auto launchMoments(const CFP_t *sv, unsigned int num_qubits,
+                   std::size_t batch_size, const CFP_t *matrix,
+                   const int *tgts, unsigned int num_tgts, double *result,
+                   cudaStream_t stream) -> cudaError_t {
+    if (num_tgts > max_moment_wires || num_tgts > num_qubits ||
+        batch_size == 0 || batch_size > 65535) {
+        return cudaErrorInvalidValue;
+    }
+    MomentTargets targets{};
+    targets.num_bits = num_tgts;
+    std::copy(tgts, tgts + num_tgts, targets.bits);
+    std::copy(tgts, tgts + num_tgts, targets.sorted_bits);
+    std::sort(targets.sorted_bits, targets.sorted_bits + num_tgts);
+
+    const std::size_t num_groups = std::size_t{1} << (num_qubits - num_tgts);
+    const unsigned int block_size = 256;
+    // Keep the total grid size bounded when several states are reduced
+    const std::size_t max_blocks =
+        std::max<std::size_t>(1, 4096 / batch_size);
+    const unsigned int num_blocks = static_cast<unsigned int>(std::min<
+        std::size_t>((num_groups + block_size - 1) / block_size, max_blocks));
+    const std::size_t dim = std::size_t{1} << num_tgts;
+    const std::size_t shared_bytes =
+        2 * block_size * sizeof(double) + dim * dim * sizeof(CFP_t);
+
+    cudaError_t err =
+        cudaMemsetAsync(result, 0, 2 * batch_size * sizeof(double), stream);
+    if (err != cudaSuccess) {
+        return err;
+    }
+    const dim3 grid(num_blocks, static_cast<unsigned int>(batch_size));
+    momentsKernel<CFP_t><<<grid, block_size, shared_bytes, stream>>>(
+        sv, std::size_t{1} << num_qubits, num_groups, matrix, targets,
+        result);
+    return cudaGetLastError();
+}
+
+/**
+ * @brief Accumulate the inner products `<vecs_i|v>` of single-precision
+ * vectors in double precision.
+ *
+ * Row `blockIdx.y` of the grid reduces vector `i = blockIdx.y` of `vecs`,
+ * stored at `vecs + i * data_size`, and adds its blocks' partial sums to
+ * `result[i]`.
+ */
+__global__ void innerProdsMixedKernel(const cuComplex *vecs,
+                                      const cuComplex *v,
+                                      std::size_t data_size,
+                                      cuDoubleComplex *result) {
+    extern __shared__ double inner_partial[];
+    const cuComplex *vec = vecs + blockIdx.y * data_size;
+    double re = 0.0;
+    double im = 0.0;
+    for (std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+         idx < data_size; idx += blockDim.x * gridDim.x) {
+        const cuComplex a = vec[idx];
+        const cuComplex b = v[idx];
+        // conj(a) * b
+        re += static_cast<double>(a.x) * b.x + static_cast<double>(a.y) * b.y;
+        im += static_cast<double>(a.x) * b.y - static_cast<double>(a.y) * b.x;
+    }
+    inner_partial[threadIdx.x] = re;
+    inner_partial[blockDim.x + threadIdx.x] = im;
+    __syncthreads();
+    for (unsigned int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+        if (threadIdx.x < stride) {
+            inner_partial[threadIdx.x] += inner_partial[threadIdx.x + stride];
+            inner_partial[blockDim.x + threadIdx.x] +=
+                inner_partial[blockDim.x + threadIdx.x + stride];
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+        atomicAdd(&result[blockIdx.y].x, inner_partial[0]);
+        atomicAdd(&result[blockIdx.y].y, inner_partial[blockDim.x]);
+    }
+}
+
+auto launchInnerProdsMixed(const cuComplex *vecs, const cuComplex *v,
+                           std::size_t data_size, std::size_t num_vecs,
+                           cuDoubleComplex *result, cudaStream_t stream)
+    -> cudaError_t {
+    if (num_vecs > 65535) {
+        return cudaErrorInvalidValue;
+    }
+    if (num_vecs == 0) {
+        return cudaSuccess;
+    }
+    cudaError_t err = cudaMemsetAsync(
+        result, 0, num_vecs * sizeof(cuDoubleComplex), stream);
+    if (err != cudaSuccess) {
+        return err;
+    }
+    const unsigned int block_size = 256;
+    const std::size_t max_blocks = std::max<std::size_t>(1, 4096 / num_vecs);
+    const unsigned int num_blocks = static_cast<unsigned int>(std::min<
+        std::size_t>((data_size + block_size - 1) / block_size, max_blocks));
+    const dim3 grid(std::max(num_blocks, 1U),
+                    static_cast<unsigned int>(num_vecs));
+    innerProdsMixedKernel<<<grid, block_size, 2 * block_size * sizeof(double),
+                            stream>>>(vecs, v, data_size, result);
+    return cudaGetLastError();
+}
+
+/**
+ * @brief Sum the probabilities of each chunk of `chunk_size` consecutive
+ * amplitudes into `chunk_sums`. One block reduces one chunk.
+ */
+template <class CFP_t>
+__global__ void chunkProbabilitiesKernel(const CFP_t *sv,
+                                         std::size_t chunk_size,
+                                         double *chunk_sums) {
+    extern __shared__ double chunk_partial[];
+    const std::size_t offset = blockIdx.x * chunk_size;
+    double sum = 0.0;
+    for (std::size_t idx = threadIdx.x; idx < chunk_size; idx += blockDim.x) {
+        const CFP_t amp = sv[offset + idx];
+        sum += static_cast<double>(amp.x) * amp.x +
+               static_cast<double>(amp.y) * amp.y;
+    }
+    chunk_partial[threadIdx.x] = sum;
+    __syncthreads();
+    for (unsigned int stride = blockDim.x / 2; stride > 0; stride >>= 1) {
+        if (threadIdx.x < stride) {
+            chunk_partial[threadIdx.x] += chunk_partial[threadIdx.x + stride];
+        }
+        __syncthreads();
+    }
+    if (threadIdx.x == 0) {
+        chunk_sums[blockIdx.x] = chunk_partial[0];
+    }
+}
+
+/**
+ * @brief Map each uniform number to a basis state. The chunk holding the
+ * sample is found by binary search over the cumulative chunk sums, and the
+ * basis state by a linear walk over the probabilities of that chunk.
+ */
+template <class CFP_t>
+__global__ void sampleIndicesKernel(const CFP_t *sv, std::size_t chunk_size,
+                                    const double *chunk_cdf,
+                                    std::size_t num_chunks,
+                                    const double *uniforms,
+                                    std::size_t num_samples,
+                                    unsigned long long *indices) {
+    const std::size_t sample = blockIdx.x * blockDim.x + threadIdx.x;
+    if (sample >= num_samples) {
+        return;
+    }
+    // cuRAND draws from (0, 1]
+    double target = uniforms[sample] * chunk_cdf[num_chunks - 1];
+
+    std::size_t lo = 0;
+    std::size_t hi = num_chunks - 1;
+    while (lo < hi) {
+        const std::size_t mid = (lo + hi) / 2;
+        if (chunk_cdf[mid] < target) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo > 0) {
+        target -= chunk_cdf[lo - 1];
+    }
+
+    const std::size_t offset = lo * chunk_size;
+    std::size_t picked = offset;
+    double cumulative = 0.0;
+    for (std::size_t idx = 0; idx < chunk_size; idx++) {
+        const CFP_t amp = sv[offset + idx];
+        const double prob = static_cast<double>(amp.x) * amp.x +
+                            static_cast<double>(amp.y) * amp.y;
+        if (prob > 0.0) {
+            // Guard against rounding by keeping the last non-zero state
+            picked = offset + idx;
+        }
+        cumulative += prob;
+        if (cumulative >= target && prob > 0.0) {
+            break;
+        }
+    }
+    indices[sample] = picked;
+}
+
+/**
+ * @brief Unpack each sampled basis state into one byte per wire, with wire 0
+ * holding the most significant bit.
+ */
+__global__ void unpackSamplesKernel(const unsigned long long *indices,
+                                    std::size_t num_samples,
+                                    unsigned int num_qubits,
+                                    unsigned char *bits) {
+    const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= num_samples * num_qubits) {
+        return;
+    }
+    const std::size_t sample = idx / num_qubits;
+    const unsigned int wire = idx % num_qubits;
+    bits[idx] = (indices[sample] >> (num_qubits - 1 - wire)) & 1U;
+}
+
+template <class CFP_t>
+auto launchChunkProbabilities(const CFP_t *sv, std::size_t length,
+                              std::size_t chunk_size, double *chunk_cdf,
+                              cudaStream_t stream) -> cudaError_t {
+    const unsigned int block_size = 256;
+    const std::size_t num_chunks = length / chunk_size;
+    chunkProbabilitiesKernel<CFP_t>
+        <<<num_chunks, block_size, block_size * sizeof(double), stream>>>(
+            sv, chunk_size, chunk_cdf);
+    cudaError_t err = cudaGetLastError();
+    if (err != cudaSuccess) {
+        return err;
+    }
+    thrust::device_ptr<double> cdf(chunk_cdf);
+    thrust::inclusive_scan(thrust::cuda::par.on(stream), cdf, cdf + num_chunks,
+                           cdf);
+    return cudaGetLastError();
+}
+
+template <class CFP_t>
+auto launchSampleIndices(const CFP_t *sv, std::size_t length,
+                         std::size_t chunk_size, const double *chunk_cdf,
+                         const double *uniforms, std::size_t num_samples,
+                         unsigned long long *indices, cudaStream_t stream)
+    -> cudaError_t {
+    const unsigned int block_size = 256;
+    const std::size_t num_blocks = (num_samples + block_size - 1) / block_size;
+    sampleIndicesKernel<CFP_t><<<num_blocks, block_size, 0, stream>>>(
+        sv, chunk_size, chunk_cdf, length / chunk_size, uniforms, num_samples,
+        indices);
+    return cudaGetLastError();
+}
+} // namespace
+
+namespace Pennylane {
+
+unsigned int getMaxMomentWires_CUDA() { return max_moment_wires; }
+
+cudaError_t computeMoments_CUDA(const cuComplex *sv, unsigned int num_qubits,
+                                const cuComplex *matrix, const int *tgts,
+                                unsigned int num_tgts, double *result,
+                                cudaStream_t stream) {
+    return launchMoments(sv, num_qubits, 1, matrix, tgts, num_tgts, result,
+                         stream);
+}
+
+cudaError_t computeMoments_CUDA(const cuDoubleComplex *sv,
+                                unsigned int num_qubits,
+                                const cuDoubleComplex *matrix, const int *tgts,
+                                unsigned int num_tgts, double *result,
+                                cudaStream_t stream) {
+    return launchMoments(sv, num_qubits, 1, matrix, tgts, num_tgts, result,
+                         stream);
+}
+
+cudaError_t computeBatchedMoments_CUDA(const cuComplex *sv,
+                                       unsigned int num_qubits,
+                                       std::size_t batch_size,
+                                       const cuComplex *matrix,
+                                       const int *tgts, unsigned int num_tgts,
+                                       double *result, cudaStream_t stream) {
+    return launchMoments(sv, num_qubits, batch_size, matrix, tgts, num_tgts,
+                         result, stream);
+}
+
+cudaError_t computeBatchedMoments_CUDA(const cuDoubleComplex *sv,
+                                       unsigned int num_qubits,
+                                       std::size_t batch_size,
+                                       const cuDoubleComplex *matrix,
+                                       const int *tgts, unsigned int num_tgts,
+                                       double *result, cudaStream_t stream) {
+    return launchMoments(sv, num_qubits, batch_size, matrix, tgts, num_tgts,
+                         result, stream);
+}
+
+cudaError_t innerProdsMixed_CUDA(const cuComplex *vecs, const cuComplex *v,
+                                 std::size_t data_size, std::size_t num_vecs,
+                                 cuDoubleComplex *result,
+                                 cudaStream_t stream) {
+    return launchInnerProdsMixed(vecs, v, data_size, num_vecs, result, stream);
+}
+
+cudaError_t computeChunkProbabilities_CUDA(const cuComplex *sv,
+                                           std::size_t length,
+                                           std::size_t chunk_size,
+                                           double *chunk_cdf,
+                                           cudaStream_t stream) {
+    return launchChunkProbabilities(sv, length, chunk_size, chunk_cdf, stream);
+}
+
+cudaError_t computeChunkProbabilities_CUDA(const cuDoubleComplex *sv,
+                                           std::size_t length,
+                                           std::size_t chunk_size,
+                                           double *chunk_cdf,
+                                           cudaStream_t stream) {
+    return launchChunkProbabilities(sv, length, chunk_size, chunk_cdf, stream);
+}
+
+cudaError_t sampleIndices_CUDA(const cuComplex *sv, std::size_t length,
+                               std::size_t chunk_size, const double *chunk_cdf,
+                               const double *uniforms, std::size_t num_samples,
+                               unsigned long long *indices,
+                               cudaStream_t stream) {
+    return launchSampleIndices(sv, length, chunk_size, chunk_cdf, uniforms,
+                               num_samples, indices, stream);
+}
+
+cudaError_t sampleIndices_CUDA(const cuDoubleComplex *sv, std::size_t length,
+                               std::size_t chunk_size, const double *chunk_cdf,
+                               const double *uniforms, std::size_t num_samples,
+                               unsigned long long *indices,
+                               cudaStream_t stream) {
+    return launchSampleIndices(sv, length, chunk_size, chunk_cdf, uniforms,
+                               num_samples, indices, stream);
+}
+
+cudaError_t unpackSamples_CUDA(const unsigned long long *indices,
+                               std::size_t num_samples,
+                               unsigned int num_qubits, unsigned char *bits,
+                               cudaStream_t stream) {
+    const unsigned int block_size = 256;
+    const std::size_t num_blocks =
+        (num_samples * num_qubits + block_size - 1) / block_size;
+    unpackSamplesKernel<<<num_blocks, block_size, 0, stream>>>(
+        indices, num_samples, num_qubits, bits);
+    return cudaGetLastError();
+}
+
+cudaError_t countSamples_CUDA(unsigned long long *indices,
+                              std::size_t num_samples,
+                              unsigned long long *unique_indices,
+                              unsigned long long *counts,
+                              std::size_t *num_unique, cudaStream_t stream) {
+    thrust::device_ptr<unsigned long long> keys(indices);
+    thrust::device_ptr<unsigned long long> unique_keys(unique_indices);
+    thrust::device_ptr<unsigned long long> values(counts);
+    const auto policy = thrust::cuda::par.on(stream);
+    thrust::sort(policy, keys, keys + num_samples);
+    const auto ends = thrust::reduce_by_key(
+        policy, keys, keys + num_samples,
+        thrust::constant_iterator<unsigned long long>(1), unique_keys, values);
+    *num_unique = static_cast<std::size_t>(ends.first - unique_keys);
+    return cudaGetLastError();
+}
+
+} // namespace Pennylane
@@ -0,0 +1,72 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file stateKernels.cu
+ * Device-side state-vector preparation.
+ */
+#include <cstddef>
+
+#include <cuComplex.h>
+#include <cuda_runtime.h>
+
+namespace {
+/**
+ * @brief Write `values[i]` to the state-vector entry `indices[i]`.
+ */
+template <class CFP_t>
+__global__ void scatterAmplitudesKernel(CFP_t *sv, const CFP_t *values,
+                                        const std::size_t *indices,
+                                        std::size_t num_values) {
+    const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+    if (idx >= num_values) {
+        return;
+    }
+    sv[indices[idx]] = values[idx];
+}
+
+template <class CFP_t>
+auto launchScatterAmplitudes(CFP_t *sv, const CFP_t *values,
+                             const std::size_t *indices,
+                             std::size_t num_values, cudaStream_t stream)
+    -> cudaError_t {
+    if (num_values == 0) {
+        return cudaSuccess;
+    }
+    const unsigned int block_size = 256;
+    const std::size_t num_blocks = (num_values + block_size - 1) / block_size;
+    scatterAmplitudesKernel<CFP_t>
+        <<<num_blocks, block_size, 0, stream>>>(sv, values, indices,
+                                                num_values);
+    return cudaGetLastError();
+}
+} // namespace
+
+namespace Pennylane {
+
+cudaError_t scatterAmplitudes_CUDA(cuComplex *sv, const cuComplex *values,
+                                   const std::size_t *indices,
+                                   std::size_t num_values,
+                                   cudaStream_t stream) {
+    return launchScatterAmplitudes(sv, values, indices, num_values, stream);
+}
+
+cudaError_t scatterAmplitudes_CUDA(cuDoubleComplex *sv,
+                                   const cuDoubleComplex *values,
+                                   const std::size_t *indices,
+                                   std::size_t num_values,
+                                   cudaStream_t stream) {
+    return launchScatterAmplitudes(sv, values, indices, num_values, stream);
+}
+
+} // namespace Pennylane
@@ -0,0 +1,146 @@
+/**
+ * @file Bench_AdjointDiffGPU.cpp
+ * Throughput benchmarks of adjoint Jacobians, sweeping the number of qubits,
+ * of observables and of GPUs, for both precisions.
+ */
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "AdjointDiffGPU.hpp"
+#include "DeviceExecutor.hpp"
+#include "StateVectorCudaManaged.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::CUDA;
+using namespace Pennylane::Algorithms;
+
+namespace {
+
+constexpr int num_layers = 2;
+
+/**
+ * @brief Layers of RX and RY rotations on every wire followed by a ladder of
+ * CNOTs, with all the rotations trainable.
+ */
+template <class PrecisionT>
+auto createLayeredOps(std::size_t num_qubits) -> OpsData<PrecisionT> {
+    std::vector<std::string> names;
+    std::vector<std::vector<PrecisionT>> params;
+    std::vector<std::vector<std::size_t>> wires;
+    for (int layer = 0; layer < num_layers; layer++) {
+        for (std::size_t wire = 0; wire < num_qubits; wire++) {
+            for (const auto *name : {"RX", "RY"}) {
+                names.emplace_back(name);
+                params.push_back({static_cast<PrecisionT>(0.1 * (wire + 1))});
+                wires.push_back({wire});
+            }
+        }
+        for (std::size_t wire = 0; wire + 1 < num_qubits; wire++) {
+            names.emplace_back("CNOT");
+            params.emplace_back();
+            wires.push_back({wire, wire + 1});
+        }
+    }
+    return {names, params, wires, std::vector<bool>(names.size(), false),
+            std::vector<std::vector<std::complex<PrecisionT>>>(names.size())};
+}
+
+/**
+ * @brief Single-wire PauliZ observables, cycling over the wires.
+ */
+template <class PrecisionT>
+auto createObservables(std::size_t num_qubits, std::size_t num_obs)
+    -> std::vector<ObsDatum<PrecisionT>> {
+    std::vector<ObsDatum<PrecisionT>> obs;
+    for (std::size_t i = 0; i < num_obs; i++) {
+        obs.push_back(ObsDatum<PrecisionT>({"PauliZ"}, {{}},
+                                           {{i % num_qubits}}));
+    }
+    return obs;
+}
+
+/**
+ * @brief Trainable parameter indices of all the rotations of
+ * `createLayeredOps`.
+ */
+auto createTrainableParams(std::size_t num_qubits) -> std::vector<size_t> {
+    std::vector<size_t> t_params(2 * num_layers * num_qubits);
+    for (std::size_t i = 0; i < t_params.size(); i++) {
+        t_params[i] = i;
+    }
+    return t_params;
+}
+
+/**
+ * @brief Adjoint Jacobian of `range(1)` observables on the current GPU.
+ */
+template <class PrecisionT> void adjointJacobian(benchmark::State &state) {
+    const auto num_qubits = static_cast<std::size_t>(state.range(0));
+    const auto num_obs = static_cast<std::size_t>(state.range(1));
+    AdjointJacobianGPU<PrecisionT> adj;
+    StateVectorCudaManaged<PrecisionT> psi{num_qubits};
+    const auto ops = createLayeredOps<PrecisionT>(num_qubits);
+    const auto obs = createObservables<PrecisionT>(num_qubits, num_obs);
+    const auto t_params = createTrainableParams(num_qubits);
+    std::vector<std::vector<PrecisionT>> jac(
+        num_obs, std::vector<PrecisionT>(t_params.size(), 0));
+
+    for (auto _ : state) {
+        adj.adjointJacobian(psi.getData(), psi.getLength(), jac, obs, ops,
+                            t_params, true);
+        benchmark::DoNotOptimize(jac.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_obs * t_params.size());
+}
+
+/**
+ * @brief Adjoint Jacobian of `range(1)` observables spread over all the
+ * visible GPUs. Restrict `CUDA_VISIBLE_DEVICES` to sweep the GPU count.
+ */
+template <class PrecisionT>
+void batchAdjointJacobian(benchmark::State &state) {
+    const auto num_qubits = static_cast<std::size_t>(state.range(0));
+    const auto num_obs = static_cast<std::size_t>(state.range(1));
+    AdjointJacobianGPU<PrecisionT> adj;
+    StateVectorCudaManaged<PrecisionT> psi{num_qubits};
+    const auto ops = createLayeredOps<PrecisionT>(num_qubits);
+    const auto obs = createObservables<PrecisionT>(num_qubits, num_obs);
+    const auto t_params = createTrainableParams(num_qubits);
+    std::vector<std::vector<PrecisionT>> jac(
+        num_obs, std::vector<PrecisionT>(t_params.size(), 0));
+
+    for (auto _ : state) {
+        adj.batchAdjointJacobian(psi.getData(), psi.getLength(), jac, obs,
+                                 ops, t_params, true);
+        benchmark::DoNotOptimize(jac.data());
+    }
+    state.SetItemsProcessed(state.iterations() * num_obs * t_params.size());
+    state.counters["gpus"] = static_cast<double>(
+        DeviceExecutor::getInstance().getNumDevices());
+}
+
+template <class PrecisionT> void registerBenchmarks(const std::string &type) {
+    const std::vector<std::vector<int64_t>> sweep{{10, 14, 18}, {1, 4, 16}};
+    benchmark::RegisterBenchmark(("adjointJacobian<" + type + ">").c_str(),
+                                 adjointJacobian<PrecisionT>)
+        ->ArgsProduct(sweep)
+        ->ArgNames({"qubits", "observables"})
+        ->Unit(benchmark::kMillisecond);
+    benchmark::RegisterBenchmark(
+        ("batchAdjointJacobian<" + type + ">").c_str(),
+        batchAdjointJacobian<PrecisionT>)
+        ->ArgsProduct(sweep)
+        ->ArgNames({"qubits", "observables"})
+        ->Unit(benchmark::kMillisecond)
+        ->UseRealTime();
+}
+
+[[maybe_unused]] const bool registered = [] {
+    registerBenchmarks<float>("float");
+    registerBenchmarks<double>("double");
+    return true;
+}();
+
+} // namespace
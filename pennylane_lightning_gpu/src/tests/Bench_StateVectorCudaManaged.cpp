@@ -0,0 +1,179 @@
+/**
+ * @file Bench_StateVectorCudaManaged.cpp
+ * Throughput benchmarks of gate applications, expectation values and sampling.
+ * Every benchmark sweeps the number of qubits, and is registered for both
+ * precisions. Each iteration waits for the device, so the timings include
+ * the kernels and not only their launches.
+ */
+#include <algorithm>
+#include <complex>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "StateVectorCudaDistributed.hpp"
+#include "StateVectorCudaManaged.hpp"
+
+using namespace Pennylane;
+using namespace Pennylane::CUDA;
+
+namespace {
+
+constexpr int min_qubits = 12;
+constexpr int max_qubits = 24;
+constexpr int qubits_step = 4;
+
+/// Gates benchmarked, with the number of wires they act on.
+const std::vector<std::pair<std::string, std::size_t>> bench_gates{
+    {"PauliX", 1}, {"Hadamard", 1}, {"RX", 1},      {"Rot", 1},
+    {"CNOT", 2},   {"CRX", 2},      {"IsingZZ", 2}, {"SWAP", 2},
+    {"Toffoli", 3}, {"MultiRZ", 4}, {"DoubleExcitation", 4},
+};
+
+/**
+ * @brief Number of GPUs visible to the process, or 0 without a device.
+ */
+auto getVisibleGPUs() -> int {
+    int num_gpus = 0;
+    if (cudaGetDeviceCount(&num_gpus) != cudaSuccess) {
+        return 0;
+    }
+    return num_gpus;
+}
+
+/**
+ * @brief Apply one gate, alternating its wires over the state-vector.
+ */
+template <class PrecisionT>
+void applyGate(benchmark::State &state, const std::string &gate,
+               std::size_t num_wires) {
+    const auto num_qubits = static_cast<std::size_t>(state.range(0));
+    StateVectorCudaManaged<PrecisionT> sv{num_qubits};
+    std::vector<std::size_t> wires(num_wires);
+    std::size_t first_wire = 0;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < num_wires; i++) {
+            wires[i] = (first_wire + i) % num_qubits;
+        }
+        sv.applyOperation(gate, wires, false, {0.3, 0.2, 0.1});
+        PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(sv.getStream()));
+        first_wire = (first_wire + 1) % num_qubits;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * sv.getLength() *
+                            sizeof(std::complex<PrecisionT>));
+}
+
+/**
+ * @brief Expectation values of `range(1)` single-wire observables.
+ */
+template <class PrecisionT>
+void expvalObservables(benchmark::State &state) {
+    using CFP_t = typename StateVectorCudaManaged<PrecisionT>::CFP_t;
+    const auto num_qubits = static_cast<std::size_t>(state.range(0));
+    const auto num_obs = static_cast<std::size_t>(state.range(1));
+    StateVectorCudaManaged<PrecisionT> sv{num_qubits};
+    for (std::size_t wire = 0; wire < num_qubits; wire++) {
+        sv.applyOperation("RY", {wire}, false, {0.4});
+    }
+
+    for (auto _ : state) {
+        for (std::size_t obs = 0; obs < num_obs; obs++) {
+            benchmark::DoNotOptimize(sv.expval(
+                (obs % 2) ? "PauliX" : "PauliZ", {obs % num_qubits}, {0.0},
+                std::vector<CFP_t>{}));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * num_obs);
+}
+
+/**
+ * @brief Draw `range(1)` samples, including the sampler preprocessing.
+ */
+template <class PrecisionT>
+void generateSamples(benchmark::State &state) {
+    const auto num_qubits = static_cast<std::size_t>(state.range(0));
+    const auto num_shots = static_cast<std::size_t>(state.range(1));
+    StateVectorCudaManaged<PrecisionT> sv{num_qubits};
+    for (std::size_t wire = 0; wire < num_qubits; wire++) {
+        sv.applyOperation("Hadamard", {wire}, false);
+    }
+
+    for (auto _ : state) {
+        // Invalidate the preprocessed sampler, as a gate application would
+        sv.markModified();
+        benchmark::DoNotOptimize(sv.generate_samples(num_shots));
+    }
+    state.SetItemsProcessed(state.iterations() * num_shots);
+}
+
+/**
+ * @brief Apply a layer of CNOTs to a state-vector sharded over `range(1)`
+ * GPUs. The wires of the last CNOTs are global, and swapped with local ones.
+ */
+template <class PrecisionT>
+void applyLayerDistributed(benchmark::State &state) {
+    const auto num_qubits = static_cast<std::size_t>(state.range(0));
+    const auto num_gpus = static_cast<std::size_t>(state.range(1));
+    StateVectorCudaDistributed<PrecisionT> sv{num_qubits, num_gpus};
+
+    for (auto _ : state) {
+        for (std::size_t wire = 0; wire + 1 < num_qubits; wire++) {
+            sv.applyOperation("CNOT", {wire, wire + 1}, false);
+        }
+        PL_CUDA_IS_SUCCESS(cudaDeviceSynchronize());
+    }
+    state.SetItemsProcessed(state.iterations() * (num_qubits - 1));
+    state.counters["gpus"] = static_cast<double>(num_gpus);
+}
+
+template <class PrecisionT> void registerBenchmarks(const std::string &type) {
+    for (const auto &[gate, num_wires] : bench_gates) {
+        benchmark::RegisterBenchmark(
+            ("applyOperation<" + type + ">/" + gate).c_str(),
+            applyGate<PrecisionT>, gate, num_wires)
+            ->DenseRange(min_qubits, max_qubits, qubits_step)
+            ->Unit(benchmark::kMicrosecond);
+    }
+    benchmark::RegisterBenchmark(("expval<" + type + ">").c_str(),
+                                 expvalObservables<PrecisionT>)
+        ->ArgsProduct({benchmark::CreateDenseRange(min_qubits, max_qubits,
+                                                   qubits_step),
+                       {1, 8, 64}})
+        ->ArgNames({"qubits", "observables"})
+        ->Unit(benchmark::kMicrosecond);
+    benchmark::RegisterBenchmark(("generate_samples<" + type + ">").c_str(),
+                                 generateSamples<PrecisionT>)
+        ->ArgsProduct({benchmark::CreateDenseRange(min_qubits, max_qubits,
+                                                   qubits_step),
+                       {1000, 100000}})
+        ->ArgNames({"qubits", "shots"})
+        ->Unit(benchmark::kMillisecond);
+
+    // Powers of 2 up to the number of visible GPUs
+    std::vector<int64_t> gpu_counts;
+    for (int num_gpus = 1; num_gpus <= getVisibleGPUs(); num_gpus *= 2) {
+        gpu_counts.push_back(num_gpus);
+    }
+    if (!gpu_counts.empty()) {
+        benchmark::RegisterBenchmark(
+            ("applyOperation<" + type + ">/distributed").c_str(),
+            applyLayerDistributed<PrecisionT>)
+            ->ArgsProduct({benchmark::CreateDenseRange(
+                               min_qubits + qubits_step, max_qubits,
+                               qubits_step),
+                           gpu_counts})
+            ->ArgNames({"qubits", "gpus"})
+            ->Unit(benchmark::kMillisecond);
+    }
+}
+
+[[maybe_unused]] const bool registered = [] {
+    registerBenchmarks<float>("float");
+    registerBenchmarks<double>("double");
+    return true;
+}();
+
+} // namespace
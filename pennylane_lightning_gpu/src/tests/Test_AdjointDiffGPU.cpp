@@ -141,6 +141,44 @@ TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z]",
         CHECK(-sin(param[2]) == Approx(jacobian[2][2]).margin(1e-7));
     }
 }
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Many Obs, OpenMP threads",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    const size_t num_qubits = 4;
+    const size_t num_obs = 16;
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3, M_PI / 9};
+
+    // All observable states share one stream, and so one custatevec handle
+    const int num_threads = omp_get_max_threads();
+    omp_set_num_threads(4);
+
+    std::vector<std::vector<double>> jacobian(
+        num_obs, std::vector<double>(num_qubits, 0));
+    std::vector<ObsDatum<double>> obs;
+    for (size_t i = 0; i < num_obs; i++) {
+        obs.push_back(ObsDatum<double>({"PauliZ"}, {{}}, {{i % num_qubits}}));
+    }
+
+    SVDataGPU<double> psi(num_qubits);
+    auto ops = adj.createOpsData({"RX", "RX", "RX", "RX"},
+                                 {{param[0]}, {param[1]}, {param[2]},
+                                  {param[3]}},
+                                 {{0}, {1}, {2}, {3}},
+                                 {false, false, false, false});
+
+    adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                        jacobian, obs, ops, {0, 1, 2, 3}, true);
+    omp_set_num_threads(num_threads);
+
+    CAPTURE(jacobian);
+    for (size_t i = 0; i < num_obs; i++) {
+        for (size_t j = 0; j < num_qubits; j++) {
+            const double expected =
+                (j == i % num_qubits) ? -std::sin(param[j]) : 0.0;
+            CHECK(expected == Approx(jacobian[i][j]).margin(1e-7));
+        }
+    }
+}
 TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z], "
           "TParams=[0,2]",
           "[AdjointJacobianGPU]") {
@@ -173,6 +211,138 @@ TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z], "
         CHECK(-sin(param[2]) == Approx(jacobian[2][1]).margin(1e-7));
     }
 }
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=[RX,RX,RX], Obs=[Z,Z,Z], "
+          "chunked observables",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    {
+        const size_t num_qubits = 3;
+        const size_t num_params = 3;
+        const size_t num_obs = 3;
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(num_params, 0));
+
+        SVDataGPU<double> psi(num_qubits);
+
+        auto obs1 = ObsDatum<double>({"PauliZ"}, {{}}, {{0}});
+        auto obs2 = ObsDatum<double>({"PauliZ"}, {{}}, {{1}});
+        auto obs3 = ObsDatum<double>({"PauliZ"}, {{}}, {{2}});
+
+        auto ops = adj.createOpsData({"RX", "RX", "RX"},
+                                     {{param[0]}, {param[1]}, {param[2]}},
+                                     {{0}, {1}, {2}}, {false, false, false});
+
+        // Budget for 2 states: forward-state copy plus 1 observable per chunk
+        adj.setMemoryBudget(2 * psi.cuda_sv.getLength() *
+                            sizeof(cuDoubleComplex));
+        CHECK(adj.getMemoryBudget() > 0);
+
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            jacobian, {obs1, obs2, obs3}, ops, {0, 1, 2}, true);
+
+        CAPTURE(jacobian);
+        for (size_t i = 0; i < num_obs; i++) {
+            for (size_t j = 0; j < num_params; j++) {
+                const double expected = (i == j) ? -sin(param[i]) : 0.0;
+                CHECK(expected == Approx(jacobian[i][j]).margin(1e-7));
+            }
+        }
+    }
+}
+TEST_CASE("AdjointJacobianGPU::adjointJacobian memory budget, memory pool",
+          "[AdjointJacobianGPU]") {
+    auto &pool = DeviceMemoryPool::getInstance();
+    pool.setEnabled(true);
+
+    // 2 MiB per state, so that blocks are not rounded to powers of two
+    const size_t num_qubits = 17;
+    const size_t num_obs = 6;
+    const size_t sv_bytes = (1UL << num_qubits) * sizeof(cuDoubleComplex);
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+
+    std::vector<ObsDatum<double>> obs;
+    for (size_t i = 0; i < num_obs; i++) {
+        obs.push_back(ObsDatum<double>({"PauliZ"}, {{}}, {{i % 3}}));
+    }
+
+    AdjointJacobianGPU<double> adj;
+    // Budget for 4 states: forward-state copy plus 3 observables per chunk
+    adj.setMemoryBudget(4 * sv_bytes);
+    CHECK(DeviceMemoryPool::getSizeClass(3 * sv_bytes) == 3 * sv_bytes);
+
+    // The second call runs on the blocks cached by the first one
+    for (size_t run = 0; run < 2; run++) {
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(param.size(), 0));
+        SVDataGPU<double> psi(num_qubits);
+        auto ops = adj.createOpsData({"RX", "RX", "RX"},
+                                     {{param[0]}, {param[1]}, {param[2]}},
+                                     {{0}, {1}, {2}}, {false, false, false});
+        pool.resetCounters();
+
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            jacobian, obs, ops, {0, 1, 2}, true);
+        if (run > 0) {
+            CHECK(pool.getStats().hits > 0);
+        }
+
+        CAPTURE(jacobian);
+        for (size_t i = 0; i < num_obs; i++) {
+            for (size_t j = 0; j < param.size(); j++) {
+                const double expected = (j == i % 3) ? -sin(param[j]) : 0.0;
+                CHECK(expected == Approx(jacobian[i][j]).margin(1e-7));
+            }
+        }
+    }
+    CHECK(pool.getCachedBytes(0) >= 3 * sv_bytes);
+    pool.setEnabled(false);
+    CHECK(pool.getCachedBytes(0) == 0);
+}
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=Mixed, Obs=[Z,X,Y], "
+          "stream pool",
+          "[AdjointJacobianGPU]") {
+    std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+    const size_t num_qubits = 3;
+    const size_t num_params = 3;
+    const size_t num_obs = 3;
+
+    auto obs1 = ObsDatum<double>({"PauliZ"}, {{}}, {{0}});
+    auto obs2 = ObsDatum<double>({"PauliX"}, {{}}, {{1}});
+    auto obs3 = ObsDatum<double>({"PauliY", "PauliZ"}, {{}, {}}, {{2}, {0}});
+
+    auto get_jacobian = [&](bool use_stream_pool) {
+        AdjointJacobianGPU<double> adj;
+        adj.setUseStreamPool(use_stream_pool);
+        CHECK(adj.getUseStreamPool() == use_stream_pool);
+
+        std::vector<std::vector<double>> jacobian(
+            num_obs, std::vector<double>(num_params, 0));
+        SVDataGPU<double> psi(num_qubits);
+        auto ops = adj.createOpsData(
+            {"RX", "CNOT", "RY", "CNOT", "RZ"},
+            {{param[0]}, {}, {param[1]}, {}, {param[2]}},
+            {{0}, {0, 1}, {1}, {1, 2}, {2}},
+            {false, false, false, false, false});
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            jacobian, {obs1, obs2, obs3}, ops, {0, 1, 2},
+                            true);
+        return jacobian;
+    };
+
+    auto &context = DeviceContext<double>::getInstance(0);
+    const auto expected = get_jacobian(false);
+    const auto num_handles = context.getNumHandles();
+    const auto result = get_jacobian(true);
+    // The handles bound to the pool streams are released with the pool
+    CHECK(context.getNumHandles() == num_handles);
+    CAPTURE(expected, result);
+    for (size_t i = 0; i < num_obs; i++) {
+        for (size_t j = 0; j < num_params; j++) {
+            CHECK(expected[i][j] == Approx(result[i][j]).margin(1e-7));
+        }
+    }
+}
 TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=[RX,RX,RX], Obs=[ZZZ]",
           "[AdjointJacobianGPU]") {
     AdjointJacobianGPU<double> adj;
@@ -429,3 +599,213 @@ TEST_CASE("AdjointJacobianGPU::batchAdjointJacobian Mixed Ops, Obs and TParams",
         CHECK(expected[2] == Approx(jacobian[0][2]));
     }
 }
+
+TEST_CASE("AdjointJacobianGPU::batchAdjointJacobian Many Obs",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    const size_t num_qubits = 3;
+    const std::vector<size_t> t_params{0, 1, 2};
+    const std::vector<double> param{-M_PI / 7, M_PI / 5, 2 * M_PI / 3};
+
+    // More observables than tasks per device, so each GPU runs several tasks
+    std::vector<ObsDatum<double>> obs_list;
+    for (const auto &name : {"PauliX", "PauliY", "PauliZ"}) {
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            obs_list.push_back(ObsDatum<double>({name}, {{}}, {{wire}}));
+            obs_list.push_back(ObsDatum<double>({name, "PauliZ"}, {{}, {}},
+                                                {{wire}, {(wire + 1) % 3}}));
+        }
+    }
+    const size_t num_obs = obs_list.size();
+
+    auto ops = adj.createOpsData({"RX", "RY", "RZ", "CNOT", "CNOT"},
+                                 {{param[0]}, {param[1]}, {param[2]}, {}, {}},
+                                 {{0}, {1}, {2}, {0, 1}, {1, 2}},
+                                 {false, false, false, false, false});
+
+    std::vector<std::vector<double>> jac_batched(
+        num_obs, std::vector<double>(t_params.size(), 0));
+    std::vector<std::vector<double>> jac_single(
+        num_obs, std::vector<double>(t_params.size(), 0));
+
+    std::vector<std::complex<double>> cdata(0b1 << num_qubits);
+    cdata[0] = std::complex<double>{1, 0};
+    SVDataGPU<double> psi(num_qubits, cdata);
+
+    adj.batchAdjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                             jac_batched, obs_list, ops, t_params, true);
+    adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                        jac_single, obs_list, ops, t_params, true);
+
+    for (size_t i = 0; i < num_obs; i++) {
+        for (size_t j = 0; j < t_params.size(); j++) {
+            CHECK(jac_single[i][j] == Approx(jac_batched[i][j]).margin(1e-7));
+        }
+    }
+}
+
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Fused forward pass",
+          "[AdjointJacobianGPU]") {
+    const size_t num_qubits = 3;
+    const std::vector<size_t> t_params{0, 1, 2, 3};
+    std::vector<std::complex<double>> cdata(Pennylane::Util::exp2(num_qubits));
+    cdata[0] = {1, 0};
+
+    auto obs1 = ObsDatum<double>({"PauliZ", "PauliX"}, {{}, {}}, {{0}, {2}});
+    auto obs2 = ObsDatum<double>({"PauliY"}, {{}}, {{1}});
+
+    std::vector<std::vector<double>> expected;
+    for (size_t max_width : {0, 2, 3, 4}) {
+        AdjointJacobianGPU<double> adj;
+        adj.setFusionMaxWidth(max_width);
+        CHECK(adj.getFusionMaxWidth() == max_width);
+
+        auto ops = adj.createOpsData(
+            {"Hadamard", "RX", "CNOT", "RY", "CRZ", "Toffoli", "RZ"},
+            {{}, {0.3}, {}, {-0.6}, {1.1}, {}, {0.4}},
+            {{0}, {1}, {0, 1}, {2}, {1, 2}, {0, 1, 2}, {0}},
+            {false, false, false, true, false, false, false});
+
+        SVDataGPU<double> psi(num_qubits, cdata);
+        std::vector<std::vector<double>> jacobian(
+            2, std::vector<double>(t_params.size(), 0));
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            jacobian, {obs1, obs2}, ops, t_params, true);
+        if (expected.empty()) {
+            expected = jacobian;
+            continue;
+        }
+        for (size_t obs_idx = 0; obs_idx < jacobian.size(); obs_idx++) {
+            CHECK(jacobian[obs_idx] ==
+                  Pennylane::approx(expected[obs_idx]).margin(1e-7));
+        }
+    }
+}
+
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Op=[Hadamard,Hadamard,"
+          "ControlledPhaseShift], Obs=[Y1]",
+          "[AdjointJacobianGPU]") {
+    AdjointJacobianGPU<double> adj;
+    const size_t num_qubits = 2;
+    const std::vector<size_t> t_params{0};
+    const double param = 0.3;
+
+    auto ops =
+        adj.createOpsData({"Hadamard", "Hadamard", "ControlledPhaseShift"},
+                          {{}, {}, {param}}, {{0}, {1}, {0, 1}},
+                          {false, false, false});
+    auto obs = ObsDatum<double>({"PauliY"}, {{}}, {{1}});
+
+    std::vector<std::complex<double>> cdata(Pennylane::Util::exp2(num_qubits));
+    cdata[0] = {1, 0};
+    SVDataGPU<double> psi(num_qubits, cdata);
+    std::vector<std::vector<double>> jacobian(1, std::vector<double>(1, 0));
+    adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                        jacobian, {obs}, ops, t_params, true);
+
+    // <Y1> = sin(param) / 2
+    CHECK(jacobian[0][0] == Approx(0.5 * std::cos(param)).margin(1e-7));
+}
+
+TEST_CASE("AdjointJacobianGPU::adjointJacobian Mixed precision",
+          "[AdjointJacobianGPU]") {
+    const size_t num_qubits = 4;
+    const std::vector<size_t> t_params{0, 1, 2, 3};
+    const std::vector<std::string> op_names{"Hadamard", "RX",  "CNOT", "RY",
+                                            "CRZ",      "RZ",  "IsingXX"};
+    const std::vector<std::vector<size_t>> op_wires{
+        {0}, {1}, {0, 1}, {2}, {1, 3}, {0}, {2, 3}};
+    const std::vector<bool> op_inverses{false, false, false, true,
+                                        false, false, false};
+
+    auto jacobianOf = [&](auto precision, bool mixed_precision) {
+        using PrecisionT = decltype(precision);
+        AdjointJacobianGPU<PrecisionT> adj;
+        adj.setMixedPrecision(mixed_precision);
+        auto ops = adj.createOpsData(
+            op_names, {{}, {0.3}, {}, {-0.6}, {1.1}, {0.4}, {0.9}}, op_wires,
+            op_inverses);
+        auto obs1 = ObsDatum<PrecisionT>({"PauliZ", "PauliX"}, {{}, {}},
+                                         {{0}, {3}});
+        auto obs2 = ObsDatum<PrecisionT>({"PauliY"}, {{}}, {{1}});
+
+        std::vector<std::complex<PrecisionT>> cdata(
+            Pennylane::Util::exp2(num_qubits));
+        cdata[0] = {1, 0};
+        SVDataGPU<PrecisionT> psi(num_qubits, cdata);
+        std::vector<std::vector<PrecisionT>> jacobian(
+            2, std::vector<PrecisionT>(t_params.size(), 0));
+        adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                            jacobian, {obs1, obs2}, ops, t_params, true);
+        return jacobian;
+    };
+
+    AdjointJacobianGPU<float> adj;
+    CHECK_FALSE(adj.getMixedPrecision());
+    adj.setMixedPrecision(true);
+    CHECK(adj.getMixedPrecision());
+    CHECK(AdjointJacobianGPU<double>{}.getMixedPrecision());
+
+    const auto expected = jacobianOf(double{}, false);
+    const auto jacobian = jacobianOf(float{}, true);
+    for (size_t obs_idx = 0; obs_idx < expected.size(); obs_idx++) {
+        for (size_t tp_idx = 0; tp_idx < t_params.size(); tp_idx++) {
+            CHECK(jacobian[obs_idx][tp_idx] ==
+                  Approx(expected[obs_idx][tp_idx]).margin(1e-5));
+        }
+    }
+}
+
+TEST_CASE("AdjointJacobianGPU::vectorJacobianProduct Op=[RX,CNOT,RY,CRZ,RZ], "
+          "Obs=[Z0X3,Y1,X2]",
+          "[AdjointJacobianGPU]") {
+    using PrecisionT = double;
+    AdjointJacobianGPU<PrecisionT> adj;
+    const size_t num_qubits = 4;
+    const std::vector<size_t> t_params{0, 1, 2, 3};
+
+    auto ops = adj.createOpsData(
+        {"RX", "CNOT", "RY", "CRZ", "RZ"}, {{0.3}, {}, {-0.6}, {1.1}, {0.4}},
+        {{0}, {0, 1}, {2}, {1, 3}, {0}}, {false, false, true, false, false});
+    const std::vector<ObsDatum<PrecisionT>> obs{
+        {{"PauliZ", "PauliX"}, {{}, {}}, {{0}, {3}}},
+        {{"PauliY"}, {{}}, {{1}}},
+        {{"PauliX"}, {{}}, {{2}}}};
+    const std::vector<PrecisionT> dy{0.5, -1.5, 0.0};
+
+    std::vector<std::complex<PrecisionT>> cdata(
+        Pennylane::Util::exp2(num_qubits));
+    cdata[0] = {1, 0};
+    SVDataGPU<PrecisionT> psi(num_qubits, cdata);
+
+    std::vector<std::vector<PrecisionT>> jacobian(
+        obs.size(), std::vector<PrecisionT>(t_params.size(), 0));
+    adj.adjointJacobian(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                        jacobian, obs, ops, t_params, true);
+
+    std::vector<PrecisionT> vjp;
+    adj.vectorJacobianProduct(psi.cuda_sv.getData(), psi.cuda_sv.getLength(),
+                              vjp, dy, obs, ops, t_params, true);
+    REQUIRE(vjp.size() == t_params.size());
+    for (size_t tp_idx = 0; tp_idx < t_params.size(); tp_idx++) {
+        PrecisionT expected = 0;
+        for (size_t obs_idx = 0; obs_idx < obs.size(); obs_idx++) {
+            expected += dy[obs_idx] * jacobian[obs_idx][tp_idx];
+        }
+        CHECK(vjp[tp_idx] == Approx(expected).margin(1e-7));
+    }
+
+    SECTION("Zero cotangents") {
+        adj.vectorJacobianProduct(psi.cuda_sv.getData(),
+                                  psi.cuda_sv.getLength(), vjp, {0, 0, 0},
+                                  obs, ops, t_params, true);
+        CHECK(vjp == std::vector<PrecisionT>(t_params.size(), 0));
+    }
+    SECTION("Mismatched cotangents") {
+        REQUIRE_THROWS_AS(
+            adj.vectorJacobianProduct(psi.cuda_sv.getData(),
+                                      psi.cuda_sv.getLength(), vjp, {1.0},
+                                      obs, ops, t_params, true),
+            LightningException);
+    }
+}
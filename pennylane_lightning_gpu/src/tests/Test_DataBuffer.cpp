@@ -11,7 +11,10 @@
 
 #include "DataBuffer.hpp"
 #include "DevTag.hpp"
+#include "DeviceExecutor.hpp"
+#include "DeviceMemoryPool.hpp"
 #include "DevicePool.hpp"
+#include "DeviceWorkspace.hpp"
 
 #include <cuComplex.h> // cuDoubleComplex
 #include <cuda.h>
@@ -65,6 +68,24 @@ TEMPLATE_TEST_CASE("DataBuffer::memory allocation", "[DataBuffer]", float,
         CHECK(data_buffer1.getStream() == 0);
         CHECK(data_buffer1.getDevice() == 0);
     }
+    SECTION("Non-owning view over existing memory") {
+        DataBuffer<TestType, int> data_buffer1{8, 0, 0, true};
+        std::vector<TestType> host_data_in(4, 1);
+        std::vector<TestType> host_data_out(8, 0);
+        {
+            DataBuffer<TestType, int> view{4, data_buffer1.getData() + 4,
+                                           data_buffer1.getDevTag()};
+            CHECK_FALSE(view.ownsData());
+            CHECK(view.getLength() == 4);
+            view.CopyHostDataToGpu(host_data_in.data(), host_data_in.size(),
+                                   false);
+        }
+        // Memory remains valid after the view is destroyed
+        CHECK(data_buffer1.ownsData());
+        data_buffer1.CopyGpuDataToHost(host_data_out.data(), 8, false);
+        CHECK(std::vector<TestType>{host_data_out.begin() + 4,
+                                    host_data_out.end()} == host_data_in);
+    }
 }
 
 TEMPLATE_TEST_CASE("Data locality and movement", "[DataBuffer]", float,
@@ -111,5 +132,207 @@ TEMPLATE_TEST_CASE("Data locality and movement", "[DataBuffer]", float,
                 dev_pool.releaseDevice(id);
             }
         }
+        SECTION("Multi-GPU peer broadcast") {
+            const auto num_devices =
+                static_cast<int>(DevicePool<int>::getTotalDevices());
+            DataBuffer<TestType, int> src{6, DevTag<int>{0, 0}};
+            std::vector<std::unique_ptr<DataBuffer<TestType, int>>> buffers;
+            std::vector<TestType *> dsts;
+            std::vector<int> dst_devices;
+            std::vector<cudaStream_t> dst_streams;
+            for (int dev = 1; dev < num_devices; dev++) {
+                buffers.emplace_back(
+                    std::make_unique<DataBuffer<TestType, int>>(
+                        6, DevTag<int>{dev, 0}));
+                dsts.push_back(buffers.back()->getData());
+                dst_devices.push_back(dev);
+                dst_streams.push_back(buffers.back()->getStream());
+            }
+
+            std::vector<TestType> host_data_in(6, 1);
+            src.CopyHostDataToGpu(host_data_in.data(), host_data_in.size(),
+                                  false);
+            CHECK(cuUtil::getPointerDevice(src.getData()) == 0);
+            cuUtil::broadcastPeer(src.getData(), 0, src.getStream(), dsts,
+                                  dst_devices, dst_streams, 6);
+            for (auto &buffer : buffers) {
+                std::vector<TestType> host_data_out(6, 0);
+                buffer->CopyGpuDataToHost(host_data_out.data(), 6, false);
+                CHECK(host_data_in == host_data_out);
+            }
+        }
+    }
+}
+
+TEST_CASE("DeviceExecutor::run", "[DataBuffer]") {
+    auto &executor = DeviceExecutor::getInstance();
+    const auto num_tasks = 4 * executor.getNumDevices();
+
+    SECTION("Tasks run on the given devices only") {
+        const std::vector<int> devices{0};
+        std::vector<int> task_devices(num_tasks, -1);
+        std::vector<DeviceExecutor::Task> tasks;
+        for (std::size_t i = 0; i < num_tasks; i++) {
+            tasks.emplace_back([&task_devices, i](int device_id) {
+                task_devices[i] = device_id;
+            });
+        }
+        std::vector<int> done_devices;
+        executor.run(std::move(tasks), devices,
+                     [&done_devices](int device_id) {
+                         done_devices.push_back(device_id);
+                     });
+        CHECK(task_devices == std::vector<int>(num_tasks, 0));
+        CHECK(done_devices == devices);
+    }
+    SECTION("Task exceptions are rethrown") {
+        std::vector<DeviceExecutor::Task> tasks;
+        tasks.emplace_back([](int) { PL_ABORT("Task failed."); });
+        CHECK_THROWS_WITH(executor.run(std::move(tasks), {0}),
+                          Catch::Contains("Task failed."));
+    }
+}
+
+TEST_CASE("DeviceWorkspace::getWorkspace", "[DataBuffer]") {
+    DeviceWorkspace<int> workspace{DevTag<int>{0, 0}};
+    SECTION("Empty requests do not allocate") {
+        CHECK(workspace.getWorkspace(0) == nullptr);
+        CHECK(workspace.getCapacity() == 0);
+        CHECK(workspace.getHighWaterMark() == 0);
+    }
+    SECTION("Buffer is reused when large enough") {
+        auto *ptr_large = workspace.getWorkspace(1024);
+        CHECK(ptr_large != nullptr);
+        CHECK(workspace.getCapacity() == 1024);
+
+        auto *ptr_small = workspace.getWorkspace(128);
+        CHECK(ptr_small == ptr_large);
+        CHECK(workspace.getCapacity() == 1024);
+        CHECK(workspace.getHighWaterMark() == 1024);
+    }
+    SECTION("Buffer grows and tracks high-water mark") {
+        workspace.getWorkspace(128);
+        workspace.getWorkspace(4096);
+        CHECK(workspace.getCapacity() == 4096);
+        CHECK(workspace.getHighWaterMark() == 4096);
+
+        workspace.release();
+        CHECK(workspace.getCapacity() == 0);
+        CHECK(workspace.getHighWaterMark() == 4096);
+    }
+}
+
+TEST_CASE("DeviceMemoryPool", "[DataBuffer]") {
+    auto &pool = DeviceMemoryPool::getInstance();
+    pool.setEnabled(true);
+    pool.resetCounters();
+
+    SECTION("Size classes are powers of two") {
+        CHECK(DeviceMemoryPool::getSizeClass(1) == 512);
+        CHECK(DeviceMemoryPool::getSizeClass(512) == 512);
+        CHECK(DeviceMemoryPool::getSizeClass(513) == 1024);
+        CHECK(DeviceMemoryPool::getSizeClass(1UL << 20U) == 1UL << 20U);
+    }
+    SECTION("Large size classes are multiples of 2 MiB") {
+        constexpr std::size_t MiB = 1UL << 20U;
+        CHECK(DeviceMemoryPool::getSizeClass(MiB + 1) == 2 * MiB);
+        CHECK(DeviceMemoryPool::getSizeClass(3 * MiB) == 4 * MiB);
+        CHECK(DeviceMemoryPool::getSizeClass(6 * MiB) == 6 * MiB);
+        CHECK(DeviceMemoryPool::getSizeClass(10 * MiB + 1) == 12 * MiB);
+    }
+    SECTION("Released buffers are reused") {
+        const double2 *first_ptr = nullptr;
+        {
+            DataBuffer<double2, int> buffer{256, 0, 0, true};
+            first_ptr = buffer.getData();
+        }
+        CHECK(pool.getStats().cached_blocks >= 1);
+        for (std::size_t i = 0; i < 4; i++) {
+            DataBuffer<double2, int> buffer{256, 0, 0, true};
+            CHECK(buffer.getData() == first_ptr);
+        }
+        const auto stats = pool.getStats();
+        CHECK(stats.misses == 1);
+        CHECK(stats.hits == 4);
+    }
+    SECTION("Copy assignment reuses memory of the same size") {
+        std::vector<double> host_in{1, 2, 3, 4};
+        DataBuffer<double, int> src{4, 0, 0, true};
+        src.CopyHostDataToGpu(host_in.data(), host_in.size());
+        DataBuffer<double, int> dst{4, 0, 0, true};
+        const auto *dst_ptr = dst.getData();
+        const auto in_use = pool.getStats().in_use_bytes;
+
+        dst = src;
+        CHECK(dst.getData() == dst_ptr);
+        CHECK(pool.getStats().in_use_bytes == in_use);
+
+        std::vector<double> host_out(4, 0);
+        dst.CopyGpuDataToHost(host_out.data(), host_out.size());
+        CHECK(host_out == host_in);
+    }
+    SECTION("Buffers are released to their own device") {
+        const auto num_devices =
+            static_cast<int>(DevicePool<int>::getTotalDevices());
+        for (int dev = 0; dev < num_devices; dev++) {
+            const double2 *first_ptr = nullptr;
+            {
+                DataBuffer<double2, int> buffer{256, DevTag<int>{dev, 0}};
+                first_ptr = buffer.getData();
+                // Destroy the buffer while another device is current
+                PL_CUDA_IS_SUCCESS(cudaSetDevice(0));
+            }
+            int current_device = -1;
+            PL_CUDA_IS_SUCCESS(cudaGetDevice(&current_device));
+            CHECK(current_device == 0);
+
+            DataBuffer<double2, int> buffer{256, DevTag<int>{dev, 0}};
+            CHECK(buffer.getData() == first_ptr);
+            CHECK(cuUtil::getPointerDevice(buffer.getData()) == dev);
+            PL_CUDA_IS_SUCCESS(cudaSetDevice(0));
+        }
+    }
+    SECTION("Trim releases the idle blocks") {
+        { DataBuffer<char, int> buffer{4096, 0, 0, true}; }
+        CHECK(pool.getStats().cached_bytes >= 4096);
+        CHECK(pool.getCachedBytes(0) >= 4096);
+        CHECK(pool.trim() >= 4096);
+        CHECK(pool.getCachedBytes(0) == 0);
+        CHECK(pool.getStats().cached_bytes == 0);
+        CHECK(pool.getStats().cached_blocks == 0);
+    }
+    pool.setEnabled(false);
+    CHECK(pool.getStats().cached_bytes == 0);
+}
+
+TEST_CASE("CublasHandleRegistry::getHandle", "[DataBuffer]") {
+    auto &registry = cuUtil::CublasHandleRegistry::getInstance();
+    DataBuffer<double2, int> buffer1{8, 0, 0, true};
+    DataBuffer<double2, int> buffer2{4, 0, 0, true};
+
+    SECTION("Buffers on the same device and stream share a handle") {
+        CHECK(buffer1.getCublasHandle() == buffer2.getCublasHandle());
+        CHECK(registry.getHandle(0, 0) == buffer1.getCublasHandle());
+    }
+    SECTION("Repeated lookups do not create new handles") {
+        registry.getHandle(0, 0);
+        const auto num_handles = registry.getNumHandles();
+        for (std::size_t i = 0; i < 4; i++) {
+            static_cast<void>(buffer1.getCublasHandle());
+        }
+        CHECK(registry.getNumHandles() == num_handles);
+    }
+    SECTION("Handles are not shared between pointer modes") {
+        auto host_handle = registry.getHandle(0, 0);
+        auto device_handle =
+            registry.getHandle(0, 0, CUBLAS_POINTER_MODE_DEVICE);
+        CHECK(host_handle != device_handle);
+
+        cublasPointerMode_t pointer_mode;
+        PL_CUBLAS_IS_SUCCESS(cublasGetPointerMode(host_handle, &pointer_mode));
+        CHECK(pointer_mode == CUBLAS_POINTER_MODE_HOST);
+        PL_CUBLAS_IS_SUCCESS(
+            cublasGetPointerMode(device_handle, &pointer_mode));
+        CHECK(pointer_mode == CUBLAS_POINTER_MODE_DEVICE);
     }
 }
@@ -3,6 +3,7 @@
 #include <complex>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -42,4 +43,97 @@ TEMPLATE_TEST_CASE("CuGateCache", "[CuGateCache]", float, double) {
             CHECK(H_host[i].y == Approx(H_transfer[i].imag()).epsilon(1e-7));
         }
     }
-}
\ No newline at end of file
+}
+TEMPLATE_TEST_CASE("CuGateCache bounded", "[CuGateCache]", float, double) {
+    using cp_dev_t = decltype(cuUtil::getCudaType(TestType{}));
+    const std::size_t gate_bytes = 4 * sizeof(cp_dev_t);
+
+    // Room for the default gates and two more single-qubit gates
+    GateCache<TestType> gc_default(true);
+    const auto capacity = gc_default.getUsedBytes() + 2 * gate_bytes;
+    GateCache<TestType> gc(true, DevTag<int>{0, 0}, capacity);
+
+    REQUIRE(gc.getCapacity() == capacity);
+    REQUIRE(gc.getTotalAllocBytes() <= capacity);
+    REQUIRE(gc.getUsedBytes() == gc_default.getUsedBytes());
+
+    auto add_rx = [&gc](TestType angle) {
+        gc.add_gate("RX", angle, cuGates::getRX<cp_dev_t>(angle));
+        return gc.get_gate_device_ptr("RX", angle);
+    };
+
+    SECTION("Least recently used gates are evicted") {
+        add_rx(0.1);
+        add_rx(0.2);
+        CHECK(gc.getEvictions() == 0);
+        // Touch 0.1, so 0.2 is the least recently used
+        static_cast<void>(gc.get_gate_device_ptr("RX", 0.1));
+        add_rx(0.3);
+
+        CHECK(gc.getEvictions() == 1);
+        CHECK(gc.gateExists("RX", 0.1));
+        CHECK_FALSE(gc.gateExists("RX", 0.2));
+        CHECK(gc.gateExists("RX", 0.3));
+        CHECK(gc.getUsedBytes() <= capacity);
+        CHECK(gc.getMisses() == 3);
+        CHECK(gc.getHits() == 1);
+    }
+    SECTION("Default gates are never evicted") {
+        for (size_t i = 0; i < 10; i++) {
+            add_rx(static_cast<TestType>(0.1 * i));
+        }
+        for (const auto &name : {"PauliX", "Hadamard", "SWAP", "Toffoli"}) {
+            CHECK(gc.gateExists(name, 0.0));
+        }
+        CHECK(gc.getEvictions() == 8);
+    }
+    SECTION("Slab reuse keeps the matrices correct") {
+        for (size_t i = 0; i < 6; i++) {
+            const auto angle = static_cast<TestType>(0.25 * i);
+            const auto *dev_ptr = add_rx(angle);
+            const auto expected = cuGates::getRX<cp_dev_t>(angle);
+            std::vector<cp_dev_t> result(expected.size());
+            PL_CUDA_IS_SUCCESS(cudaMemcpy(result.data(), dev_ptr,
+                                          sizeof(cp_dev_t) * result.size(),
+                                          cudaMemcpyDeviceToHost));
+            for (size_t j = 0; j < expected.size(); j++) {
+                CHECK(result[j].x == Approx(expected[j].x));
+                CHECK(result[j].y == Approx(expected[j].y));
+            }
+        }
+    }
+    SECTION("Gates larger than the capacity are rejected") {
+        const std::vector<cp_dev_t> big((capacity / sizeof(cp_dev_t)) + 1);
+        REQUIRE_THROWS(gc.add_gate("Big", 0.0, big));
+    }
+    SECTION("Switching back to unbounded keeps the default gates") {
+        add_rx(0.1);
+        gc.setCapacity(0);
+        CHECK(gc.getCapacity() == 0);
+        CHECK_FALSE(gc.gateExists("RX", 0.1));
+        CHECK(gc.gateExists("Hadamard", 0.0));
+        CHECK(gc.getTotalAllocBytes() == gc_default.getTotalAllocBytes());
+    }
+}
+TEMPLATE_TEST_CASE("CuGateCache shared gates", "[CuGateCache]", float,
+                   double) {
+    using cp_dev_t = decltype(cuUtil::getCudaType(TestType{}));
+    auto shared = std::make_shared<const GateCache<TestType>>(true);
+    GateCache<TestType> gc(false);
+    gc.setSharedGates(shared);
+
+    SECTION("Missing gates are read from the shared cache") {
+        CHECK(gc.gateExists("Hadamard", 0.0));
+        CHECK(gc.get_gate_device_ptr("Hadamard", 0.0) ==
+              shared->find_gate_device_ptr({"Hadamard", 0.0}));
+        CHECK(gc.getHits() == 1);
+        CHECK(gc.getTotalAllocBytes() == 0);
+    }
+    SECTION("Local gates take precedence") {
+        CHECK_FALSE(gc.gateExists("RX", 0.5));
+        gc.add_gate("RX", 0.5, cuGates::getRX<cp_dev_t>(TestType{0.5}));
+        CHECK(gc.gateExists("RX", 0.5));
+        CHECK(shared->find_gate_device_ptr({"RX", 0.5}) == nullptr);
+        CHECK(gc.getTotalAllocBytes() == 4 * sizeof(cp_dev_t));
+    }
+}
@@ -0,0 +1,144 @@
+#include <algorithm>
+#include <complex>
+#include <numeric>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+#include "StateVectorCudaDistributed.hpp"
+#include "StateVectorCudaManaged.hpp"
+#include "cuda_helpers.hpp"
+
+#include "TestHelpers.hpp"
+
+using namespace Pennylane;
+using namespace CUDA;
+
+namespace {
+/**
+ * @brief Apply the same circuit, touching every wire, to both simulators.
+ */
+template <class SVType> void applyTestCircuit(SVType &sv) {
+    using PrecisionT = typename SVType::scalar_type_t;
+    const size_t num_qubits = sv.getNumQubits();
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        sv.applyOperation("Hadamard", {wire}, false);
+        sv.applyOperation("RX", {wire}, false,
+                          {static_cast<PrecisionT>(0.3 * (wire + 1))});
+    }
+    sv.applyOperation("CNOT", {0, num_qubits - 1}, false);
+    sv.applyOperation("CRY", {num_qubits - 1, 0}, false, {0.7});
+    sv.applyOperation("SWAP", {0, 1}, false);
+    sv.applyOperation("Rot", {0}, true, {0.1, 0.2, 0.3});
+}
+} // namespace
+
+TEMPLATE_TEST_CASE("StateVectorCudaDistributed::applyOperation",
+                   "[StateVectorCudaDistributed]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    const size_t num_qubits = 4;
+    const auto num_devices = Pennylane::Util::exp2(
+        Pennylane::Util::log2(DevicePool<int>::getTotalDevices()));
+
+    StateVectorCudaDistributed<TestType> sv_dist{num_qubits, num_devices};
+    StateVectorCudaManaged<TestType> sv_ref{num_qubits};
+    sv_ref.initSV();
+
+    CHECK(sv_dist.getNumDevices() == num_devices);
+    CHECK(sv_dist.getNumGlobalQubits() + sv_dist.getNumLocalQubits() ==
+          num_qubits);
+
+    applyTestCircuit(sv_dist);
+    applyTestCircuit(sv_ref);
+
+    SECTION("State matches the single-device state") {
+        std::vector<ComplexT> data_dist(Pennylane::Util::exp2(num_qubits));
+        std::vector<ComplexT> data_ref(Pennylane::Util::exp2(num_qubits));
+        sv_dist.CopyGpuDataToHost(data_dist.data(), data_dist.size());
+        sv_ref.CopyGpuDataToHost(data_ref.data(), data_ref.size());
+        CHECK(data_dist == Pennylane::approx(data_ref).margin(1e-5));
+    }
+    SECTION("Expectation values match on global and local wires") {
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            const auto expect_dist = sv_dist.expval(
+                "PauliX", {wire}, {0.0}, std::vector<ComplexT>{});
+            const auto expect_ref = sv_ref.expval("PauliX", {wire}, {0.0},
+                                                  std::vector<ComplexT>{});
+            CHECK(expect_dist.x == Approx(expect_ref.x).margin(1e-5));
+        }
+    }
+    SECTION("Probabilities match on global and local wires") {
+        for (const auto &wires : std::vector<std::vector<size_t>>{
+                 {0}, {3}, {0, 2}, {2, 0}, {1, 3, 0}, {0, 1, 2, 3}}) {
+            CHECK(sv_dist.probability(wires) ==
+                  Pennylane::approx(sv_ref.probability(wires)).margin(1e-5));
+        }
+    }
+    SECTION("Samples follow the state probabilities") {
+        const size_t num_samples = 10000;
+        const auto samples = sv_dist.generate_samples(num_samples);
+        REQUIRE(samples.size() == num_samples * num_qubits);
+
+        std::vector<double> counts(Pennylane::Util::exp2(num_qubits), 0);
+        for (size_t i = 0; i < num_samples; i++) {
+            size_t idx = 0;
+            for (size_t j = 0; j < num_qubits; j++) {
+                idx = (idx << 1U) | samples[i * num_qubits + j];
+            }
+            counts[idx] += 1.0 / num_samples;
+        }
+        CHECK(counts ==
+              Pennylane::approx(sv_ref.probability({0, 1, 2, 3})).margin(5e-2));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaDistributed::restoreWireOrder",
+                   "[StateVectorCudaDistributed]", float, double) {
+    using ComplexT = std::complex<TestType>;
+    const size_t num_qubits = 5;
+    const auto num_devices = Pennylane::Util::exp2(
+        Pennylane::Util::log2(DevicePool<int>::getTotalDevices()));
+
+    StateVectorCudaDistributed<TestType> sv_dist{num_qubits, num_devices};
+    StateVectorCudaManaged<TestType> sv_ref{num_qubits};
+    sv_ref.initSV();
+
+    // Global-wire gates leave the wires on the local bits they were moved to,
+    // so later gates and observables run on a permuted layout
+    for (size_t rep = 0; rep < 3; rep++) {
+        applyTestCircuit(sv_dist);
+        applyTestCircuit(sv_ref);
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            const auto expect_dist = sv_dist.expval(
+                "PauliZ", {wire}, {0.0}, std::vector<ComplexT>{});
+            const auto expect_ref = sv_ref.expval("PauliZ", {wire}, {0.0},
+                                                  std::vector<ComplexT>{});
+            CHECK(expect_dist.x == Approx(expect_ref.x).margin(1e-5));
+        }
+    }
+
+    std::vector<ComplexT> data_dist(Pennylane::Util::exp2(num_qubits));
+    std::vector<ComplexT> data_ref(Pennylane::Util::exp2(num_qubits));
+    sv_ref.CopyGpuDataToHost(data_ref.data(), data_ref.size());
+
+    SECTION("Copies use the canonical layout") {
+        sv_dist.CopyGpuDataToHost(data_dist.data(), data_dist.size());
+        CHECK(data_dist == Pennylane::approx(data_ref).margin(1e-5));
+    }
+    SECTION("Restoring the layout keeps the state") {
+        sv_dist.restoreWireOrder();
+        sv_dist.restoreWireOrder();
+        sv_dist.CopyGpuDataToHost(data_dist.data(), data_dist.size());
+        CHECK(data_dist == Pennylane::approx(data_ref).margin(1e-5));
+    }
+    SECTION("Host data replaces a permuted state") {
+        sv_dist.CopyHostDataToGpu(data_ref.data(), data_ref.size());
+        applyTestCircuit(sv_dist);
+        applyTestCircuit(sv_ref);
+        sv_ref.CopyGpuDataToHost(data_ref.data(), data_ref.size());
+        CHECK(sv_dist.probability({0, 4}) ==
+              Pennylane::approx(sv_ref.probability({0, 4})).margin(1e-5));
+        sv_dist.CopyGpuDataToHost(data_dist.data(), data_dist.size());
+        CHECK(data_dist == Pennylane::approx(data_ref).margin(1e-5));
+    }
+}
@@ -3,6 +3,7 @@
 #include <complex>
 #include <iostream>
 #include <limits>
+#include <numeric>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -22,6 +23,36 @@ using namespace CUDA;
 
 namespace {
 namespace cuUtil = Pennylane::CUDA::Util;
+
+/**
+ * @brief Row-major dense matrix of a Pauli word, with the first wire as the
+ * most significant bit.
+ */
+template <class PrecisionT>
+auto getPauliWordMatrix(const std::vector<std::string> &names,
+                        const std::vector<size_t> &wires, size_t num_qubits)
+    -> std::vector<std::complex<PrecisionT>> {
+    const size_t dim = Pennylane::Util::exp2(num_qubits);
+    std::vector<std::complex<PrecisionT>> matrix(dim * dim);
+    for (size_t col = 0; col < dim; col++) {
+        size_t row = col;
+        std::complex<PrecisionT> value{1, 0};
+        for (size_t op = 0; op < names.size(); op++) {
+            const size_t bit = num_qubits - 1 - wires[op];
+            const bool set = (col >> bit) & 1U;
+            if (names[op] == "PauliX" || names[op] == "PauliY") {
+                row ^= (size_t{1} << bit);
+            }
+            if (names[op] == "PauliY") {
+                value *= std::complex<PrecisionT>{0, set ? -1.0F : 1.0F};
+            } else if (names[op] == "PauliZ" && set) {
+                value = -value;
+            }
+        }
+        matrix[row * dim + col] = value;
+    }
+    return matrix;
+}
 } // namespace
 
 /**
@@ -75,6 +106,20 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::StateVectorCudaManaged",
             svdat.cuda_sv.CopyGpuDataToHost(out_data.data(), out_data.size());
             CHECK(out_data == Pennylane::approx(svdat.sv.getDataVector()));
         }
+        SECTION("View over existing GPU data") {
+            SVDataGPU<TestType> svdat{num_qubits};
+            std::vector<cp_t> out_data(Pennylane::Util::exp2(num_qubits));
+            {
+                StateVectorCudaManaged<TestType> view(
+                    num_qubits, svdat.cuda_sv.getData(),
+                    svdat.cuda_sv.getDataBuffer().getDevTag());
+                CHECK(view.getData() == svdat.cuda_sv.getData());
+                view.applyPauliX({0}, false);
+            }
+            svdat.sv.applyOperation("PauliX", {0}, false);
+            svdat.cuda_sv.CopyGpuDataToHost(out_data.data(), out_data.size());
+            CHECK(out_data == Pennylane::approx(svdat.sv.getDataVector()));
+        }
     }
 }
 
@@ -830,3 +875,484 @@ TEMPLATE_TEST_CASE("StateVectorCudaManaged::applyCSWAP",
         }
     }
 }
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::expvalHamiltonian",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 3;
+    const size_t dim = Pennylane::Util::exp2(num_qubits);
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        sv.applyOperation("RX", {wire}, false,
+                          {static_cast<TestType>(0.4 * (wire + 1))});
+        sv.applyOperation("RY", {wire}, false,
+                          {static_cast<TestType>(0.3 - 0.2 * wire)});
+    }
+    sv.applyOperation("CNOT", {0, 2}, false);
+    std::vector<cp_t> state(dim);
+    sv.CopyGpuDataToHost(state.data(), state.size());
+
+    const std::vector<TestType> coeffs{0.3, -1.2, 0.5, 0.8};
+    const std::vector<std::vector<std::string>> words{
+        {"PauliZ", "PauliZ"}, {"PauliX"}, {"PauliY", "Identity", "PauliX"}, {}};
+    const std::vector<std::vector<size_t>> wires{{0, 1}, {2}, {0, 1, 2}, {}};
+
+    // Reference values from the dense Hamiltonian on the host
+    std::vector<cp_t> hamiltonian(dim * dim);
+    std::vector<double> expected_words;
+    for (size_t word = 0; word < words.size(); word++) {
+        const auto matrix = getPauliWordMatrix<TestType>(
+            words[word], wires[word], num_qubits);
+        cp_t expect{0, 0};
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                expect += std::conj(state[row]) * matrix[row * dim + col] *
+                          state[col];
+                hamiltonian[row * dim + col] += coeffs[word] *
+                                                matrix[row * dim + col];
+            }
+        }
+        expected_words.push_back(static_cast<double>(expect.real()));
+    }
+    const double expected =
+        std::inner_product(coeffs.begin(), coeffs.end(),
+                           expected_words.begin(), 0.0);
+
+    SECTION("Pauli words are evaluated in one call") {
+        const auto result = sv.expvalPauliWords(words, wires);
+        CHECK(result == Pennylane::approx(expected_words).margin(1e-5));
+    }
+    SECTION("Hamiltonian") {
+        CHECK(sv.expvalHamiltonian(coeffs, words, wires) ==
+              Approx(expected).margin(1e-5));
+    }
+    SECTION("Sparse Hamiltonian") {
+        std::vector<int64_t> row_offsets{0};
+        std::vector<int64_t> columns;
+        std::vector<cp_t> values;
+        for (size_t row = 0; row < dim; row++) {
+            for (size_t col = 0; col < dim; col++) {
+                if (std::abs(hamiltonian[row * dim + col]) > 1e-12) {
+                    columns.push_back(static_cast<int64_t>(col));
+                    values.push_back(hamiltonian[row * dim + col]);
+                }
+            }
+            row_offsets.push_back(static_cast<int64_t>(columns.size()));
+        }
+        CHECK(sv.expvalSparseHamiltonian(row_offsets, columns, values) ==
+              Approx(expected).margin(1e-5));
+    }
+    SECTION("Unsupported Pauli word operators throw") {
+        REQUIRE_THROWS_AS(sv.expvalPauliWords({{"Hadamard"}}, {{0}}),
+                          LightningException);
+    }
+}
+
+TEST_CASE("StateVectorCudaManaged::setMixedPrecision",
+          "[StateVectorCudaManaged_Nonparam]") {
+    const size_t num_qubits = 6;
+    const size_t dim = Pennylane::Util::exp2(num_qubits);
+    const std::vector<std::string> ops{"Hadamard", "RX", "CNOT", "RY",
+                                       "CRZ",      "RZ", "IsingXX"};
+    const std::vector<std::vector<size_t>> wires{{0},    {1}, {0, 3}, {4},
+                                                 {3, 5}, {2}, {1, 4}};
+    const std::vector<bool> adjoints(ops.size(), false);
+    const std::vector<std::vector<double>> params{
+        {}, {0.3}, {}, {-0.6}, {1.1}, {0.4}, {0.7}};
+    std::vector<std::vector<float>> params_f;
+    for (const auto &p : params) {
+        params_f.emplace_back(p.begin(), p.end());
+    }
+    const std::vector<std::complex<double>> hermitian{
+        {1, 0},    {0, 0},   {0.5, 1}, {0, 0},
+        {0, 0},    {-1, 0},  {0, 0},   {0.2, -2},
+        {0.5, -1}, {0, 0},   {2, 0},   {0, 0},
+        {0, 0},    {0.2, 2}, {0, 0},   {0.5, 0}};
+    const std::vector<std::complex<float>> hermitian_f{hermitian.begin(),
+                                                       hermitian.end()};
+    std::vector<int64_t> row_offsets(dim + 1);
+    std::vector<int64_t> columns(dim);
+    std::vector<std::complex<double>> values(dim);
+    for (size_t row = 0; row < dim; row++) {
+        row_offsets[row + 1] = static_cast<int64_t>(row + 1);
+        columns[row] = static_cast<int64_t>(row);
+        values[row] = {static_cast<double>(row % 5) - 2, 0};
+    }
+    const std::vector<std::complex<float>> values_f{values.begin(),
+                                                    values.end()};
+
+    StateVectorCudaManaged<double> sv_ref{num_qubits};
+    sv_ref.initSV();
+    sv_ref.applyOperation(ops, wires, adjoints, params);
+    const double expected =
+        sv_ref.expval("Hermitian", {0, 4}, {}, hermitian).x;
+    const double expected_sparse =
+        sv_ref.expvalSparseHamiltonian(row_offsets, columns, values);
+
+    StateVectorCudaManaged<float> sv{num_qubits};
+    sv.initSV();
+    sv.applyOperation(ops, wires, adjoints, params_f);
+    CHECK_FALSE(sv.getMixedPrecision());
+    sv.setMixedPrecision(true);
+    CHECK(sv.getMixedPrecision());
+
+    SECTION("Expectation values") {
+        CHECK(sv.expval("Hermitian", {0, 4}, {}, hermitian_f).x ==
+              Approx(expected).margin(1e-5));
+        // A second evaluation reads the cached device matrix
+        CHECK(sv.expval("Hermitian", {0, 4}, {}, hermitian_f).x ==
+              Approx(expected).margin(1e-5));
+    }
+    SECTION("Sparse Hamiltonian inner product") {
+        CHECK(sv.expvalSparseHamiltonian(row_offsets, columns, values_f) ==
+              Approx(expected_sparse).margin(1e-5));
+    }
+    SECTION("Double precision is always mixed") {
+        CHECK(sv_ref.getMixedPrecision());
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::expvalAndVar",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 6;
+    const size_t dim = Pennylane::Util::exp2(num_qubits);
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        sv.applyOperation("RX", {wire}, false,
+                          {static_cast<TestType>(0.3 * (wire + 1))});
+        sv.applyOperation("RY", {wire}, false,
+                          {static_cast<TestType>(0.5 - 0.1 * wire)});
+    }
+    sv.applyOperation("CNOT", {0, 4}, false);
+    sv.applyOperation("CNOT", {5, 1}, false);
+    std::vector<cp_t> state(dim);
+    sv.CopyGpuDataToHost(state.data(), state.size());
+
+    // Hermitian observable 0.7 * Z X + 0.4 * Y Y on the given wires
+    auto observable = [](const std::vector<size_t> &wires,
+                         size_t num_wires) {
+        const auto zx = getPauliWordMatrix<TestType>({"PauliZ", "PauliX"},
+                                                     wires, num_wires);
+        const auto yy = getPauliWordMatrix<TestType>({"PauliY", "PauliY"},
+                                                     wires, num_wires);
+        std::vector<cp_t> matrix(zx.size());
+        for (size_t idx = 0; idx < matrix.size(); idx++) {
+            matrix[idx] = TestType{0.7} * zx[idx] + TestType{0.4} * yy[idx];
+        }
+        return matrix;
+    };
+    auto reference = [&](const std::vector<cp_t> &matrix) {
+        double mean = 0.0;
+        double mean_sqr = 0.0;
+        for (size_t row = 0; row < dim; row++) {
+            cp_t value{0, 0};
+            for (size_t col = 0; col < dim; col++) {
+                value += matrix[row * dim + col] * state[col];
+            }
+            mean += static_cast<double>((std::conj(state[row]) * value).real());
+            mean_sqr += static_cast<double>(std::norm(value));
+        }
+        return std::make_pair(mean, mean_sqr - mean * mean);
+    };
+
+    SECTION("Named observable") {
+        const auto [mean, variance] = sv.expvalAndVar("PauliX", {2});
+        const auto expected = reference(
+            getPauliWordMatrix<TestType>({"PauliX"}, {2}, num_qubits));
+        CHECK(mean == Approx(expected.first).margin(1e-5));
+        CHECK(variance == Approx(expected.second).margin(1e-5));
+    }
+    SECTION("Matrix observable") {
+        const std::vector<size_t> wires{3, 1};
+        const auto [mean, variance] =
+            sv.expvalAndVar("Obs", wires, {}, observable({0, 1}, 2));
+        const auto expected = reference(observable(wires, num_qubits));
+        CHECK(mean == Approx(expected.first).margin(1e-5));
+        CHECK(variance == Approx(expected.second).margin(1e-5));
+    }
+    SECTION("Matrix observable wider than the fused kernel") {
+        std::vector<size_t> wires(num_qubits);
+        std::iota(wires.begin(), wires.end(), 0);
+        REQUIRE(wires.size() > getMaxMomentWires_CUDA());
+        const auto matrix = observable({2, 5}, num_qubits);
+        const auto [mean, variance] =
+            sv.expvalAndVar("Wide", wires, {}, matrix);
+        const auto expected = reference(matrix);
+        CHECK(mean == Approx(expected.first).margin(1e-5));
+        CHECK(variance == Approx(expected.second).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::probability",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 4;
+    const size_t dim = Pennylane::Util::exp2(num_qubits);
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        sv.applyOperation("RY", {wire}, false,
+                          {static_cast<TestType>(0.4 + 0.3 * wire)});
+    }
+    sv.applyOperation("CNOT", {1, 3}, false);
+    std::vector<cp_t> state(dim);
+    sv.CopyGpuDataToHost(state.data(), state.size());
+
+    // Joint probabilities of `wires`, in PennyLane order, restricted to the
+    // basis states where `mask_wires` equal `mask_bits`
+    auto reference = [&](const std::vector<size_t> &wires,
+                         const std::vector<size_t> &mask_wires,
+                         const std::vector<int> &mask_bits) {
+        std::vector<double> probs(Pennylane::Util::exp2(wires.size()), 0.0);
+        for (size_t idx = 0; idx < dim; idx++) {
+            auto bit = [&](size_t wire) {
+                return (idx >> (num_qubits - 1 - wire)) & 1U;
+            };
+            bool selected = true;
+            for (size_t k = 0; k < mask_wires.size(); k++) {
+                selected &= bit(mask_wires[k]) ==
+                            static_cast<size_t>(mask_bits[k]);
+            }
+            if (!selected) {
+                continue;
+            }
+            size_t out = 0;
+            for (const auto wire : wires) {
+                out = (out << 1U) | bit(wire);
+            }
+            probs[out] += std::norm(state[idx]);
+        }
+        return probs;
+    };
+
+    SECTION("Probabilities follow the wire order") {
+        for (const auto &wires : std::vector<std::vector<size_t>>{
+                 {0}, {2}, {0, 1}, {3, 1}, {2, 0, 3}, {0, 1, 2, 3}}) {
+            CHECK(sv.probability(wires) ==
+                  Pennylane::approx(reference(wires, {}, {})).margin(1e-5));
+        }
+    }
+    SECTION("Masked probabilities") {
+        const std::vector<size_t> wires{3, 0};
+        const std::vector<size_t> mask_wires{1, 2};
+        const std::vector<int> mask_bits{1, 0};
+        CHECK(sv.probability(wires, mask_wires, mask_bits) ==
+              Pennylane::approx(reference(wires, mask_wires, mask_bits))
+                  .margin(1e-5));
+        // A projector onto a basis state is a fully masked probability
+        CHECK(sv.probability({}, {0, 1, 2, 3}, {1, 1, 0, 1}).front() ==
+              Approx(std::norm(state[0b1101])).margin(1e-5));
+    }
+    SECTION("Probabilities into a device buffer") {
+        const std::vector<size_t> wires{1, 3};
+        const auto d_probs = sv.probability_device(wires);
+        std::vector<double> probs(d_probs->getLength());
+        d_probs->CopyGpuDataToHost(probs.data(), probs.size(), false);
+        CHECK(probs ==
+              Pennylane::approx(reference(wires, {}, {})).margin(1e-5));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::host mirror",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 3;
+    const size_t length = Pennylane::Util::exp2(num_qubits);
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    sv.applyOperation("Hadamard", {0}, false);
+    sv.applyOperation("CNOT", {0, 2}, false);
+    std::vector<cp_t> expected(length);
+    sv.CopyGpuDataToHost(expected.data(), expected.size());
+
+    SECTION("Async download is unaffected by later gates") {
+        REQUIRE_FALSE(sv.isHostMirrorCurrent());
+        sv.CopyGpuDataToHostMirror();
+        REQUIRE(sv.isHostMirrorCurrent());
+        sv.applyOperation("PauliX", {1}, false);
+        CHECK_FALSE(sv.isHostMirrorCurrent());
+
+        std::vector<cp_t> host(length);
+        // The mirror is stale now, so this downloads the updated state
+        sv.CopyHostMirrorToHost(host.data(), host.size());
+        std::vector<cp_t> updated(length);
+        sv.CopyGpuDataToHost(updated.data(), updated.size());
+        CHECK(host == Pennylane::approx(updated));
+        CHECK(sv.isHostMirrorReady());
+    }
+    SECTION("Completed async download matches a synchronous copy") {
+        sv.CopyGpuDataToHostMirror();
+        std::vector<cp_t> host(length);
+        sv.CopyHostMirrorToHost(host.data(), host.size());
+        CHECK(host == Pennylane::approx(expected));
+    }
+    SECTION("Mirror allocation keeps the current device") {
+        int num_devices = 0;
+        PL_CUDA_IS_SUCCESS(cudaGetDeviceCount(&num_devices));
+        StateVectorCudaManaged<TestType> sv_last{
+            num_qubits, createStreamDevTag(num_devices - 1)};
+        sv_last.initSV();
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(0));
+
+        sv_last.CopyGpuDataToHostMirror();
+        int current_device = -1;
+        PL_CUDA_IS_SUCCESS(cudaGetDevice(&current_device));
+        CHECK(current_device == 0);
+
+        std::vector<cp_t> host(length);
+        sv_last.CopyHostMirrorToHost(host.data(), host.size());
+        CHECK(host[0] == cp_t{1, 0});
+    }
+    SECTION("Staged upload") {
+        std::vector<cp_t> data(length);
+        for (size_t idx = 0; idx < length; idx++) {
+            data[idx] = cp_t{static_cast<TestType>(idx % 3),
+                             static_cast<TestType>(idx % 2)};
+        }
+        const auto version = sv.getDataVersion();
+        sv.CopyHostDataToGpuStaged(data.data(), data.size());
+        // The staging buffer owns a copy, so the source may be reused
+        std::fill(data.begin(), data.end(), cp_t{0, 0});
+        CHECK(sv.getDataVersion() > version);
+        CHECK(sv.isHostMirrorCurrent());
+
+        std::vector<cp_t> host(length);
+        sv.CopyGpuDataToHost(host.data(), host.size());
+        for (size_t idx = 0; idx < length; idx++) {
+            CHECK(host[idx] == cp_t{static_cast<TestType>(idx % 3),
+                                    static_cast<TestType>(idx % 2)});
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::setStateVector",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 3;
+    const size_t length = Pennylane::Util::exp2(num_qubits);
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    sv.applyOperation("Hadamard", {1}, false);
+
+    SECTION("Basis state") {
+        const auto version = sv.getDataVersion();
+        sv.setBasisState(0b101);
+        CHECK(sv.getDataVersion() > version);
+
+        std::vector<cp_t> host(length);
+        sv.CopyGpuDataToHost(host.data(), host.size());
+        std::vector<cp_t> expected(length, {0, 0});
+        expected[0b101] = {1, 0};
+        CHECK(host == Pennylane::approx(expected));
+    }
+    SECTION("Full state") {
+        std::vector<cp_t> values(length);
+        for (size_t idx = 0; idx < length; idx++) {
+            values[idx] = cp_t{static_cast<TestType>(idx), 1};
+        }
+        sv.setStateVector(values.data(), values.size(), {0, 1, 2});
+
+        std::vector<cp_t> host(length);
+        sv.CopyGpuDataToHost(host.data(), host.size());
+        CHECK(host == Pennylane::approx(values));
+    }
+    SECTION("Sub-register state on permuted wires") {
+        // Amplitudes of |wire 2, wire 0>, with wire 1 left in |0>
+        const std::vector<cp_t> values{{0.1, 0}, {0.2, 0}, {0.3, 0}, {0.4, 0}};
+        sv.setStateVector(values.data(), values.size(), {2, 0});
+
+        std::vector<cp_t> host(length);
+        sv.CopyGpuDataToHost(host.data(), host.size());
+        std::vector<cp_t> expected(length, {0, 0});
+        expected[0b000] = values[0b00];
+        expected[0b100] = values[0b01];
+        expected[0b001] = values[0b10];
+        expected[0b101] = values[0b11];
+        CHECK(host == Pennylane::approx(expected));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::DeviceContext",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 2;
+    const DevTag<int> dev_tag{0, 0};
+    auto &context = DeviceContext<TestType>::getInstance(0);
+
+    StateVectorCudaManaged<TestType> sv_0{num_qubits, dev_tag};
+    const auto num_handles = context.getNumHandles();
+    StateVectorCudaManaged<TestType> sv_1{num_qubits, dev_tag};
+
+    SECTION("Handles are shared per stream") {
+        CHECK(sv_0.getCusvHandle() == sv_1.getCusvHandle());
+        CHECK(context.getNumHandles() == num_handles);
+    }
+    SECTION("Default gates are shared, not copied") {
+        CHECK(sv_1.getGateCache().getTotalAllocBytes() == 0);
+
+        // Hadamard and CNOT are read from the shared default gates
+        sv_1.applyOperation("Hadamard", {0}, false);
+        sv_1.applyOperation("CNOT", {0, 1}, false);
+        CHECK(sv_1.getGateCache().getTotalAllocBytes() == 0);
+
+        const auto inv_sqrt2 = static_cast<TestType>(1 / std::sqrt(2.0));
+        const std::vector<cp_t> expected{
+            {inv_sqrt2, 0}, {0, 0}, {0, 0}, {inv_sqrt2, 0}};
+        std::vector<cp_t> host(expected.size());
+        sv_1.CopyGpuDataToHost(host.data(), host.size());
+        CHECK(host == Pennylane::approx(expected));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::createStreamDevTag",
+                   "[StateVectorCudaManaged_Nonparam]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 2;
+    auto &context = DeviceContext<TestType>::getInstance(0);
+    const auto num_handles = context.getNumHandles();
+
+    const auto inv_sqrt2 = static_cast<TestType>(1 / std::sqrt(2.0));
+    const std::vector<cp_t> expected_bell{
+        {inv_sqrt2, 0}, {0, 0}, {0, 0}, {inv_sqrt2, 0}};
+    const std::vector<cp_t> expected_x{{0, 0}, {0, 0}, {1, 0}, {0, 0}};
+
+    {
+        const auto tag_0 = createStreamDevTag(0);
+        const auto tag_1 = createStreamDevTag(0);
+        CHECK(tag_0.ownsStream());
+        CHECK(tag_0.getStreamID() != tag_1.getStreamID());
+        CHECK_FALSE(DevTag<int>{0, 0}.ownsStream());
+
+        StateVectorCudaManaged<TestType> sv_0{num_qubits, tag_0};
+        StateVectorCudaManaged<TestType> sv_1{num_qubits, tag_1};
+        CHECK(sv_0.getStream() == tag_0.getStreamID());
+        CHECK(sv_0.getCusvHandle() != sv_1.getCusvHandle());
+        CHECK(context.getNumHandles() == num_handles + 2);
+
+        sv_0.applyOperation("Hadamard", {0}, false);
+        sv_1.applyOperation("PauliX", {0}, false);
+        sv_0.applyOperation("CNOT", {0, 1}, false);
+
+        std::vector<cp_t> host(expected_bell.size());
+        sv_0.CopyGpuDataToHost(host.data(), host.size());
+        CHECK(host == Pennylane::approx(expected_bell));
+        sv_1.CopyGpuDataToHost(host.data(), host.size());
+        CHECK(host == Pennylane::approx(expected_x));
+
+        // Copies across the owned streams are ordered with both
+        StateVectorCudaManaged<TestType> sv_copy{num_qubits, tag_1};
+        sv_copy.CopyGpuDataToGpuIn(sv_0);
+        sv_copy.CopyGpuDataToHost(host.data(), host.size());
+        CHECK(host == Pennylane::approx(expected_bell));
+    }
+    // The streams, and the handles bound to them, are released with the tags
+    CHECK(context.getNumHandles() == num_handles);
+}
@@ -3,12 +3,14 @@
 #include <complex>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <catch2/catch.hpp>
 
+#include "StateVectorCudaBatched.hpp"
 #include "StateVectorCudaManaged.hpp"
 #include "StateVectorRawCPU.hpp"
 #include "cuGateCache.hpp"
@@ -1330,3 +1332,600 @@ TEMPLATE_TEST_CASE("Sample", "[LightningGPU_Param]", float, double) {
     REQUIRE_THAT(probabilities,
                  Catch::Approx(expected_probabilities).margin(.05));
 }
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::applyOperation gate fusion",
+                   "[LightningGPU_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 4;
+
+    const std::vector<std::string> ops{"Hadamard", "RX",   "CNOT", "RY",
+                                       "CRY",      "Rot",  "SWAP", "PauliX",
+                                       "Toffoli",  "CRot", "RZ",   "CZ"};
+    const std::vector<std::vector<size_t>> wires{
+        {0}, {1}, {0, 1}, {2}, {1, 2}, {3}, {3, 0}, {2}, {0, 1, 3}, {2, 3},
+        {1}, {0, 2}};
+    const std::vector<bool> adjoints{false, false, false, true,
+                                     false, true,  false, false,
+                                     false, false, true,  false};
+    const std::vector<std::vector<TestType>> params{
+        {},    {0.3}, {}, {0.5}, {0.7}, {0.1, 0.2, 0.3}, {},
+        {},    {},    {0.4, 0.5, 0.6}, {0.8}, {}};
+
+    StateVectorCudaManaged<TestType> sv_ref{num_qubits};
+    sv_ref.initSV();
+    sv_ref.applyOperation(ops, wires, adjoints, params);
+    std::vector<cp_t> expected(Pennylane::Util::exp2(num_qubits));
+    sv_ref.CopyGpuDataToHost(expected.data(), expected.size());
+
+    for (size_t max_width : {2, 3, 4}) {
+        DYNAMIC_SECTION("Fusion width " << max_width) {
+            StateVectorCudaManaged<TestType> sv{num_qubits};
+            sv.initSV();
+            sv.setFusionMaxWidth(max_width);
+            CHECK(sv.getFusionMaxWidth() == max_width);
+            sv.applyOperation(ops, wires, adjoints, params);
+
+            std::vector<cp_t> result(expected.size());
+            sv.CopyGpuDataToHost(result.data(), result.size());
+            CHECK(result == Pennylane::approx(expected).margin(1e-5));
+        }
+    }
+    SECTION("Fused groups cover the circuit in order") {
+        const auto fused =
+            fuseOperations<TestType>(ops, wires, adjoints, params, 2);
+        size_t next_op = 0;
+        for (const auto &gate : fused) {
+            CHECK(gate.first_op == next_op);
+            CHECK(gate.wires.size() <= 3);
+            next_op += gate.num_ops;
+        }
+        CHECK(next_op == ops.size());
+        CHECK(fused.size() < ops.size());
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::applyOperation fused excitation",
+                   "[LightningGPU_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 4;
+    const TestType angle = 0.7;
+
+    auto prepare = [&](StateVectorCudaManaged<TestType> &sv) {
+        sv.initSV();
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            sv.applyOperation("Hadamard", {wire}, false);
+            sv.applyOperation("RY", {wire}, false,
+                              {static_cast<TestType>(0.2 * (wire + 1))});
+        }
+    };
+
+    for (const std::string name : {"SingleExcitation", "DoubleExcitation"}) {
+        const bool single = (name == "SingleExcitation");
+        const std::vector<size_t> wires = single
+                                              ? std::vector<size_t>{3, 1}
+                                              : std::vector<size_t>{2, 0, 3, 1};
+        for (bool adjoint : {false, true}) {
+            DYNAMIC_SECTION(name << (adjoint ? " adjoint" : "")) {
+                // An RY on the first wire fuses with the excitation gate
+                StateVectorCudaManaged<TestType> sv_ref{num_qubits};
+                prepare(sv_ref);
+                sv_ref.applyOperation("RY", {wires[0]}, false, {0.3});
+                if (single) {
+                    sv_ref.applySingleExcitation(wires, adjoint, angle);
+                } else {
+                    sv_ref.applyDoubleExcitation(wires, adjoint, angle);
+                }
+                std::vector<cp_t> expected(Pennylane::Util::exp2(num_qubits));
+                sv_ref.CopyGpuDataToHost(expected.data(), expected.size());
+
+                StateVectorCudaManaged<TestType> sv{num_qubits};
+                prepare(sv);
+                sv.setFusionMaxWidth(wires.size());
+                sv.applyOperation({"RY", name}, {{wires[0]}, wires},
+                                  {false, adjoint}, {{0.3}, {angle}});
+                std::vector<cp_t> result(expected.size());
+                sv.CopyGpuDataToHost(result.data(), result.size());
+                CHECK(result == Pennylane::approx(expected).margin(1e-5));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::applyCompiledOperations",
+                   "[LightningGPU_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 4;
+
+    const std::vector<std::string> ops{
+        "Hadamard", "PauliY",      "S",       "CNOT",    "RX",
+        "CRY",      "Rot",         "CRot",    "T",       "PhaseShift",
+        "CZ",       "IsingXX",     "IsingZZ", "MultiRZ", "SWAP",
+        "CSWAP",    "Toffoli",     "CRX",     "Identity",
+        "SingleExcitation",        "ControlledPhaseShift"};
+    const std::vector<std::vector<size_t>> wires{
+        {0},    {1},    {2},       {0, 3},    {1},    {3, 2}, {0},
+        {1, 2}, {3},    {2},       {1, 0},    {0, 2}, {1, 3}, {0, 1, 3},
+        {3, 1}, {2, 0, 3}, {3, 1, 0}, {2, 1}, {0},    {1, 3}, {0, 2}};
+    const std::vector<bool> adjoints{false, true,  true,  false, false, true,
+                                     true,  false, true,  false, false, true,
+                                     false, true,  false, false, false, true,
+                                     false, true,  false};
+    const std::vector<std::vector<TestType>> params{
+        {},    {},    {},    {},    {0.3}, {0.5}, {0.1, 0.2, 0.3},
+        {0.4, 0.5, 0.6}, {}, {0.7}, {},    {0.8}, {0.9}, {1.1},
+        {},    {},    {},    {0.2}, {},    {1.3}, {-0.4}};
+
+    StateVectorCudaManaged<TestType> sv_ref{num_qubits};
+    sv_ref.initSV();
+    for (size_t op_idx = 0; op_idx < ops.size(); op_idx++) {
+        sv_ref.applyOperation(ops[op_idx], wires[op_idx], adjoints[op_idx],
+                              params[op_idx]);
+    }
+    std::vector<cp_t> expected(Pennylane::Util::exp2(num_qubits));
+    sv_ref.CopyGpuDataToHost(expected.data(), expected.size());
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    const auto compiled =
+        sv.compileOperations(ops, wires, adjoints, params);
+    REQUIRE(compiled.getNumOps() == ops.size());
+    CHECK(compiled.getOp(0).gate == GateOp::Hadamard);
+    CHECK(compiled.getOp(19).gate == GateOp::Matrix);
+
+    SECTION("Replay matches named gate application") {
+        sv.applyCompiledOperations(compiled);
+        std::vector<cp_t> result(expected.size());
+        sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(expected).margin(1e-5));
+    }
+    SECTION("Single operations match named gate application") {
+        for (size_t op_idx = 0; op_idx < ops.size(); op_idx++) {
+            sv.applyCompiledOperation(compiled, op_idx);
+        }
+        std::vector<cp_t> result(expected.size());
+        sv.CopyGpuDataToHost(result.data(), result.size());
+        CHECK(result == Pennylane::approx(expected).margin(1e-5));
+    }
+    SECTION("Adjoint replay reverts the state") {
+        sv_ref.applyCompiledOperations(compiled, true);
+        std::vector<cp_t> result(expected.size());
+        sv_ref.CopyGpuDataToHost(result.data(), result.size());
+        std::vector<cp_t> init_state(expected.size(), {0, 0});
+        init_state[0] = {1, 0};
+        CHECK(result == Pennylane::approx(init_state).margin(1e-5));
+    }
+    SECTION("Unsupported operations throw when applied") {
+        const auto unknown =
+            sv.compileOperations({"BasisState"}, {{0}}, {false}, {{}});
+        REQUIRE_FALSE(unknown.getOp(0).supported);
+        REQUIRE_THROWS_AS(sv.applyCompiledOperations(unknown),
+                          LightningException);
+    }
+    SECTION("Mismatched state-vectors are rejected") {
+        StateVectorCudaManaged<TestType> sv_small{num_qubits - 1};
+        REQUIRE_THROWS(sv_small.applyCompiledOperations(compiled));
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::applyCompiledOperations graphs",
+                   "[LightningGPU_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 3;
+    const std::vector<std::string> ops{"Hadamard", "RX", "CNOT", "PhaseShift",
+                                       "CRY"};
+    const std::vector<std::vector<size_t>> wires{{0}, {1}, {0, 2}, {2},
+                                                 {1, 0}};
+    const std::vector<bool> adjoints{false, false, false, true, false};
+    const std::vector<std::vector<TestType>> params{
+        {}, {0.3}, {}, {0.7}, {0.5}};
+
+    auto reference = [&](const std::vector<std::vector<TestType>> &p,
+                         size_t num_reps) {
+        StateVectorCudaManaged<TestType> sv_ref{num_qubits};
+        sv_ref.initSV();
+        for (size_t rep = 0; rep < num_reps; rep++) {
+            sv_ref.applyOperation(ops, wires, adjoints, p);
+        }
+        std::vector<cp_t> expected(Pennylane::Util::exp2(num_qubits));
+        sv_ref.CopyGpuDataToHost(expected.data(), expected.size());
+        return expected;
+    };
+    auto result = [](const StateVectorCudaManaged<TestType> &sv) {
+        std::vector<cp_t> data(sv.getLength());
+        sv.CopyGpuDataToHost(data.data(), data.size());
+        return data;
+    };
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    sv.setUseGraphs(true);
+    auto compiled = sv.compileOperations(ops, wires, adjoints, params);
+
+    SECTION("Replays launch the captured graph") {
+        sv.applyCompiledOperations(compiled);
+        sv.applyCompiledOperations(compiled);
+        CHECK(result(sv) == Pennylane::approx(reference(params, 2))
+                                .margin(1e-5));
+        if (sv.getUseGraphs()) {
+            CHECK(sv.getNumGraphCaptures() == 1);
+            CHECK(sv.getNumGraphLaunches() == 2);
+        }
+    }
+    SECTION("Angle updates recapture the graph") {
+        sv.applyCompiledOperations(compiled);
+        const auto revision = compiled.getRevision();
+        const std::vector<std::vector<TestType>> new_params{
+            {}, {1.1}, {}, {0.7}, {-0.2}};
+        compiled.updateParameters(new_params);
+        CHECK(compiled.getRevision() == revision + 1);
+
+        sv.initSV();
+        sv.applyCompiledOperations(compiled);
+        CHECK(result(sv) == Pennylane::approx(reference(new_params, 1))
+                                .margin(1e-5));
+        if (sv.getUseGraphs()) {
+            CHECK(sv.getNumGraphCaptures() == 2);
+        }
+    }
+    SECTION("Matrix updates reuse the captured graph") {
+        sv.applyCompiledOperations(compiled);
+        const auto revision = compiled.getRevision();
+        // Only the PhaseShift angle changes, and it is lowered to a matrix
+        const std::vector<std::vector<TestType>> new_params{
+            {}, {0.3}, {}, {-1.2}, {0.5}};
+        compiled.updateParameters(new_params);
+        CHECK(compiled.getRevision() == revision);
+
+        sv.initSV();
+        sv.applyCompiledOperations(compiled);
+        CHECK(result(sv) == Pennylane::approx(reference(new_params, 1))
+                                .margin(1e-5));
+        if (sv.getUseGraphs()) {
+            CHECK(sv.getNumGraphCaptures() == 1);
+        }
+    }
+    SECTION("Updates must keep the structure") {
+        REQUIRE_THROWS_AS(compiled.updateParameters({{}, {0.1}}),
+                          LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::applyOperation excitation gates",
+                   "[LightningGPU_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    using CFP_t = typename StateVectorCudaManaged<TestType>::CFP_t;
+    using MatrixFunc = std::vector<CFP_t> (*)(TestType);
+    const size_t num_qubits = 4;
+    const TestType angle = 0.7;
+
+    const std::vector<std::pair<std::string, MatrixFunc>> gates{
+        {"SingleExcitation", &cuGates::getSingleExcitation<CFP_t, TestType>},
+        {"SingleExcitationMinus",
+         &cuGates::getSingleExcitationMinus<CFP_t, TestType>},
+        {"SingleExcitationPlus",
+         &cuGates::getSingleExcitationPlus<CFP_t, TestType>},
+        {"DoubleExcitation", &cuGates::getDoubleExcitation<CFP_t, TestType>},
+        {"DoubleExcitationMinus",
+         &cuGates::getDoubleExcitationMinus<CFP_t, TestType>},
+        {"DoubleExcitationPlus",
+         &cuGates::getDoubleExcitationPlus<CFP_t, TestType>}};
+
+    auto prepare = [&](StateVectorCudaManaged<TestType> &sv) {
+        sv.initSV();
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            sv.applyOperation("Hadamard", {wire}, false);
+            sv.applyOperation("RY", {wire}, false,
+                              {static_cast<TestType>(0.2 * (wire + 1))});
+        }
+    };
+
+    for (const auto &[name, matrix_func] : gates) {
+        const std::vector<size_t> wires =
+            (name.rfind("Single", 0) == 0) ? std::vector<size_t>{3, 1}
+                                           : std::vector<size_t>{2, 0, 3, 1};
+        for (bool adjoint : {false, true}) {
+            DYNAMIC_SECTION(name << (adjoint ? " adjoint" : "")) {
+                StateVectorCudaManaged<TestType> sv_ref{num_qubits};
+                prepare(sv_ref);
+                // Matrices passed by name are applied with the first wire
+                // as the most significant bit, so reverse the wires to apply
+                // the cuGates matrix as the explicit gate calls do
+                sv_ref.applyOperation("Reference",
+                                      {wires.rbegin(), wires.rend()}, adjoint,
+                                      {0.0}, matrix_func(angle));
+                std::vector<cp_t> expected(Pennylane::Util::exp2(num_qubits));
+                sv_ref.CopyGpuDataToHost(expected.data(), expected.size());
+
+                StateVectorCudaManaged<TestType> sv{num_qubits};
+                prepare(sv);
+                sv.applyOperation(name, wires, adjoint, {angle});
+                std::vector<cp_t> result(expected.size());
+                sv.CopyGpuDataToHost(result.data(), result.size());
+                CHECK(result == Pennylane::approx(expected).margin(1e-5));
+
+                // Fused and compiled gates use the same layout
+                StateVectorCudaManaged<TestType> sv_fused{num_qubits};
+                prepare(sv_fused);
+                sv_fused.applyOperation(
+                    "Fused", wires, adjoint, {0.0},
+                    getGateMatrixCu<TestType>(name, {angle}));
+                sv_fused.CopyGpuDataToHost(result.data(), result.size());
+                CHECK(result == Pennylane::approx(expected).margin(1e-5));
+            }
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::generate_samples_device",
+                   "[LightningGPU_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    // Large enough to split the distribution over several chunks
+    const size_t num_qubits = 12;
+    const size_t length = Pennylane::Util::exp2(num_qubits);
+    const size_t num_samples = 100000;
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    for (size_t wire = 0; wire < num_qubits; wire++) {
+        sv.applyOperation("RY", {wire}, false,
+                          {static_cast<TestType>(0.1 + 0.25 * wire)});
+    }
+    sv.applyOperation("CNOT", {0, num_qubits - 1}, false);
+    std::vector<cp_t> state(length);
+    sv.CopyGpuDataToHost(state.data(), state.size());
+
+    // Marginal probability of each wire being in |1>
+    std::vector<double> expected(num_qubits, 0.0);
+    for (size_t idx = 0; idx < length; idx++) {
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            if ((idx >> (num_qubits - 1 - wire)) & 1U) {
+                expected[wire] += std::norm(state[idx]);
+            }
+        }
+    }
+
+    SECTION("Packed samples follow the state probabilities") {
+        sv.setSeed(1234);
+        const auto samples = sv.generate_samples_packed(num_samples);
+        REQUIRE(samples.size() == num_samples);
+        std::vector<double> marginals(num_qubits, 0.0);
+        for (const auto sample : samples) {
+            REQUIRE(sample < length);
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                if ((sample >> (num_qubits - 1 - wire)) & 1U) {
+                    marginals[wire] += 1.0 / num_samples;
+                }
+            }
+        }
+        CHECK(marginals == Pennylane::approx(expected).margin(2e-2));
+    }
+    SECTION("Unpacked bits and counts match the packed samples") {
+        sv.setSeed(42);
+        const auto packed = sv.generate_samples_packed(num_samples);
+        sv.setSeed(42);
+        const auto bits = sv.generate_samples_bits(num_samples);
+        sv.setSeed(42);
+        const auto [indices, counts] = sv.generate_counts(num_samples);
+
+        REQUIRE(bits.size() == num_samples * num_qubits);
+        for (size_t sample = 0; sample < num_samples; sample++) {
+            uint64_t index = 0;
+            for (size_t wire = 0; wire < num_qubits; wire++) {
+                index = (index << 1U) | bits[sample * num_qubits + wire];
+            }
+            REQUIRE(index == packed[sample]);
+        }
+
+        std::map<uint64_t, uint64_t> histogram;
+        for (const auto sample : packed) {
+            histogram[sample]++;
+        }
+        REQUIRE(indices.size() == histogram.size());
+        REQUIRE(counts.size() == histogram.size());
+        size_t pos = 0;
+        for (const auto &[index, count] : histogram) {
+            CHECK(indices[pos] == index);
+            CHECK(counts[pos] == count);
+            pos++;
+        }
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::generate_samples sampler reuse",
+                   "[LightningGPU_Param]", float, double) {
+    const size_t num_qubits = 3;
+    const size_t num_samples = 100;
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    const auto initial_version = sv.getDataVersion();
+
+    SECTION("Sampling an unchanged state preprocesses once") {
+        sv.generate_samples(num_samples);
+        sv.generate_samples(num_samples);
+        sv.generate_samples(num_samples / 2);
+        CHECK(sv.getSamplerPreprocessCount() == 1);
+    }
+    SECTION("Applying a gate invalidates the sampler") {
+        auto samples = sv.generate_samples(num_samples);
+        CHECK(std::all_of(samples.begin(), samples.end(),
+                          [](size_t bit) { return bit == 0; }));
+
+        for (size_t wire = 0; wire < num_qubits; wire++) {
+            sv.applyOperation("PauliX", {wire}, false);
+        }
+        CHECK(sv.getDataVersion() > initial_version);
+
+        samples = sv.generate_samples(num_samples);
+        CHECK(sv.getSamplerPreprocessCount() == 2);
+        CHECK(std::all_of(samples.begin(), samples.end(),
+                          [](size_t bit) { return bit == 1; }));
+    }
+    SECTION("Requesting more shots recreates the sampler") {
+        sv.generate_samples(num_samples);
+        const auto samples = sv.generate_samples(2 * num_samples);
+        CHECK(samples.size() == 2 * num_samples * num_qubits);
+        CHECK(sv.getSamplerPreprocessCount() == 2);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaBatched", "[LightningGPU_Param]", float,
+                   double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 3;
+    const size_t batch_size = 3;
+
+    const std::vector<std::string> ops{"Hadamard", "RX",      "CNOT",
+                                       "Rot",      "IsingXX", "CRZ"};
+    const std::vector<std::vector<size_t>> wires{{0},    {1},    {0, 2},
+                                                 {2},    {0, 1}, {2, 1}};
+    const std::vector<bool> adjoints{false, false, false, true, true, false};
+    // Parameters of each gate for each state-vector of the batch
+    const std::vector<std::vector<std::vector<TestType>>> params{
+        {},
+        {{0.1}, {0.5}, {-1.2}},
+        {},
+        {{0.1, 0.2, 0.3}, {0.4, 0.5, 0.6}, {0.7, -0.8, 0.9}},
+        {{0.3}, {1.4}, {-0.6}},
+        {{0.2}, {0.9}, {2.1}}};
+
+    std::vector<std::vector<cp_t>> expected(
+        batch_size, std::vector<cp_t>(Pennylane::Util::exp2(num_qubits)));
+    for (size_t b = 0; b < batch_size; b++) {
+        StateVectorCudaManaged<TestType> sv_ref{num_qubits};
+        sv_ref.initSV();
+        for (size_t op_idx = 0; op_idx < ops.size(); op_idx++) {
+            sv_ref.applyOperation(ops[op_idx], wires[op_idx], adjoints[op_idx],
+                                  params[op_idx].empty()
+                                      ? std::vector<TestType>{}
+                                      : params[op_idx][b]);
+        }
+        sv_ref.CopyGpuDataToHost(expected[b].data(), expected[b].size());
+    }
+
+    StateVectorCudaBatched<TestType> batched{num_qubits, batch_size};
+    batched.applyOperations(ops, wires, adjoints, params);
+
+    SECTION("Each state-vector matches its own parameters") {
+        std::vector<cp_t> result(batched.getLength());
+        for (size_t b = 0; b < batch_size; b++) {
+            batched.CopyGpuDataToHost(b, result.data(), result.size());
+            CHECK(result == Pennylane::approx(expected[b]).margin(1e-5));
+        }
+    }
+    SECTION("Expectation values are computed per state-vector") {
+        const std::vector<cp_t> hermitian{{1, 0}, {0.5, 1}, {0.5, -1}, {-2, 0}};
+        const auto z1 = batched.expval({"PauliZ"}, {{1}});
+        const auto z0_h2 =
+            batched.expval({"PauliZ", "Hermitian"}, {{0}, {2}},
+                           {std::vector<cp_t>{}, hermitian});
+        REQUIRE(z1.size() == batch_size);
+        REQUIRE(z0_h2.size() == batch_size);
+
+        for (size_t b = 0; b < batch_size; b++) {
+            const auto &state = expected[b];
+            TestType expected_z1 = 0;
+            TestType expected_z0_h2 = 0;
+            for (size_t i = 0; i < state.size(); i++) {
+                // Wire w is bit num_qubits - 1 - w of the index
+                const TestType z0 = ((i >> 2U) & 1U) ? -1 : 1;
+                const TestType z1_sign = ((i >> 1U) & 1U) ? -1 : 1;
+                expected_z1 += z1_sign * std::norm(state[i]);
+                const size_t row = i & 1U;
+                for (size_t col = 0; col < 2; col++) {
+                    const size_t j = (i & ~size_t{1}) | col;
+                    expected_z0_h2 +=
+                        z0 * std::real(std::conj(state[i]) *
+                                       hermitian[row * 2 + col] * state[j]);
+                }
+            }
+            CHECK(z1[b] == Approx(expected_z1).margin(1e-5));
+            CHECK(z0_h2[b] == Approx(expected_z0_h2).margin(1e-5));
+        }
+    }
+    SECTION("Re-initialization resets every state-vector") {
+        batched.initSV();
+        for (const auto z0 : batched.expval({"PauliZ"}, {{0}})) {
+            CHECK(z0 == Approx(1).margin(1e-7));
+        }
+    }
+    SECTION("Invalid parameter batches are rejected") {
+        REQUIRE_THROWS_AS(
+            batched.applyOperation("RX", {0}, false, {{0.1}, {0.2}}),
+            LightningException);
+        REQUIRE_THROWS_AS(batched.applyOperation("MultiRZ", {0}, false,
+                                                 {{0.1}, {0.2}, {0.3}}),
+                          LightningException);
+    }
+    SECTION("Batch sizes are bounded by the device") {
+        using BatchedT = StateVectorCudaBatched<TestType>;
+        const auto max_batch_size = BatchedT::getMaxBatchSize(num_qubits);
+        CHECK(max_batch_size >= batch_size);
+        CHECK(max_batch_size <= BatchedT::max_batch_size);
+        REQUIRE_THROWS_AS(BatchedT(num_qubits, BatchedT::max_batch_size + 1),
+                          LightningException);
+    }
+}
+
+TEMPLATE_TEST_CASE("StateVectorCudaManaged::applyDiagonalGenerator",
+                   "[LightningGPU_Param]", float, double) {
+    using cp_t = std::complex<TestType>;
+    const size_t num_qubits = 4;
+    const size_t dim = Pennylane::Util::exp2(num_qubits);
+
+    StateVectorCudaManaged<TestType> sv{num_qubits};
+    sv.initSV();
+    sv.applyOperation({"Hadamard", "RX", "Hadamard", "RY", "CNOT", "Hadamard"},
+                      {{0}, {1}, {2}, {3}, {2, 1}, {3}},
+                      {false, false, false, false, false, false},
+                      {{}, {0.3}, {}, {-0.7}, {}, {}});
+    std::vector<cp_t> init_state(dim);
+    sv.CopyGpuDataToHost(init_state.data(), dim);
+
+    // Reference: amplitude i scaled by its diagonal entry, where wire w is bit
+    // num_qubits - 1 - w of i
+    auto expectedOf = [&](const std::vector<size_t> &z_wires,
+                          const std::vector<size_t> &projector_wires) {
+        std::vector<cp_t> expected(init_state);
+        for (size_t i = 0; i < dim; i++) {
+            for (const auto w : z_wires) {
+                if ((i >> (num_qubits - 1 - w)) & 1U) {
+                    expected[i] = -expected[i];
+                }
+            }
+            for (const auto w : projector_wires) {
+                if (((i >> (num_qubits - 1 - w)) & 1U) == 0) {
+                    expected[i] = 0;
+                }
+            }
+        }
+        return expected;
+    };
+    std::vector<cp_t> result(dim);
+
+    SECTION("MultiRZ") {
+        sv.applyGeneratorMultiRZ({0, 2, 3}, false);
+        sv.CopyGpuDataToHost(result.data(), dim);
+        CHECK(result == Pennylane::approx(expectedOf({0, 2, 3}, {})));
+    }
+    SECTION("IsingZZ") {
+        sv.applyGeneratorIsingZZ({3, 1}, true);
+        sv.CopyGpuDataToHost(result.data(), dim);
+        CHECK(result == Pennylane::approx(expectedOf({3, 1}, {})));
+    }
+    SECTION("PhaseShift") {
+        sv.applyGeneratorPhaseShift({2}, false);
+        sv.CopyGpuDataToHost(result.data(), dim);
+        CHECK(result == Pennylane::approx(expectedOf({}, {2})));
+    }
+    SECTION("ControlledPhaseShift") {
+        sv.applyGeneratorControlledPhaseShift({0, 3}, false);
+        sv.CopyGpuDataToHost(result.data(), dim);
+        CHECK(result == Pennylane::approx(expectedOf({}, {0, 3})));
+    }
+    SECTION("Pauli-Z string with projector") {
+        sv.applyDiagonalGenerator({1}, {0, 2});
+        sv.CopyGpuDataToHost(result.data(), dim);
+        CHECK(result == Pennylane::approx(expectedOf({1}, {0, 2})));
+    }
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <cstddef>
+
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Executable CUDA graph built by stream capture, replacing a sequence
+ * of kernel launches by a single graph launch.
+ *
+ * Recapturing work with the same topology, e.g. the same kernels with other
+ * arguments, updates the executable graph in place with
+ * `cudaGraphExecUpdate`, which is much cheaper than instantiating a new one.
+ */
+class CudaGraph {
+  public:
+    CudaGraph() = default;
+    CudaGraph(const CudaGraph &) = delete;
+    CudaGraph &operator=(const CudaGraph &) = delete;
+
+    virtual ~CudaGraph() { reset(); }
+
+    /**
+     * @brief Capture the work issued on `stream` by `issue`, and make it the
+     * work performed by `launch`. The captured work is not executed.
+     *
+     * @param stream Stream to capture. Must not be the legacy default stream.
+     * @param issue Callable issuing the work on `stream`, without
+     * synchronizing or allocating device memory.
+     */
+    template <class IssueFunc>
+    void capture(cudaStream_t stream, IssueFunc &&issue) {
+        cudaGraph_t graph = nullptr;
+        PL_CUDA_IS_SUCCESS(cudaStreamBeginCapture(
+            stream, cudaStreamCaptureModeThreadLocal));
+        try {
+            issue();
+        } catch (...) {
+            // End the capture so the stream can be used again
+            static_cast<void>(cudaStreamEndCapture(stream, &graph));
+            if (graph != nullptr) {
+                cudaGraphDestroy(graph);
+            }
+            throw;
+        }
+        PL_CUDA_IS_SUCCESS(cudaStreamEndCapture(stream, &graph));
+
+        if (exec_ != nullptr && tryUpdate(graph)) {
+            num_updates_++;
+            PL_CUDA_IS_SUCCESS(cudaGraphDestroy(graph));
+            return;
+        }
+        reset();
+        const auto status = cudaGraphInstantiateWithFlags(&exec_, graph, 0);
+        PL_CUDA_IS_SUCCESS(cudaGraphDestroy(graph));
+        PL_CUDA_IS_SUCCESS(status);
+        num_instantiations_++;
+    }
+
+    /**
+     * @brief Launch the captured work on `stream`.
+     */
+    void launch(cudaStream_t stream) {
+        PL_ABORT_IF(exec_ == nullptr, "No work was captured in the graph.");
+        PL_CUDA_IS_SUCCESS(cudaGraphLaunch(exec_, stream));
+    }
+
+    /**
+     * @brief Destroy the executable graph.
+     */
+    void reset() {
+        if (exec_ != nullptr) {
+            cudaGraphExecDestroy(exec_);
+            exec_ = nullptr;
+        }
+    }
+
+    [[nodiscard]] auto isInstantiated() const -> bool {
+        return exec_ != nullptr;
+    }
+
+    /**
+     * @brief Number of executable graphs instantiated by `capture`.
+     */
+    [[nodiscard]] auto getNumInstantiations() const -> std::size_t {
+        return num_instantiations_;
+    }
+
+    /**
+     * @brief Number of captures applied as in-place updates.
+     */
+    [[nodiscard]] auto getNumUpdates() const -> std::size_t {
+        return num_updates_;
+    }
+
+  private:
+    cudaGraphExec_t exec_{nullptr};
+    std::size_t num_instantiations_{0};
+    std::size_t num_updates_{0};
+
+    /**
+     * @brief Update the executable graph from `graph`.
+     *
+     * @return false if the topologies differ.
+     */
+    auto tryUpdate(cudaGraph_t graph) -> bool {
+#if CUDART_VERSION >= 12000
+        cudaGraphExecUpdateResultInfo result_info{};
+        const auto status = cudaGraphExecUpdate(exec_, graph, &result_info);
+#else
+        cudaGraphNode_t error_node = nullptr;
+        cudaGraphExecUpdateResult result{};
+        const auto status =
+            cudaGraphExecUpdate(exec_, graph, &error_node, &result);
+#endif
+        if (status != cudaSuccess) {
+            // Clear the non-sticky update error
+            static_cast<void>(cudaGetLastError());
+            return false;
+        }
+        return true;
+    }
+};
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,75 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file DLPack.hpp
+ * Layout-compatible definitions of the DLPack (v0.6) tensor structures, used
+ * to export device data to other frameworks without a copy.
+ */
+#pragma once
+
+#include <cstdint>
+
+namespace Pennylane::CUDA::DLPack {
+
+/// Device type codes, matching `DLDeviceType`.
+enum DLDeviceType : int32_t {
+    kDLCPU = 1,
+    kDLCUDA = 2,
+};
+
+/// Data type codes, matching `DLDataTypeCode`.
+enum DLDataTypeCode : uint8_t {
+    kDLInt = 0,
+    kDLUInt = 1,
+    kDLFloat = 2,
+    kDLComplex = 5,
+};
+
+struct DLDevice {
+    int32_t device_type;
+    int32_t device_id;
+};
+
+struct DLDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+struct DLTensor {
+    void *data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t *shape;
+    int64_t *strides;
+    uint64_t byte_offset;
+};
+
+/**
+ * @brief Tensor with the context of its producer. The consumer calls
+ * `deleter` once it no longer uses the data.
+ */
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void *manager_ctx;
+    void (*deleter)(DLManagedTensor *self);
+};
+
+/// Name of an unconsumed DLPack capsule.
+constexpr const char *capsule_name = "dltensor";
+/// Name a consumer gives to the capsules it takes ownership of.
+constexpr const char *used_capsule_name = "used_dltensor";
+
+} // namespace Pennylane::CUDA::DLPack
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "DevTag.hpp"
+#include "DeviceMemoryPool.hpp"
+#include "NvtxRange.hpp"
 #include "cuda.h"
 #include "cuda_helpers.hpp"
 
@@ -34,9 +36,7 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
                                                                nullptr} {
         if (alloc_memory && (length > 0)) {
             dev_tag_.refresh();
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                           sizeof(GPUDataT) * length));
+            allocateBuffer();
         }
     }
 
@@ -45,9 +45,7 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
         : length_{length}, dev_tag_{dev}, gpu_buffer_{nullptr} {
         if (alloc_memory && (length > 0)) {
             dev_tag_.refresh();
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                           sizeof(GPUDataT) * length));
+            allocateBuffer();
         }
     }
 
@@ -56,12 +54,23 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
         : length_{length}, dev_tag_{std::move(dev)}, gpu_buffer_{nullptr} {
         if (alloc_memory && (length > 0)) {
             dev_tag_.refresh();
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                           sizeof(GPUDataT) * length));
+            allocateBuffer();
         }
     }
 
+    /**
+     * @brief Construct a non-owning DataBuffer over existing device memory.
+     * The memory is not freed on destruction, and must outlive the buffer.
+     *
+     * @param length Number of elements in data buffer.
+     * @param gpu_data Device pointer to at least `length` elements.
+     * @param dev Device tag of the device holding `gpu_data`.
+     */
+    DataBuffer(std::size_t length, GPUDataT *gpu_data,
+               const DevTag<DevTagT> &dev)
+        : length_{length}, dev_tag_{dev}, gpu_buffer_{gpu_data},
+          owns_data_{false} {}
+
     // Buffer should never be default initialized
     DataBuffer() = delete;
 
@@ -70,13 +79,21 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
             int local_dev_id = -1;
             PL_CUDA_IS_SUCCESS(cudaGetDevice(&local_dev_id));
 
+            // Keep the current memory if it already fits the copy
+            const bool reuse = owns_data_ && (gpu_buffer_ != nullptr) &&
+                               (length_ == other.length_) &&
+                               (dev_tag_.getDeviceID() == local_dev_id);
+            if (!reuse) {
+                releaseBuffer();
+            }
             length_ = other.length_;
             dev_tag_ =
                 DevTag<DevTagT>{local_dev_id, other.dev_tag_.getStreamID()};
             dev_tag_.refresh();
-            PL_CUDA_IS_SUCCESS(
-                cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                           sizeof(GPUDataT) * length_));
+            if (!reuse && length_ > 0) {
+                allocateBuffer();
+            }
+            owns_data_ = true;
             CopyGpuDataToGpu(other.gpu_buffer_, other.length_);
         }
         return *this;
@@ -86,22 +103,23 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
         if (this != &other) {
             int local_dev_id = -1;
             PL_CUDA_IS_SUCCESS(cudaGetDevice(&local_dev_id));
+            releaseBuffer();
             length_ = other.length_;
             if (local_dev_id == other.dev_tag_.getDeviceID()) {
                 dev_tag_ = std::move(other.dev_tag_);
                 dev_tag_.refresh();
 
                 gpu_buffer_ = other.gpu_buffer_;
+                owns_data_ = other.owns_data_;
             } else {
                 dev_tag_ =
                     DevTag<DevTagT>{local_dev_id, other.dev_tag_.getStreamID()};
                 dev_tag_.refresh();
 
-                PL_CUDA_IS_SUCCESS(
-                    cudaMalloc(reinterpret_cast<void **>(&gpu_buffer_),
-                               sizeof(GPUDataT) * length_));
+                allocateBuffer();
+                owns_data_ = true;
                 CopyGpuDataToGpu(other.gpu_buffer_, other.length_);
-                PL_CUDA_IS_SUCCESS(cudaFree(other.gpu_buffer_));
+                other.releaseBuffer();
                 other.dev_tag_ = {};
             }
             other.length_ = 0;
@@ -110,16 +128,18 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
         return *this;
     };
 
-    virtual ~DataBuffer() {
-        if (gpu_buffer_ != nullptr) {
-            PL_CUDA_IS_SUCCESS(cudaFree(gpu_buffer_));
-        }
-    };
+    virtual ~DataBuffer() { releaseBuffer(); };
 
     auto getData() -> GPUDataT * { return gpu_buffer_; }
     auto getData() const -> const GPUDataT * { return gpu_buffer_; }
     auto getLength() const { return length_; }
 
+    /**
+     * @brief Indicate whether the buffer frees its device memory on
+     * destruction.
+     */
+    auto ownsData() const -> bool { return owns_data_; }
+
     /**
      * @brief Get the CUDA stream for the given object.
      *
@@ -135,6 +155,17 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
         return dev_tag_;
     }
 
+    /**
+     * @brief Get the shared cuBLAS handle bound to the device and stream of
+     * this buffer, reading scalars from the host.
+     *
+     * @return cublasHandle_t
+     */
+    inline auto getCublasHandle() const -> cublasHandle_t {
+        return Util::CublasHandleRegistry::getInstance().getHandle(
+            getDevice(), getStream());
+    }
+
     /**
      * @brief Copy data from another GPU memory block to here.
      *
@@ -150,9 +181,11 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
                 getData(), gpu_in, sizeof(GPUDataT) * getLength(),
                 cudaMemcpyDeviceToDevice, getStream()));
         } else {
-            PL_CUDA_IS_SUCCESS(cudaMemcpy(getData(), gpu_in,
-                                          sizeof(GPUDataT) * getLength(),
-                                          cudaMemcpyDefault));
+            // Ordered on the buffer stream, which may not synchronize with
+            // the legacy default stream. Device copies do not block the host.
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(getData(), gpu_in,
+                                               sizeof(GPUDataT) * getLength(),
+                                               cudaMemcpyDefault, getStream()));
         }
     }
 
@@ -171,6 +204,7 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
     template <class HostDataT = GPUDataT>
     void CopyHostDataToGpu(const HostDataT *host_in, std::size_t length,
                            bool async = false) {
+        PL_NVTX_RANGE("CopyHostDataToGpu");
         PL_ABORT_IF_NOT(
             (getLength() * sizeof(GPUDataT)) == (length * sizeof(HostDataT)),
             "Sizes do not match for host & GPU data. Please ensure the source "
@@ -180,9 +214,10 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
                 getData(), host_in, sizeof(GPUDataT) * getLength(),
                 cudaMemcpyHostToDevice, getStream()));
         } else {
-            PL_CUDA_IS_SUCCESS(cudaMemcpy(getData(), host_in,
-                                          sizeof(GPUDataT) * getLength(),
-                                          cudaMemcpyDefault));
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(getData(), host_in,
+                                               sizeof(GPUDataT) * getLength(),
+                                               cudaMemcpyDefault, getStream()));
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(getStream()));
         }
     }
 
@@ -193,14 +228,16 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
     template <class HostDataT = GPUDataT>
     inline void CopyGpuDataToHost(HostDataT *host_out, std::size_t length,
                                   bool async = false) const {
+        PL_NVTX_RANGE("CopyGpuDataToHost");
         PL_ABORT_IF_NOT(
             (getLength() * sizeof(GPUDataT)) == (length * sizeof(HostDataT)),
             "Sizes do not match for host & GPU data. Please ensure the source "
             "buffer is not larger than the destination buffer");
         if (!async) {
-            PL_CUDA_IS_SUCCESS(cudaMemcpy(host_out, getData(),
-                                          sizeof(GPUDataT) * getLength(),
-                                          cudaMemcpyDefault));
+            PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(host_out, getData(),
+                                               sizeof(GPUDataT) * getLength(),
+                                               cudaMemcpyDefault, getStream()));
+            PL_CUDA_IS_SUCCESS(cudaStreamSynchronize(getStream()));
         } else {
             PL_CUDA_IS_SUCCESS(cudaMemcpyAsync(
                 host_out, getData(), sizeof(GPUDataT) * getLength(),
@@ -209,9 +246,32 @@ template <class GPUDataT, class DevTagT = int> class DataBuffer {
     }
 
   private:
+    /**
+     * @brief Allocate `length_` elements on the current device, through the
+     * `DeviceMemoryPool`.
+     */
+    void allocateBuffer() {
+        gpu_buffer_ =
+            static_cast<GPUDataT *>(DeviceMemoryPool::getInstance().allocate(
+                sizeof(GPUDataT) * length_, dev_tag_.getDeviceID()));
+        owns_data_ = true;
+    }
+
+    /**
+     * @brief Return the owned memory, if any, to the `DeviceMemoryPool`.
+     */
+    void releaseBuffer() {
+        if (gpu_buffer_ != nullptr && owns_data_) {
+            DeviceMemoryPool::getInstance().deallocate(gpu_buffer_,
+                                                       getStream());
+        }
+        gpu_buffer_ = nullptr;
+    }
+
     std::size_t length_;
     DevTag<DevTagT> dev_tag_;
     GPUDataT *gpu_buffer_;
+    bool owns_data_{true};
 };
 
 } // namespace Pennylane::CUDA
@@ -2,7 +2,9 @@
 
 #include "cuda.h"
 #include "cuda_helpers.hpp"
+#include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace Pennylane::CUDA {
 
@@ -23,12 +25,29 @@ class DevTag {
         : device_id_{device_id}, stream_id_{stream_id} {}
 
     DevTag(const DevTag<IDType> &other)
-        : device_id_{other.getDeviceID()}, stream_id_{other.getStreamID()} {}
+        : device_id_{other.getDeviceID()}, stream_id_{other.getStreamID()},
+          stream_owner_{other.stream_owner_} {}
+
+    /**
+     * @brief Create a device tag sharing the ownership of its stream. Copies
+     * of the tag share `stream_owner`, whose deleter destroys the stream once
+     * the last of them is gone, so buffers and state-vectors holding a copy
+     * never outlive the stream.
+     *
+     * @param device_id CUDA device index.
+     * @param stream_id CUDA stream.
+     * @param stream_owner Owner of `stream_id`.
+     */
+    DevTag(IDType device_id, cudaStream_t stream_id,
+           std::shared_ptr<void> stream_owner)
+        : device_id_{device_id}, stream_id_{stream_id},
+          stream_owner_{std::move(stream_owner)} {}
 
     DevTag &operator=(DevTag<IDType> &&other) {
         if (this != &other) {
             device_id_ = other.device_id_;
             stream_id_ = other.stream_id_;
+            stream_owner_ = other.stream_owner_;
             [[maybe_unused]] auto ref_id = &other.device_id_;
             [[maybe_unused]] auto ref_st = &other.stream_id_;
             ref_id = nullptr;
@@ -49,9 +68,17 @@ class DevTag {
 
     inline void refresh() { PL_CUDA_IS_SUCCESS(cudaSetDevice(device_id_)); }
 
+    /**
+     * @brief Indicate whether the stream is owned by this tag and its copies.
+     */
+    [[nodiscard]] auto ownsStream() const -> bool {
+        return stream_owner_ != nullptr;
+    }
+
   private:
     IDType device_id_;
     cudaStream_t stream_id_;
+    std::shared_ptr<void> stream_owner_{nullptr};
 };
 
 template <class T>
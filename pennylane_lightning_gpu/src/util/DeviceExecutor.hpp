@@ -0,0 +1,250 @@
+#pragma once
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "DevicePool.hpp"
+#include "TSQueue.hpp"
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Long-lived executor with one persistent worker thread per GPU.
+ *
+ * Each worker owns a task queue and is bound to its device for its whole
+ * lifetime. Tasks of a batch are spread round-robin over the queues; a worker
+ * whose queue runs dry steals from the queues of the other devices, keeping
+ * all GPUs busy when task costs are uneven. Batches may also be restricted to
+ * a subset of the devices, for tasks that need data resident on them.
+ */
+class DeviceExecutor {
+  public:
+    /**
+     * @brief Task type. Receives the index of the device it runs on, which is
+     * also the current device of the calling thread.
+     */
+    using Task = std::function<void(int)>;
+
+    DeviceExecutor(const DeviceExecutor &) = delete;
+    DeviceExecutor &operator=(const DeviceExecutor &) = delete;
+
+    /**
+     * @brief Get the process-wide executor, starting its workers on first
+     * use.
+     */
+    static auto getInstance() -> DeviceExecutor & {
+        static DeviceExecutor executor;
+        return executor;
+    }
+
+    /**
+     * @brief Number of devices, and so of worker threads, of the executor.
+     */
+    [[nodiscard]] auto getNumDevices() const -> std::size_t {
+        return queues_.size();
+    }
+
+    /**
+     * @brief Run a batch of tasks over all devices, blocking until all of them
+     * have completed. The first exception raised by a task is rethrown once
+     * the whole batch has finished.
+     *
+     * @param tasks Tasks to run. The order of execution is unspecified.
+     */
+    void run(std::vector<Task> tasks) {
+        if (tasks.empty()) {
+            return;
+        }
+        PL_ABORT_IF(queues_.empty(), "No CUDA devices available.");
+
+        auto batch = std::make_shared<Batch>();
+        batch->remaining = tasks.size();
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            pending_ += static_cast<long long>(tasks.size());
+        }
+        for (std::size_t i = 0; i < tasks.size(); i++) {
+            queues_[i % queues_.size()]->push({std::move(tasks[i]), batch});
+        }
+        cond_.notify_all();
+
+        wait(*batch);
+    }
+
+    /**
+     * @brief Run a batch of tasks over the given devices only, blocking until
+     * all of them have completed. The workers of these devices share the
+     * tasks of the batch, and no other worker runs them. The first exception
+     * raised by a task is rethrown once the whole batch has finished.
+     *
+     * @param tasks Tasks to run. The order of execution is unspecified.
+     * @param devices Distinct indices of the devices running the tasks.
+     * @param on_device_done Optional callback run by the worker of each device
+     * once no task of the batch is left for it, e.g. to release the data the
+     * tasks needed on that device.
+     */
+    void run(std::vector<Task> tasks, const std::vector<int> &devices,
+             const Task &on_device_done = {}) {
+        if (tasks.empty()) {
+            return;
+        }
+        PL_ABORT_IF(devices.empty(), "No devices given to run the tasks.");
+        for (const auto device_id : devices) {
+            PL_ABORT_IF(device_id < 0 ||
+                            static_cast<std::size_t>(device_id) >=
+                                pinned_.size(),
+                        "Invalid device index.");
+        }
+
+        auto tasks_left = std::make_shared<TSQueue<Task>>();
+        for (auto &task : tasks) {
+            tasks_left->push(std::move(task));
+        }
+        auto batch = std::make_shared<Batch>();
+        batch->remaining = devices.size();
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            pending_ += static_cast<long long>(devices.size());
+        }
+        // Each device drains the shared queue of the batch, so tasks are
+        // still balanced between the given devices
+        for (const auto device_id : devices) {
+            pinned_[device_id]->push(
+                {[tasks_left, batch, on_device_done](int id) {
+                     Task task;
+                     while (tasks_left->try_pop(task)) {
+                         try {
+                             task(id);
+                         } catch (...) {
+                             std::lock_guard<std::mutex> lk(batch->m);
+                             if (!batch->ex) {
+                                 batch->ex = std::current_exception();
+                             }
+                         }
+                     }
+                     if (on_device_done) {
+                         on_device_done(id);
+                     }
+                 },
+                 batch});
+        }
+        cond_.notify_all();
+        wait(*batch);
+    }
+
+  private:
+    struct Batch {
+        std::mutex m;
+        std::condition_variable cond;
+        std::size_t remaining{0};
+        std::exception_ptr ex{nullptr};
+    };
+
+    struct WorkItem {
+        Task task;
+        std::shared_ptr<Batch> batch;
+    };
+
+    DeviceExecutor() {
+        const auto num_devices = DevicePool<int>::getTotalDevices();
+        for (std::size_t i = 0; i < num_devices; i++) {
+            queues_.emplace_back(std::make_unique<TSQueue<WorkItem>>());
+            pinned_.emplace_back(std::make_unique<TSQueue<WorkItem>>());
+        }
+        for (std::size_t i = 0; i < num_devices; i++) {
+            workers_.emplace_back(&DeviceExecutor::workerLoop, this,
+                                  static_cast<int>(i));
+        }
+    }
+
+    ~DeviceExecutor() {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            stop_ = true;
+        }
+        cond_.notify_all();
+        for (auto &worker : workers_) {
+            worker.join();
+        }
+    }
+
+    /**
+     * @brief Block until all tasks of the batch have completed, and rethrow
+     * the first exception raised by one of them.
+     */
+    static void wait(Batch &batch) {
+        std::unique_lock<std::mutex> lk(batch.m);
+        batch.cond.wait(lk, [&batch] { return batch.remaining == 0; });
+        if (batch.ex) {
+            std::rethrow_exception(batch.ex);
+        }
+    }
+
+    /**
+     * @brief Take a task pinned to the given device, or from its queue, or
+     * steal one from another device if both are empty.
+     */
+    bool tryGetWork(int device_id, WorkItem &item) {
+        if (pinned_[device_id]->try_pop(item)) {
+            std::lock_guard<std::mutex> lk(m_);
+            pending_--;
+            return true;
+        }
+        const auto num_queues = queues_.size();
+        for (std::size_t offset = 0; offset < num_queues; offset++) {
+            const auto idx = (device_id + offset) % num_queues;
+            if (queues_[idx]->try_pop(item)) {
+                std::lock_guard<std::mutex> lk(m_);
+                pending_--;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(int device_id) {
+        // Errors are reported by the tasks themselves on the first CUDA call
+        static_cast<void>(cudaSetDevice(device_id));
+        while (true) {
+            WorkItem item;
+            if (tryGetWork(device_id, item)) {
+                try {
+                    item.task(device_id);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lk(item.batch->m);
+                    if (!item.batch->ex) {
+                        item.batch->ex = std::current_exception();
+                    }
+                }
+                {
+                    std::lock_guard<std::mutex> lk(item.batch->m);
+                    item.batch->remaining--;
+                }
+                item.batch->cond.notify_all();
+                continue;
+            }
+            std::unique_lock<std::mutex> lk(m_);
+            cond_.wait(lk, [this] { return stop_ || pending_ > 0; });
+            if (stop_) {
+                return;
+            }
+        }
+    }
+
+    std::vector<std::unique_ptr<TSQueue<WorkItem>>> queues_;
+    std::vector<std::unique_ptr<TSQueue<WorkItem>>> pinned_;
+    std::vector<std::thread> workers_;
+    std::mutex m_;
+    std::condition_variable cond_;
+    long long pending_{0};
+    bool stop_{false};
+};
+
+} // namespace Pennylane::CUDA
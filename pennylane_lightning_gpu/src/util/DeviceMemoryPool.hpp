@@ -0,0 +1,301 @@
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Process-wide recycling allocator for device buffers, with one free
+ * list per device and size class.
+ *
+ * Requests of up to 1 MiB are rounded up to a power-of-two number of bytes,
+ * larger ones to a multiple of 2 MiB, the allocation granularity of
+ * `cudaMalloc`, so large blocks such as batches of state-vectors are not
+ * inflated beyond the memory they actually need. When the pool is enabled,
+ * released blocks are kept on the free list of their device and size class
+ * and handed out again by the next request of the same class, so loops
+ * repeatedly creating and destroying state-vectors of the same size stop
+ * calling `cudaMalloc` and `cudaFree`, and their implicit device
+ * synchronization, once warmed up. Idle blocks are only returned to the device
+ * by `trim`, or when an allocation would otherwise fail.
+ *
+ * Each block carries an event recorded on the stream of its last user when it
+ * is released. A recycled block is only handed out once that event has
+ * completed, so work still in flight on the old block cannot race with its new
+ * owner, whichever stream the latter uses.
+ *
+ * The pool is disabled by default, in which case blocks are allocated and
+ * freed directly. All methods are thread-safe.
+ */
+class DeviceMemoryPool {
+  public:
+    /**
+     * @brief Allocation counters of the pool.
+     */
+    struct Stats {
+        /// Requests served from a free list.
+        std::size_t hits{0};
+        /// Requests served by `cudaMalloc` while the pool is enabled.
+        std::size_t misses{0};
+        /// Bytes held by blocks currently handed out by the pool.
+        std::size_t in_use_bytes{0};
+        /// Bytes held by idle blocks on the free lists.
+        std::size_t cached_bytes{0};
+        /// Number of idle blocks on the free lists.
+        std::size_t cached_blocks{0};
+    };
+
+    DeviceMemoryPool(const DeviceMemoryPool &) = delete;
+    DeviceMemoryPool &operator=(const DeviceMemoryPool &) = delete;
+
+    /**
+     * @brief Get the global pool instance.
+     *
+     * The instance is intentionally never destroyed, so that buffers held by
+     * other static objects can still be released to it at exit.
+     */
+    static auto getInstance() -> DeviceMemoryPool & {
+        static auto *pool = new DeviceMemoryPool();
+        return *pool;
+    }
+
+    /**
+     * @brief Enable or disable the recycling of released blocks. Disabling
+     * the pool releases its idle blocks.
+     */
+    void setEnabled(bool enabled) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            enabled_ = enabled;
+        }
+        if (!enabled) {
+            trim();
+        }
+    }
+
+    [[nodiscard]] auto isEnabled() -> bool {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return enabled_;
+    }
+
+    /**
+     * @brief Allocate at least `size_bytes` of memory on the current device,
+     * which must be `device_id`.
+     *
+     * @param size_bytes Number of bytes requested.
+     * @param device_id CUDA device index of the current device.
+     * @return void* Device pointer.
+     */
+    auto allocate(std::size_t size_bytes, int device_id) -> void * {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!enabled_) {
+            lock.unlock();
+            return mallocRetry(size_bytes);
+        }
+        const auto size_class = getSizeClass(size_bytes);
+        auto &free_list = free_lists_[{device_id, size_class}];
+        if (!free_list.empty()) {
+            auto block = free_list.back();
+            free_list.pop_back();
+            stats_.hits++;
+            stats_.cached_bytes -= size_class;
+            stats_.cached_blocks--;
+            stats_.in_use_bytes += size_class;
+            in_use_.emplace(block.ptr, block);
+            lock.unlock();
+            PL_CUDA_IS_SUCCESS(cudaEventSynchronize(block.event));
+            return block.ptr;
+        }
+        stats_.misses++;
+        lock.unlock();
+
+        Block block{mallocRetry(size_class), nullptr, device_id, size_class};
+        PL_CUDA_IS_SUCCESS(
+            cudaEventCreateWithFlags(&block.event, cudaEventDisableTiming));
+
+        lock.lock();
+        stats_.in_use_bytes += size_class;
+        in_use_.emplace(block.ptr, block);
+        return block.ptr;
+    }
+
+    /**
+     * @brief Release memory obtained from `allocate`.
+     *
+     * The block is released on its own device, whichever device is current.
+     * Errors are not reported, since buffers are released from their
+     * destructors: a block whose release fails is leaked rather than handed
+     * out again before its last work completes.
+     *
+     * @param ptr Device pointer returned by `allocate`.
+     * @param stream_id Stream of the last work issued on the memory.
+     */
+    void deallocate(void *ptr, cudaStream_t stream_id) noexcept {
+        try {
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto it = in_use_.find(ptr);
+            if (it == in_use_.end()) {
+                // Allocated while the pool was disabled
+                lock.unlock();
+                Util::CudaScopedDevice device{Util::getPointerDevice(ptr)};
+                PL_CUDA_IS_SUCCESS(cudaFree(ptr));
+                return;
+            }
+            const auto block = it->second;
+            in_use_.erase(it);
+            stats_.in_use_bytes -= block.size_bytes;
+            if (!enabled_) {
+                lock.unlock();
+                Util::CudaScopedDevice device{block.device_id};
+                freeBlock(block);
+                return;
+            }
+            {
+                // The event must be recorded on the device of the stream
+                Util::CudaScopedDevice device{block.device_id};
+                PL_CUDA_IS_SUCCESS(cudaEventRecord(block.event, stream_id));
+            }
+            free_lists_[{block.device_id, block.size_bytes}].push_back(block);
+            stats_.cached_bytes += block.size_bytes;
+            stats_.cached_blocks++;
+        } catch (...) {
+            static_cast<void>(cudaGetLastError());
+        }
+    }
+
+    /**
+     * @brief Return all idle blocks to their devices.
+     *
+     * @return std::size_t Number of bytes released.
+     */
+    auto trim() -> std::size_t {
+        std::vector<Block> idle;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto &[key, free_list] : free_lists_) {
+                idle.insert(idle.end(), free_list.begin(), free_list.end());
+            }
+            free_lists_.clear();
+            stats_.cached_bytes = 0;
+            stats_.cached_blocks = 0;
+        }
+        if (idle.empty()) {
+            return 0;
+        }
+        int current_device = -1;
+        PL_CUDA_IS_SUCCESS(cudaGetDevice(&current_device));
+        std::size_t released = 0;
+        for (const auto &block : idle) {
+            PL_CUDA_IS_SUCCESS(cudaSetDevice(block.device_id));
+            freeBlock(block);
+            released += block.size_bytes;
+        }
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(current_device));
+        return released;
+    }
+
+    /**
+     * @brief Get the number of bytes held by idle blocks of a device. These
+     * blocks are released when an allocation would otherwise fail, so they
+     * count as available memory, although `cudaMemGetInfo` reports them as
+     * used.
+     *
+     * @param device_id CUDA device index.
+     */
+    [[nodiscard]] auto getCachedBytes(int device_id) -> std::size_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::size_t cached_bytes = 0;
+        for (const auto &[key, free_list] : free_lists_) {
+            if (key.first == device_id) {
+                cached_bytes += key.second * free_list.size();
+            }
+        }
+        return cached_bytes;
+    }
+
+    /**
+     * @brief Get the allocation counters of the pool.
+     */
+    [[nodiscard]] auto getStats() -> Stats {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+    /**
+     * @brief Reset the hit and miss counters.
+     */
+    void resetCounters() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats_.hits = 0;
+        stats_.misses = 0;
+    }
+
+    /**
+     * @brief Size of the blocks serving a request of `size_bytes`: the next
+     * power of two, and at least 512 bytes, up to 1 MiB, then the next
+     * multiple of 2 MiB.
+     */
+    static constexpr auto getSizeClass(std::size_t size_bytes)
+        -> std::size_t {
+        if (size_bytes > max_pow2_block_bytes) {
+            return (size_bytes + large_block_bytes - 1) / large_block_bytes *
+                   large_block_bytes;
+        }
+        std::size_t size_class = min_block_bytes;
+        while (size_class < size_bytes) {
+            size_class <<= 1U;
+        }
+        return size_class;
+    }
+
+  private:
+    static constexpr std::size_t min_block_bytes = 512;
+    static constexpr std::size_t max_pow2_block_bytes = 1UL << 20U;
+    static constexpr std::size_t large_block_bytes = 2UL << 20U;
+
+    struct Block {
+        void *ptr;
+        cudaEvent_t event;
+        int device_id;
+        std::size_t size_bytes;
+    };
+
+    DeviceMemoryPool() = default;
+
+    static void freeBlock(const Block &block) {
+        PL_CUDA_IS_SUCCESS(cudaEventDestroy(block.event));
+        PL_CUDA_IS_SUCCESS(cudaFree(block.ptr));
+    }
+
+    /**
+     * @brief `cudaMalloc`, releasing the idle blocks and trying again once if
+     * the device is out of memory.
+     */
+    auto mallocRetry(std::size_t size_bytes) -> void * {
+        void *ptr = nullptr;
+        auto status = cudaMalloc(&ptr, size_bytes);
+        if (status == cudaErrorMemoryAllocation && trim() > 0) {
+            // Clear the non-sticky allocation error before retrying
+            static_cast<void>(cudaGetLastError());
+            status = cudaMalloc(&ptr, size_bytes);
+        }
+        PL_CUDA_IS_SUCCESS(status);
+        return ptr;
+    }
+
+    std::mutex mutex_;
+    bool enabled_{false};
+    std::map<std::pair<int, std::size_t>, std::vector<Block>> free_lists_;
+    std::unordered_map<void *, Block> in_use_;
+    Stats stats_;
+};
+
+} // namespace Pennylane::CUDA
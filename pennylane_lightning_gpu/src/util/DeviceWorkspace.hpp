@@ -0,0 +1,82 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+
+#include "DataBuffer.hpp"
+#include "DevTag.hpp"
+#include "NvtxRange.hpp"
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Grow-only device scratch buffer, used to satisfy the extra workspace
+ * requests of custatevec calls without a cudaMalloc/cudaFree pair per call.
+ *
+ * The buffer is only reallocated when a request exceeds the current capacity,
+ * and is otherwise reused across calls. Since all users of the workspace are
+ * issued on the same stream, reuse between consecutive calls is safe.
+ *
+ * @tparam DevTagT Device tag index type.
+ */
+template <class DevTagT = int> class DeviceWorkspace {
+  public:
+    DeviceWorkspace(const DevTag<DevTagT> &dev_tag) : dev_tag_{dev_tag} {}
+
+    DeviceWorkspace() = delete;
+    DeviceWorkspace(const DeviceWorkspace &) = delete;
+    DeviceWorkspace &operator=(const DeviceWorkspace &) = delete;
+
+    /**
+     * @brief Get a device pointer to at least `size_bytes` of scratch memory.
+     *
+     * @param size_bytes Number of bytes requested.
+     * @return void* Device pointer, or `nullptr` if `size_bytes` is 0.
+     */
+    auto getWorkspace(std::size_t size_bytes) -> void * {
+        if (size_bytes == 0) {
+            return nullptr;
+        }
+        high_water_mark_ = std::max(high_water_mark_, size_bytes);
+        if (size_bytes > getCapacity()) {
+            PL_NVTX_RANGE("DeviceWorkspace::grow");
+            // Release the old block first to avoid holding both at once.
+            buffer_.reset();
+            buffer_ = std::make_unique<DataBuffer<char, DevTagT>>(size_bytes,
+                                                                  dev_tag_);
+        }
+        return buffer_->getData();
+    }
+
+    /**
+     * @brief Release the held device memory. The high-water mark is kept.
+     */
+    void release() { buffer_.reset(); }
+
+    /**
+     * @brief Number of bytes currently held on the device.
+     */
+    [[nodiscard]] auto getCapacity() const -> std::size_t {
+        return (buffer_ == nullptr) ? 0 : buffer_->getLength();
+    }
+
+    /**
+     * @brief Largest single request made of this workspace, in bytes.
+     */
+    [[nodiscard]] auto getHighWaterMark() const -> std::size_t {
+        return high_water_mark_;
+    }
+
+    inline auto getDevTag() const -> const DevTag<DevTagT> & {
+        return dev_tag_;
+    }
+
+  private:
+    DevTag<DevTagT> dev_tag_;
+    std::unique_ptr<DataBuffer<char, DevTagT>> buffer_{nullptr};
+    std::size_t high_water_mark_{0};
+};
+
+} // namespace Pennylane::CUDA
@@ -0,0 +1,67 @@
+// Copyright 2022 Xanadu Quantum Technologies Inc.
+
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+
+//     http://www.apache.org/licenses/LICENSE-2.0
+
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+/**
+ * @file NvtxRange.hpp
+ * Optional NVTX ranges for profiling with Nsight Systems.
+ */
+#pragma once
+
+#ifdef PL_USE_NVTX
+#include <nvtx3/nvToolsExt.h> // Header-only NVTX v3, shipped with CUDA
+#endif
+
+namespace Pennylane::CUDA::Util {
+
+/**
+ * @brief Scoped NVTX range, pushed on construction and popped on
+ * destruction. Without `PL_USE_NVTX`, the range does nothing.
+ */
+class NvtxRange {
+  public:
+    explicit NvtxRange([[maybe_unused]] const char *name) {
+#ifdef PL_USE_NVTX
+        nvtxRangePushA(name);
+#endif
+    }
+    ~NvtxRange() {
+#ifdef PL_USE_NVTX
+        nvtxRangePop();
+#endif
+    }
+
+    NvtxRange(const NvtxRange &) = delete;
+    NvtxRange &operator=(const NvtxRange &) = delete;
+};
+
+} // namespace Pennylane::CUDA::Util
+
+/// @cond DEV
+#define PL_NVTX_CONCAT_IMPL(a, b) a##b
+#define PL_NVTX_CONCAT(a, b) PL_NVTX_CONCAT_IMPL(a, b)
+/// @endcond
+
+/**
+ * @brief Open an NVTX range named `name` until the end of the enclosing
+ * scope. Expands to nothing unless built with `PL_USE_NVTX`, so the name is
+ * not evaluated.
+ */
+#ifdef PL_USE_NVTX
+#define PL_NVTX_RANGE(name)                                                    \
+    const ::Pennylane::CUDA::Util::NvtxRange PL_NVTX_CONCAT(pl_nvtx_range_,    \
+                                                            __LINE__) {        \
+        name                                                                   \
+    }
+#else
+#define PL_NVTX_RANGE(name) static_cast<void>(0)
+#endif
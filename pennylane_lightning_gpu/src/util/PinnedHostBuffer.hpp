@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+
+#include "cuda.h"
+#include "cuda_helpers.hpp"
+
+namespace Pennylane::CUDA {
+
+/**
+ * @brief Page-locked host buffer, used to stage transfers between the host and
+ * a device buffer.
+ *
+ * Copies from or to pinned memory run as true DMA transfers, so
+ * `cudaMemcpyAsync` returns immediately and the transfer overlaps with host
+ * work and later kernels. The buffer carries an event marking the completion
+ * of the last transfer that used it, which must be waited upon before the host
+ * reads or overwrites the data.
+ *
+ * @tparam T Element type.
+ */
+template <class T> class PinnedHostBuffer {
+  public:
+    /**
+     * @brief Allocate `length` elements of page-locked host memory.
+     */
+    explicit PinnedHostBuffer(std::size_t length) : length_{length} {
+        if (length_ > 0) {
+            PL_CUDA_IS_SUCCESS(cudaMallocHost(
+                reinterpret_cast<void **>(&host_buffer_), sizeof(T) * length));
+        }
+        PL_CUDA_IS_SUCCESS(
+            cudaEventCreateWithFlags(&event_, cudaEventDisableTiming));
+    }
+
+    PinnedHostBuffer() = delete;
+    PinnedHostBuffer(const PinnedHostBuffer &) = delete;
+    PinnedHostBuffer &operator=(const PinnedHostBuffer &) = delete;
+
+    virtual ~PinnedHostBuffer() {
+        cudaEventDestroy(event_);
+        if (host_buffer_ != nullptr) {
+            cudaFreeHost(host_buffer_);
+        }
+    }
+
+    /**
+     * @brief Mark the end of a transfer enqueued on `stream`.
+     *
+     * @return cudaEvent_t Event completed once the transfer has finished.
+     */
+    auto recordTransfer(cudaStream_t stream) -> cudaEvent_t {
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(event_, stream));
+        return event_;
+    }
+
+    /**
+     * @brief Block the host until the last recorded transfer has finished.
+     */
+    void synchronize() const {
+        PL_CUDA_IS_SUCCESS(cudaEventSynchronize(event_));
+    }
+
+    /**
+     * @brief Check whether the last recorded transfer has finished, without
+     * blocking.
+     */
+    [[nodiscard]] auto isReady() const -> bool {
+        const auto status = cudaEventQuery(event_);
+        if (status == cudaErrorNotReady) {
+            return false;
+        }
+        PL_CUDA_IS_SUCCESS(status);
+        return true;
+    }
+
+    [[nodiscard]] auto getEvent() const -> cudaEvent_t { return event_; }
+    [[nodiscard]] auto getLength() const -> std::size_t { return length_; }
+    auto getData() -> T * { return host_buffer_; }
+    auto getData() const -> const T * { return host_buffer_; }
+
+  private:
+    std::size_t length_;
+    T *host_buffer_{nullptr};
+    cudaEvent_t event_{nullptr};
+};
+
+} // namespace Pennylane::CUDA
@@ -3,13 +3,19 @@
 
 #pragma once
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <numeric>
+#include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <cuComplex.h>
 #include <cublas_v2.h>
 #include <cuda.h>
+#include <curand.h>
+#include <cusparse.h>
 #include <custatevec.h>
 
 #include "Error.hpp"
@@ -31,6 +37,23 @@ namespace Pennylane::CUDA::Util {
 #define PL_CUBLAS_IS_SUCCESS(err)                                              \
     PL_ABORT_IF_NOT(err == CUBLAS_STATUS_SUCCESS, GetCuBlasErrorString(err))
 
+/**
+ * @brief Macro that throws Exception from cuRAND failure error codes.
+ *
+ * @param err cuRAND function error-code.
+ */
+#define PL_CURAND_IS_SUCCESS(err)                                              \
+    PL_ABORT_IF_NOT(err == CURAND_STATUS_SUCCESS,                              \
+                    GetCuRandErrorString(err).c_str())
+
+/**
+ * @brief Macro that throws Exception from cuSPARSE failure error codes.
+ *
+ * @param err cuSPARSE function error-code.
+ */
+#define PL_CUSPARSE_IS_SUCCESS(err)                                            \
+    PL_ABORT_IF_NOT(err == CUSPARSE_STATUS_SUCCESS, cusparseGetErrorString(err))
+
 /**
  * @brief Macro that throws Exception from cuQuantum failure error codes.
  *
@@ -45,6 +68,10 @@ namespace Pennylane::CUDA::Util {
     { static_cast<void>(err); }
 #define PL_CUBLAS_IS_SUCCESS(err)                                              \
     { static_cast<void>(err); }
+#define PL_CURAND_IS_SUCCESS(err)                                              \
+    { static_cast<void>(err); }
+#define PL_CUSPARSE_IS_SUCCESS(err)                                            \
+    { static_cast<void>(err); }
 #define PL_CUSTATEVEC_IS_SUCCESS(err)                                          \
     { static_cast<void>(err); }
 #endif
@@ -85,6 +112,27 @@ static const std::string GetCuBlasErrorString(const cublasStatus_t &err) {
     return result;
 }
 
+static const std::string GetCuRandErrorString(const curandStatus_t &err) {
+    std::string result;
+    switch (err) {
+    case CURAND_STATUS_SUCCESS:
+        result = "No errors";
+        break;
+    case CURAND_STATUS_NOT_INITIALIZED:
+        result = "cuRAND generator not initialized";
+        break;
+    case CURAND_STATUS_ALLOCATION_FAILED:
+        result = "cuRAND memory allocation failed";
+        break;
+    case CURAND_STATUS_LAUNCH_FAILURE:
+        result = "cuRAND kernel launch failed";
+        break;
+    default:
+        result = "Status not found";
+    }
+    return result;
+}
+
 static const std::string
 GetCuStateVecErrorString(const custatevecStatus_t &err) {
     std::string result;
@@ -325,6 +373,168 @@ template <class CFP_t> inline static constexpr auto INVSQRT2() -> CFP_t {
     }
 }
 
+/**
+ * @brief Process-wide registry of cuBLAS handles, keyed by device and stream.
+ *
+ * Handles are created lazily on first use of a given (device, stream) pair and
+ * live until the end of the process, avoiding a `cublasCreate`/`cublasDestroy`
+ * pair per BLAS call. Lookups are thread-safe. As handles are shared, their
+ * configuration must not be changed by their users: each handle is created
+ * with a fixed pointer mode, which is part of its key, so callers reading
+ * scalars from the host and from the device get separate handles.
+ */
+class CublasHandleRegistry {
+  public:
+    CublasHandleRegistry(const CublasHandleRegistry &) = delete;
+    CublasHandleRegistry &operator=(const CublasHandleRegistry &) = delete;
+
+    /**
+     * @brief Get the global registry instance.
+     */
+    static auto getInstance() -> CublasHandleRegistry & {
+        static CublasHandleRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Get the cuBLAS handle associated with the given device, stream
+     * and pointer mode, creating it if needed. The handle is bound to
+     * `stream_id` and set to `pointer_mode`.
+     *
+     * @param dev_id CUDA device index.
+     * @param stream_id CUDA stream.
+     * @param pointer_mode Location of the scalars passed to cuBLAS calls.
+     * @return cublasHandle_t
+     */
+    auto getHandle(int dev_id, cudaStream_t stream_id,
+                   cublasPointerMode_t pointer_mode = CUBLAS_POINTER_MODE_HOST)
+        -> cublasHandle_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto key = std::make_tuple(dev_id, stream_id, pointer_mode);
+        if (auto it = handles_.find(key); it != handles_.end()) {
+            return it->second;
+        }
+        cublasHandle_t handle;
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
+        PL_CUBLAS_IS_SUCCESS(cublasCreate(&handle));
+        PL_CUBLAS_IS_SUCCESS(cublasSetStream(handle, stream_id));
+        PL_CUBLAS_IS_SUCCESS(cublasSetPointerMode(handle, pointer_mode));
+        handles_.emplace(key, handle);
+        return handle;
+    }
+
+    /**
+     * @brief Destroy the cuBLAS handles associated with the given device and
+     * stream, if any. Must be called before destroying a stream that was given
+     * to `getHandle`.
+     *
+     * @param dev_id CUDA device index.
+     * @param stream_id CUDA stream.
+     */
+    void releaseHandle(int dev_id, cudaStream_t stream_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const auto pointer_mode :
+             {CUBLAS_POINTER_MODE_HOST, CUBLAS_POINTER_MODE_DEVICE}) {
+            const auto key = std::make_tuple(dev_id, stream_id, pointer_mode);
+            if (auto it = handles_.find(key); it != handles_.end()) {
+                PL_CUBLAS_IS_SUCCESS(cublasDestroy(it->second));
+                handles_.erase(it);
+            }
+        }
+    }
+
+    /**
+     * @brief Number of handles currently held by the registry.
+     */
+    auto getNumHandles() -> std::size_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return handles_.size();
+    }
+
+  private:
+    CublasHandleRegistry() = default;
+    ~CublasHandleRegistry() {
+        // The CUDA runtime may already be torn down at exit; ignore errors.
+        for (auto &[key, handle] : handles_) {
+            cublasDestroy(handle);
+        }
+    }
+
+    std::mutex mutex_;
+    std::map<std::tuple<int, cudaStream_t, cublasPointerMode_t>,
+             cublasHandle_t>
+        handles_;
+};
+
+/**
+ * @brief Process-wide registry of cuSPARSE handles, keyed by device and
+ * stream. See `CublasHandleRegistry`.
+ */
+class CusparseHandleRegistry {
+  public:
+    CusparseHandleRegistry(const CusparseHandleRegistry &) = delete;
+    CusparseHandleRegistry &operator=(const CusparseHandleRegistry &) = delete;
+
+    /**
+     * @brief Get the global registry instance.
+     */
+    static auto getInstance() -> CusparseHandleRegistry & {
+        static CusparseHandleRegistry registry;
+        return registry;
+    }
+
+    /**
+     * @brief Get the cuSPARSE handle associated with the given device and
+     * stream, creating it if needed. The handle is bound to `stream_id`.
+     *
+     * @param dev_id CUDA device index.
+     * @param stream_id CUDA stream.
+     * @return cusparseHandle_t
+     */
+    auto getHandle(int dev_id, cudaStream_t stream_id) -> cusparseHandle_t {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto key = std::make_pair(dev_id, stream_id);
+        if (auto it = handles_.find(key); it != handles_.end()) {
+            return it->second;
+        }
+        cusparseHandle_t handle;
+        PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
+        PL_CUSPARSE_IS_SUCCESS(cusparseCreate(&handle));
+        PL_CUSPARSE_IS_SUCCESS(cusparseSetStream(handle, stream_id));
+        handles_.emplace(key, handle);
+        return handle;
+    }
+
+    /**
+     * @brief Destroy the cuSPARSE handle associated with the given device and
+     * stream, if any. Must be called before destroying a stream that was given
+     * to `getHandle`.
+     *
+     * @param dev_id CUDA device index.
+     * @param stream_id CUDA stream.
+     */
+    void releaseHandle(int dev_id, cudaStream_t stream_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const auto key = std::make_pair(dev_id, stream_id);
+        if (auto it = handles_.find(key); it != handles_.end()) {
+            PL_CUSPARSE_IS_SUCCESS(cusparseDestroy(it->second));
+            handles_.erase(it);
+        }
+    }
+
+  private:
+    CusparseHandleRegistry() = default;
+    ~CusparseHandleRegistry() {
+        // The CUDA runtime may already be torn down at exit; ignore errors.
+        for (auto &[key, handle] : handles_) {
+            cusparseDestroy(handle);
+        }
+    }
+
+    std::mutex mutex_;
+    std::map<std::pair<int, cudaStream_t>, cusparseHandle_t> handles_;
+};
+
 /**
  * @brief cuBLAS backed inner product for GPU data.
  *
@@ -338,20 +548,84 @@ template <class T = cuFloatComplex, class DevTypeID = int>
 inline auto innerProdC_CUDA(const T *v1, const T *v2, const int data_size,
                             int dev_id, cudaStream_t stream_id) -> T {
     T result{0.0, 0.0}; // Host result
-    cublasHandle_t handle;
+    cublasHandle_t handle =
+        CublasHandleRegistry::getInstance().getHandle(dev_id, stream_id);
     PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
-    PL_CUBLAS_IS_SUCCESS(cublasCreate(&handle));
-    PL_CUBLAS_IS_SUCCESS(cublasSetStream(handle, stream_id));
 
     if constexpr (std::is_same_v<T, cuFloatComplex>) {
-        cublasCdotc(handle, data_size, v1, 1, v2, 1, &result);
+        PL_CUBLAS_IS_SUCCESS(
+            cublasCdotc(handle, data_size, v1, 1, v2, 1, &result));
     } else if constexpr (std::is_same_v<T, cuDoubleComplex>) {
-        cublasZdotc(handle, data_size, v1, 1, v2, 1, &result);
+        PL_CUBLAS_IS_SUCCESS(
+            cublasZdotc(handle, data_size, v1, 1, v2, 1, &result));
     }
-    cublasDestroy(handle);
     return result;
 }
 
+/**
+ * @brief cuBLAS backed batch of inner products between a set of vectors stored
+ * contiguously on the device and a single vector, using one GEMV call. For
+ * `num_vecs` vectors of length `data_size` stored back-to-back in `vecs`,
+ * computes `result[i] = <vecs_i|v>` on the device.
+ *
+ * @tparam T Complex data-type. Accepts cuFloatComplex and cuDoubleComplex
+ * @param vecs Device pointer to `num_vecs * data_size` contiguous elements.
+ * @param v Device data pointer to the right-hand vector.
+ * @param data_size Length of each vector.
+ * @param num_vecs Number of vectors in `vecs`.
+ * @param dev_id Device index of the data.
+ * @param stream_id Stream on which to perform the reduction.
+ * @param result Device pointer receiving `num_vecs` inner-product results.
+ */
+template <class T = cuFloatComplex, class DevTypeID = int>
+inline void innerProdsC_CUDA_device(const T *vecs, const T *v,
+                                    const int data_size, const int num_vecs,
+                                    int dev_id, cudaStream_t stream_id,
+                                    T *result) {
+    const T alpha{1.0, 0.0};
+    const T beta{0.0, 0.0};
+    cublasHandle_t handle =
+        CublasHandleRegistry::getInstance().getHandle(dev_id, stream_id);
+    PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
+
+    if constexpr (std::is_same_v<T, cuFloatComplex>) {
+        PL_CUBLAS_IS_SUCCESS(cublasCgemv(handle, CUBLAS_OP_C, data_size,
+                                         num_vecs, &alpha, vecs, data_size, v,
+                                         1, &beta, result, 1));
+    } else if constexpr (std::is_same_v<T, cuDoubleComplex>) {
+        PL_CUBLAS_IS_SUCCESS(cublasZgemv(handle, CUBLAS_OP_C, data_size,
+                                         num_vecs, &alpha, vecs, data_size, v,
+                                         1, &beta, result, 1));
+    }
+}
+
+/**
+ * @brief cuBLAS backed `y = a * x + y` for GPU data. The call is asynchronous
+ * with respect to the host.
+ *
+ * @tparam T Complex data-type. Accepts cuFloatComplex and cuDoubleComplex
+ * @param a Host scaling factor of `x`.
+ * @param x Device data pointer added to `y`.
+ * @param y Device data pointer updated in place.
+ * @param data_size Length of device data.
+ * @param dev_id Device index of the data.
+ * @param stream_id Stream on which to perform the update.
+ */
+template <class T = cuFloatComplex>
+inline void scaleAndAddC_CUDA(const T a, const T *x, T *y,
+                              const int data_size, int dev_id,
+                              cudaStream_t stream_id) {
+    cublasHandle_t handle =
+        CublasHandleRegistry::getInstance().getHandle(dev_id, stream_id);
+    PL_CUDA_IS_SUCCESS(cudaSetDevice(dev_id));
+
+    if constexpr (std::is_same_v<T, cuFloatComplex>) {
+        PL_CUBLAS_IS_SUCCESS(cublasCaxpy(handle, data_size, &a, x, 1, y, 1));
+    } else if constexpr (std::is_same_v<T, cuDoubleComplex>) {
+        PL_CUBLAS_IS_SUCCESS(cublasZaxpy(handle, data_size, &a, x, 1, y, 1));
+    }
+}
+
 /**
  * If T is a supported data type for gates, this expression will
  * evaluate to `true`. Otherwise, it will evaluate to `false`.
@@ -516,4 +790,138 @@ class CudaScopedDevice {
     int prev_device_;
 };
 
+/**
+ * @brief Get the device holding the given device pointer.
+ *
+ * @param ptr Device pointer.
+ * @return int CUDA device index.
+ */
+inline int getPointerDevice(const void *ptr) {
+    cudaPointerAttributes attributes;
+    PL_CUDA_IS_SUCCESS(cudaPointerGetAttributes(&attributes, ptr));
+    return attributes.device;
+}
+
+/**
+ * @brief Allow kernels and copies on `device` to access memory on `peer`
+ * directly, if the hardware supports it.
+ *
+ * @param device CUDA device index accessing the memory.
+ * @param peer CUDA device index holding the memory.
+ * @return bool True if peer access is enabled.
+ */
+inline bool enablePeerAccess(int device, int peer) {
+    if (device == peer) {
+        return true;
+    }
+    int can_access = 0;
+    PL_CUDA_IS_SUCCESS(cudaDeviceCanAccessPeer(&can_access, device, peer));
+    if (!can_access) {
+        return false;
+    }
+    CudaScopedDevice scoped_device(device);
+    const auto status = cudaDeviceEnablePeerAccess(peer, 0);
+    if (status == cudaErrorPeerAccessAlreadyEnabled) {
+        // Clear the sticky error state left by the call
+        static_cast<void>(cudaGetLastError());
+        return true;
+    }
+    PL_CUDA_IS_SUCCESS(status);
+    return true;
+}
+
+/**
+ * @brief Broadcast a device buffer to buffers on other devices.
+ *
+ * Copies follow a binary tree rooted at the source: every device that already
+ * holds the data sends it to one new device per round, so `n` destinations
+ * are filled in `ceil(log2(n + 1))` rounds instead of `n` copies out of the
+ * source. Peer access is enabled between each pair of devices that exchange
+ * data, so copies go over NVLink/PCIe directly when the topology allows it,
+ * and are staged through the host otherwise.
+ *
+ * The copies are ordered with events rather than host synchronization: each
+ * copy is issued on the stream of its destination once the sender's data is
+ * ready, and later work on the sender's stream waits for the copy to have
+ * read its data. The call returns without waiting for the copies, whose
+ * results are ready for work issued on the destination streams.
+ *
+ * @tparam T Element type.
+ * @param src Source device pointer.
+ * @param src_device Device holding `src`.
+ * @param src_stream Stream of `src_device` the source data is written on.
+ * @param dsts Destination device pointers, each of `length` elements.
+ * @param dst_devices Device holding each destination. Must differ from
+ * `src_device` and from each other.
+ * @param dst_streams Stream of each destination device the destination data
+ * will be used on.
+ * @param length Number of elements to copy.
+ */
+template <class T>
+void broadcastPeer(const T *src, int src_device, cudaStream_t src_stream,
+                   const std::vector<T *> &dsts,
+                   const std::vector<int> &dst_devices,
+                   const std::vector<cudaStream_t> &dst_streams,
+                   std::size_t length) {
+    PL_ABORT_IF_NOT(dsts.size() == dst_devices.size() &&
+                        dsts.size() == dst_streams.size(),
+                    "Each destination buffer requires a device and a stream.");
+    const auto num_bytes = sizeof(T) * length;
+
+    struct Holder {
+        const T *ptr;
+        int device;
+        cudaStream_t stream;
+        cudaEvent_t ready;
+    };
+    std::vector<Holder> holders;
+    holders.reserve(dsts.size() + 1);
+    auto record = [&holders](const T *ptr, int device, cudaStream_t stream) {
+        CudaScopedDevice scoped_device(device);
+        cudaEvent_t ready;
+        PL_CUDA_IS_SUCCESS(
+            cudaEventCreateWithFlags(&ready, cudaEventDisableTiming));
+        holders.push_back({ptr, device, stream, ready});
+        PL_CUDA_IS_SUCCESS(cudaEventRecord(ready, stream));
+    };
+    // Waits already issued on an event are not affected by its destruction
+    auto release = [&holders]() {
+        for (const auto &holder : holders) {
+            static_cast<void>(cudaEventDestroy(holder.ready));
+        }
+    };
+
+    try {
+        record(src, src_device, src_stream);
+        std::size_t next = 0;
+        while (next < dsts.size()) {
+            const auto num_senders =
+                std::min(holders.size(), dsts.size() - next);
+            for (std::size_t i = 0; i < num_senders; i++) {
+                const auto sender = holders[i];
+                const auto recv = next + i;
+                enablePeerAccess(sender.device, dst_devices[recv]);
+                {
+                    CudaScopedDevice scoped_device(dst_devices[recv]);
+                    PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(
+                        dst_streams[recv], sender.ready, 0));
+                    PL_CUDA_IS_SUCCESS(cudaMemcpyPeerAsync(
+                        dsts[recv], dst_devices[recv], sender.ptr,
+                        sender.device, num_bytes, dst_streams[recv]));
+                }
+                // Receivers of this round become senders of the next one
+                record(dsts[recv], dst_devices[recv], dst_streams[recv]);
+                CudaScopedDevice scoped_device(sender.device);
+                PL_CUDA_IS_SUCCESS(cudaStreamWaitEvent(
+                    sender.stream, holders.back().ready, 0));
+            }
+            next += num_senders;
+        }
+    } catch (...) {
+        release();
+        throw;
+    }
+    release();
+}
+
 } // namespace Pennylane::CUDA::Util
@@ -372,6 +372,54 @@ class TestAdjointJacobian:
 
         assert np.allclose(dM1, dM2, atol=tol, rtol=0)
 
+    def test_mixed_precision(self, dev_gpu):
+        """Tests that a single-precision device with double-precision reductions matches the
+        double-precision device."""
+        x, y, z = [0.5, 0.3, -0.7]
+
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.4, wires=[0])
+            qml.Rot(x, y, z, wires=[1])
+            qml.CNOT(wires=[1, 2])
+            qml.RY(-0.2, wires=[2])
+            qml.expval(qml.PauliZ(0) @ qml.PauliX(2))
+            qml.expval(qml.PauliY(1))
+
+        tape.trainable_params = {1, 2, 3, 4}
+
+        dev_mixed = qml.device("lightning.gpu", wires=3, c_dtype=np.complex64, mixed_precision=True)
+        assert dev_mixed._gpu_state.getMixedPrecision()
+
+        expected = dev_gpu.adjoint_jacobian(tape)
+        res = dev_mixed.adjoint_jacobian(tape)
+        assert np.allclose(res, expected, atol=1e-5, rtol=0)
+
+        expected = qml.execute([tape], dev_gpu, None)
+        res = qml.execute([tape], dev_mixed, None)
+        assert np.allclose(res, expected, atol=1e-5, rtol=0)
+
+    def test_vector_jacobian_product(self, tol, dev_gpu):
+        """Tests that the vector-Jacobian product matches the contraction of the cotangents with
+        the adjoint Jacobian."""
+        with qml.tape.QuantumTape() as tape:
+            qml.RX(0.4, wires=[0])
+            qml.Rot(0.5, 0.3, -0.7, wires=[1])
+            qml.CNOT(wires=[1, 2])
+            qml.RY(-0.2, wires=[2])
+            qml.expval(qml.PauliZ(0) @ qml.PauliX(2))
+            qml.expval(qml.PauliY(1))
+            qml.expval(qml.PauliX(2))
+
+        tape.trainable_params = {0, 2, 4}
+        dy = np.array([0.5, -1.5, 2.0])
+
+        jac = dev_gpu.adjoint_jacobian(tape)
+        vjp = dev_gpu.vector_jacobian_product(tape, dy)
+        assert np.allclose(vjp, dy @ jac, atol=tol, rtol=0)
+
+        with pytest.raises(ValueError, match="Expected 3 cotangents"):
+            dev_gpu.vector_jacobian_product(tape, dy[:2])
+
 
 class TestAdjointJacobianQNode:
     """Test QNode integration with the adjoint_jacobian method"""
@@ -242,6 +242,34 @@ class TestApply:
 
         assert np.allclose(qubit_device_2_wires.state, np.array(expected_output), atol=tol, rtol=0)
 
+    @pytest.mark.parametrize(
+        "operation,expected_output,par,wires",
+        [
+            (qml.BasisState, [0, 0, 1, 0], [1, 0], [1, 0]),
+            (qml.BasisState, [0, 1, 0, 0], [1], [1]),
+            (qml.QubitStateVector, [0, 1, 0, 0], [0, 1], [1]),
+            (qml.QubitStateVector, [0, 0, 1, 0], [0, 1], [0]),
+            (qml.QubitStateVector, [0, 0, 1, 0], [0, 1, 0, 0], [1, 0]),
+            (
+                qml.QubitStateVector,
+                [1 / math.sqrt(2), 0, 1j / math.sqrt(2), 0],
+                [1 / math.sqrt(2), 1j / math.sqrt(2)],
+                [0],
+            ),
+        ],
+    )
+    def test_apply_state_preparation_subset(
+        self, qubit_device_2_wires, tol, operation, expected_output, par, wires
+    ):
+        """Tests that state preparations on a subset or permutation of the wires are
+        scattered into the correct amplitudes on the device."""
+
+        par = np.array(par)
+        qubit_device_2_wires.reset()
+        qubit_device_2_wires.apply([operation(par, wires=wires)])
+
+        assert np.allclose(qubit_device_2_wires.state, np.array(expected_output), atol=tol, rtol=0)
+
     """ operation,input,expected_output,par """
     test_data_single_wire_with_parameters = [
         (qml.PhaseShift, [1, 0], [1, 0], [math.pi / 2]),
@@ -1232,6 +1260,141 @@ class TestApplyCQMethod:
         spy_unitary.assert_not_called()
 
 
+class TestAsyncSync:
+    """Unit tests for the asynchronous host synchronization through pinned memory."""
+
+    def test_state_waits_for_async_copy(self, tol):
+        """Test that the host state is filled in when accessed after an async copy"""
+        dev = qml.device("lightning.gpu", wires=2)
+        dev.apply([qml.Hadamard(0), qml.CNOT(wires=[0, 1])])
+
+        assert dev._pending_d2h
+        expected = np.array([1, 0, 0, 1]) / np.sqrt(2)
+        assert np.allclose(dev.state, expected, atol=tol, rtol=0)
+        assert not dev._pending_d2h
+
+    def test_state_reflects_later_gates(self, tol):
+        """Test that gates applied after an async copy are reflected in the host state"""
+        dev = qml.device("lightning.gpu", wires=2)
+        dev.apply([qml.PauliX(0)])
+        dev.apply_cq([qml.PauliX(1)])
+
+        assert np.allclose(dev.state, np.array([0, 0, 1, 0]), atol=tol, rtol=0)
+
+    def test_state_preparation_on_device(self, tol):
+        """Test that a state preparation followed by gates is applied on the device"""
+        dev = qml.device("lightning.gpu", wires=2)
+        state = np.array([0.5, -0.5j, 0.5, 0.5j])
+        dev.apply([qml.QubitStateVector(state, wires=[0, 1]), qml.PauliX(1)])
+
+        expected = np.array([-0.5j, 0.5, 0.5j, 0.5])
+        assert np.allclose(dev.state, expected, atol=tol, rtol=0)
+
+    def test_redundant_transfers_skipped(self, tol):
+        """Test that the state is only copied to the host when the GPU data changed"""
+        dev = qml.device("lightning.gpu", wires=2)
+        dev.apply([qml.Hadamard(0)])
+        dev.syncD2H()
+        version = dev._gpu_state.getDataVersion()
+        assert dev._host_version == version
+
+        # No gates were applied, so there is nothing to download
+        dev.apply([])
+        assert not dev._pending_d2h
+
+        dev.apply_cq([qml.PauliX(1)])
+        assert dev._gpu_state.getDataVersion() > version
+        dev.syncD2H()
+        assert dev._host_version == dev._gpu_state.getDataVersion()
+        expected = np.array([0, 1, 0, 1]) / np.sqrt(2)
+        assert np.allclose(dev.state, expected, atol=tol, rtol=0)
+
+
+class TestDeviceArrayInterop:
+    """Unit tests for the zero-copy exchange of the device state with other GPU frameworks."""
+
+    @pytest.mark.parametrize("c_dtype", [np.complex64, np.complex128])
+    def test_cuda_array_interface(self, c_dtype):
+        """Test that the device data is described by __cuda_array_interface__"""
+        dev = qml.device("lightning.gpu", wires=3, c_dtype=c_dtype)
+        cai = dev._gpu_state.__cuda_array_interface__
+
+        assert cai["shape"] == (8,)
+        assert cai["typestr"] == np.dtype(c_dtype).str
+        assert cai["data"][0] != 0 and not cai["data"][1]
+        assert cai["version"] == 3
+
+    def test_wrap_device_array(self, tol):
+        """Test that a state-vector wrapping the memory of another shares its data"""
+        gpu_ctor = plg.lightning_gpu._gpu_dtype(np.complex128)
+        sv = gpu_ctor(np.array([1, 0, 0, 0], dtype=np.complex128))
+        view = gpu_ctor.fromDeviceArray(sv)
+        assert view.__cuda_array_interface__["data"] == sv.__cuda_array_interface__["data"]
+
+        view.Hadamard([0], False, [])
+        view.CNOT([0, 1], False, [])
+        sv.markModified()
+
+        state = np.zeros(4, dtype=np.complex128)
+        sv.DeviceToHost(state, False)
+        expected = np.array([1, 0, 0, 1]) / np.sqrt(2)
+        assert np.allclose(state, expected, atol=tol, rtol=0)
+
+    def test_wrap_device_pointer_validation(self):
+        """Test that wrapping raw device memory checks its size and location"""
+        gpu_ctor = plg.lightning_gpu._gpu_dtype(np.complex128)
+        sv = gpu_ctor(np.array([1, 0, 0, 0], dtype=np.complex128))
+        ptr = sv.__cuda_array_interface__["data"][0]
+        dev_tag = plg.lightning_gpu.DevTag(0)
+
+        view = gpu_ctor(ptr, 4, dev_tag)
+        assert view.__cuda_array_interface__["data"][0] == ptr
+        with pytest.raises(Exception, match="power of 2"):
+            gpu_ctor(ptr, 3, dev_tag)
+        with pytest.raises(Exception, match="power of 2"):
+            gpu_ctor(ptr, 0, dev_tag)
+
+        host = np.zeros(4, dtype=np.complex128)
+        with pytest.raises(Exception, match="memory of the tag's device"):
+            gpu_ctor(host.ctypes.data, 4, dev_tag)
+
+    def test_wrap_device_array_wrong_precision(self):
+        """Test that wrapping memory of another precision raises an error"""
+        dev = qml.device("lightning.gpu", wires=2, c_dtype=np.complex64)
+        other = qml.device("lightning.gpu", wires=2, c_dtype=np.complex128)
+        with pytest.raises(Exception, match="precision"):
+            type(dev._gpu_state).fromDeviceArray(other._gpu_state)
+
+    def test_cupy_roundtrip(self, tol):
+        """Test that CuPy reads the state through DLPack and is wrapped back without copies"""
+        cp = pytest.importorskip("cupy")
+        dev = qml.device("lightning.gpu", wires=2)
+        dev.apply([qml.PauliX(1)])
+
+        state = cp.from_dlpack(dev._gpu_state)
+        assert state.data.ptr == dev._gpu_state.__cuda_array_interface__["data"][0]
+        assert np.allclose(cp.asnumpy(state), [0, 1, 0, 0], atol=tol, rtol=0)
+
+        values = cp.asarray([0.5, 0.5j, -0.5, -0.5j], dtype=cp.complex128)
+        sv = type(dev._gpu_state).fromDeviceArray(values)
+        sv.PauliX([0], False, [])
+        cp.cuda.get_current_stream().synchronize()
+        assert np.allclose(cp.asnumpy(values), [-0.5, -0.5j, 0.5, 0.5j], atol=tol, rtol=0)
+
+    def test_torch_dlpack(self, tol):
+        """Test that PyTorch reads the state through DLPack without a copy"""
+        torch = pytest.importorskip("torch")
+        if not torch.cuda.is_available():
+            pytest.skip("PyTorch has no CUDA support")
+        dev = qml.device("lightning.gpu", wires=2)
+        dev.apply([qml.Hadamard(0)])
+
+        state = torch.utils.dlpack.from_dlpack(dev._gpu_state.__dlpack__())
+        assert state.data_ptr() == dev._gpu_state.__cuda_array_interface__["data"][0]
+        expected = np.array([1, 0, 1, 0]) / np.sqrt(2)
+        assert np.allclose(state.cpu().numpy(), expected, atol=tol, rtol=0)
+
+
 # Tolerance for non-analytic tests
 TOL_STOCHASTIC = 0.05
 
@@ -14,10 +14,13 @@
 """
 Unit tests for the expval method of the :mod:`pennylane_lightning_gpu.LightningGPU` device.
 """
+from concurrent.futures import ThreadPoolExecutor
+
 import pytest
 
 import numpy as np
 import pennylane as qml
+from pennylane_lightning_gpu import lightning_gpu
 
 from conftest import U, U2, A
 
@@ -192,3 +195,200 @@ class TestTensorExpval:
         expected = -(np.cos(varphi) * np.sin(phi) + np.sin(varphi) * np.cos(theta)) / np.sqrt(2)
 
         assert np.allclose(res, expected, tol)
+
+
+class TestHamiltonianExpval:
+    """Test expectation values of Hamiltonians evaluated on the device"""
+
+    ops = [
+        qml.RX(0.4, wires=[0]),
+        qml.RY(-0.2, wires=[1]),
+        qml.RX(0.7, wires=[2]),
+        qml.CNOT(wires=[0, 1]),
+        qml.CNOT(wires=[1, 2]),
+    ]
+
+    def expected(self, dev, matrix):
+        dev.syncD2H()
+        state = dev.state
+        return np.real(np.vdot(state, matrix @ state))
+
+    def test_pauli_hamiltonian(self, qubit_device_3_wires, tol):
+        """Test that a Hamiltonian of Pauli words is evaluated correctly"""
+        dev = qubit_device_3_wires
+        obs = qml.Hamiltonian(
+            [0.3, -1.2, 0.5, 0.8],
+            [
+                qml.PauliZ(0) @ qml.PauliZ(1),
+                qml.PauliX(2),
+                qml.PauliY(0) @ qml.Identity(1) @ qml.PauliX(2),
+                qml.Identity(1),
+            ],
+        )
+        dev.apply(self.ops)
+
+        res = dev.expval(obs)
+        expected = self.expected(dev, qml.matrix(obs, wire_order=dev.wires))
+
+        assert np.allclose(res, expected, tol)
+
+    def test_sparse_hamiltonian(self, qubit_device_3_wires, tol):
+        """Test that a sparse Hamiltonian is evaluated correctly"""
+        dev = qubit_device_3_wires
+        H = qml.Hamiltonian(
+            [0.3, -1.2, 0.5],
+            [qml.PauliZ(0) @ qml.PauliZ(1), qml.PauliX(2), qml.Hadamard(1)],
+        )
+        H_sparse = qml.utils.sparse_hamiltonian(H, wires=dev.wires)
+        obs = qml.SparseHamiltonian(H_sparse, wires=dev.wires)
+        dev.apply(self.ops)
+
+        res = dev.expval(obs)
+        expected = self.expected(dev, H_sparse.toarray())
+
+        assert np.allclose(res, expected, tol)
+
+
+class TestProbabilityExpval:
+    """Test probabilities and projector expectation values computed on the device"""
+
+    ops = TestHamiltonianExpval.ops
+
+    @pytest.mark.parametrize("wires", [[0], [2, 0], [1, 2], [2, 1, 0]])
+    def test_probability_wire_order(self, wires, qubit_device_3_wires, tol):
+        """Test that probabilities are returned in the requested wire order"""
+        dev = qubit_device_3_wires
+        dev.apply(self.ops)
+
+        res = dev.probability(wires=wires)
+        dev.syncD2H()
+        probs = np.abs(dev.state.reshape([2] * 3)) ** 2
+        traced = [w for w in range(3) if w not in wires]
+        expected = np.transpose(np.sum(probs, axis=tuple(traced)), np.argsort(np.argsort(wires)))
+
+        assert np.allclose(res, expected.ravel(), tol)
+
+    @pytest.mark.parametrize("basis_state", [[0, 1], [1, 1]])
+    def test_projector_expectation(self, basis_state, qubit_device_3_wires, tol):
+        """Test that the expectation value of a projector is the probability of its basis state"""
+        dev = qubit_device_3_wires
+        obs = qml.Projector(basis_state, wires=[2, 0])
+        dev.apply(self.ops)
+
+        res = dev.expval(obs)
+        dev.syncD2H()
+        state = dev.state
+        matrix = qml.matrix(obs, wire_order=dev.wires)
+        expected = np.real(np.vdot(state, matrix @ state))
+
+        assert np.allclose(res, expected, tol)
+
+
+class TestBatchExecute:
+    """Test the evaluation of circuit batches on batched state-vectors"""
+
+    @staticmethod
+    def circuit(params, inverse=False):
+        with qml.tape.QuantumTape() as tape:
+            qml.Hadamard(wires=0)
+            qml.RX(params[0], wires=1)
+            qml.CNOT(wires=[0, 2])
+            qml.Rot(*params[1:4], wires=2)
+            op = qml.IsingXX(params[4], wires=[0, 1])
+            if inverse:
+                op.inv()
+            qml.expval(qml.PauliZ(1))
+            qml.expval(qml.PauliX(0) @ qml.Hermitian(A, wires=2))
+        return tape
+
+    @pytest.mark.parametrize("inverse", [False, True])
+    def test_batched_parameters(self, inverse, qubit_device_3_wires, monkeypatch, tol):
+        """Test that circuits only differing in their parameters are evaluated
+        together, with the results of their sequential execution"""
+        dev = qubit_device_3_wires
+        circuits = [self.circuit(p, inverse) for p in np.random.uniform(-2, 2, (4, 5))]
+
+        expected = []
+        for c in circuits:
+            dev.reset()
+            expected.append(dev.execute(c))
+
+        with monkeypatch.context() as m:
+            m.setattr(dev, "execute", lambda circuit: pytest.fail("Executed sequentially"))
+            res = dev.batch_execute(circuits)
+
+        assert len(res) == len(circuits)
+        for r, e in zip(res, expected):
+            assert np.allclose(r, e, tol)
+
+    def test_chunked_batches(self, qubit_device_3_wires, monkeypatch, tol):
+        """Test that batches larger than the device allows are evaluated in chunks"""
+        dev = qubit_device_3_wires
+        circuits = [self.circuit(p) for p in np.random.uniform(-2, 2, (7, 5))]
+
+        expected = []
+        for c in circuits:
+            dev.reset()
+            expected.append(dev.execute(c))
+
+        gpu_batched_dtype = lightning_gpu._gpu_batched_dtype
+        batch_sizes = []
+
+        class SmallBatch:
+            """Batched state-vectors limited to 3 circuits"""
+
+            maxObservableWires = staticmethod(
+                lambda: gpu_batched_dtype(dev._state.dtype).maxObservableWires()
+            )
+            maxBatchSize = staticmethod(lambda num_qubits: 3)
+
+            def __new__(cls, num_qubits, batch_size):
+                batch_sizes.append(batch_size)
+                return gpu_batched_dtype(dev._state.dtype)(num_qubits, batch_size)
+
+        monkeypatch.setattr(lightning_gpu, "_gpu_batched_dtype", lambda dtype: SmallBatch)
+        res = dev.batch_execute(circuits)
+
+        assert batch_sizes == [3, 3, 1]
+        assert len(res) == len(circuits)
+        for r, e in zip(res, expected):
+            assert np.allclose(r, e, tol)
+
+    def test_mismatched_circuits(self, qubit_device_3_wires, tol):
+        """Test that circuits with different structures are executed sequentially"""
+        dev = qubit_device_3_wires
+        circuits = [self.circuit(p) for p in np.random.uniform(-2, 2, (2, 5))]
+        with qml.tape.QuantumTape() as tape:
+            qml.RY(0.4, wires=2)
+            qml.expval(qml.PauliZ(2))
+        circuits.append(tape)
+
+        expected = []
+        for c in circuits:
+            dev.reset()
+            expected.append(dev.execute(c))
+
+        res = dev.batch_execute(circuits)
+        for r, e in zip(res, expected):
+            assert np.allclose(r, e, tol)
+
+
+class TestThreadedExecution:
+    """Test devices driven concurrently from several threads"""
+
+    def test_concurrent_devices(self, tol):
+        """Test that devices executing in separate threads, on their own streams,
+        match sequential execution"""
+        circuits = [TestBatchExecute.circuit(p) for p in np.random.uniform(-2, 2, (4, 5))]
+        devices = [qml.device("lightning.gpu", wires=3) for _ in circuits]
+
+        expected = []
+        for dev, c in zip(devices, circuits):
+            expected.append(dev.execute(c))
+            dev.reset()
+
+        with ThreadPoolExecutor(max_workers=len(devices)) as executor:
+            res = list(executor.map(lambda dc: dc[0].execute(dc[1]), zip(devices, circuits)))
+
+        for r, e in zip(res, expected):
+            assert np.allclose(r, e, tol)